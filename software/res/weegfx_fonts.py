@@ -0,0 +1,442 @@
+#!/usr/bin/env python3
+#
+# Generates src/src/drivers/weegfx_fonts.cpp
+#
+# Glyphs are drawn as ASCII art below ('#' = pixel on). For each glyph, the
+# column bytes are split into display pages and stored once for each of the 8
+# possible vertical offsets within a page, so weegfx never has to shift at
+# runtime; drawing a glyph is just OR-ing (pages x width) bytes into the frame.
+#
+# Usage: python3 res/weegfx_fonts.py > src/src/drivers/weegfx_fonts.cpp
+
+FIRST_CHAR = ' '
+LAST_CHAR = ':'
+
+NUMERALS_10 = {
+  'name': 'numerals_10',
+  'space': 4,
+  'spacing': 1,
+  'glyphs': {
+    '0': [".####.",
+          "##..##",
+          "##..##",
+          "##..##",
+          "##..##",
+          "##..##",
+          "##..##",
+          "##..##",
+          "##..##",
+          ".####."],
+    '1': ["..##..",
+          ".###..",
+          "####..",
+          "..##..",
+          "..##..",
+          "..##..",
+          "..##..",
+          "..##..",
+          "..##..",
+          "######"],
+    '2': [".####.",
+          "##..##",
+          "....##",
+          "....##",
+          "...##.",
+          "..##..",
+          ".##...",
+          "##....",
+          "##....",
+          "######"],
+    '3': [".####.",
+          "##..##",
+          "....##",
+          "....##",
+          "..###.",
+          "....##",
+          "....##",
+          "....##",
+          "##..##",
+          ".####."],
+    '4': ["...###",
+          "..####",
+          ".##.##",
+          "##..##",
+          "##..##",
+          "######",
+          "....##",
+          "....##",
+          "....##",
+          "....##"],
+    '5': ["######",
+          "##....",
+          "##....",
+          "#####.",
+          "....##",
+          "....##",
+          "....##",
+          "....##",
+          "##..##",
+          ".####."],
+    '6': ["..###.",
+          ".##...",
+          "##....",
+          "##....",
+          "#####.",
+          "##..##",
+          "##..##",
+          "##..##",
+          "##..##",
+          ".####."],
+    '7': ["######",
+          "....##",
+          "....##",
+          "...##.",
+          "...##.",
+          "..##..",
+          "..##..",
+          ".##...",
+          ".##...",
+          ".##..."],
+    '8': [".####.",
+          "##..##",
+          "##..##",
+          "##..##",
+          ".####.",
+          "##..##",
+          "##..##",
+          "##..##",
+          "##..##",
+          ".####."],
+    '9': [".####.",
+          "##..##",
+          "##..##",
+          "##..##",
+          "##..##",
+          ".#####",
+          "....##",
+          "....##",
+          "...##.",
+          ".###.."],
+    '.': ["..",
+          "..",
+          "..",
+          "..",
+          "..",
+          "..",
+          "..",
+          "..",
+          "##",
+          "##"],
+    '-': ["....",
+          "....",
+          "....",
+          "....",
+          "####",
+          "####",
+          "....",
+          "....",
+          "....",
+          "...."],
+    '+': ["......",
+          "......",
+          "..##..",
+          "..##..",
+          "######",
+          "######",
+          "..##..",
+          "..##..",
+          "......",
+          "......"],
+    ':': ["..",
+          "..",
+          "##",
+          "##",
+          "..",
+          "..",
+          "##",
+          "##",
+          "..",
+          ".."],
+  }
+}
+
+NUMERALS_14 = {
+  'name': 'numerals_14',
+  'space': 5,
+  'spacing': 2,
+  'glyphs': {
+    '0': ["..#####..",
+          ".##...##.",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          ".##...##.",
+          "..#####.."],
+    '1': ["...##....",
+          "..###....",
+          ".####....",
+          "##.##....",
+          "...##....",
+          "...##....",
+          "...##....",
+          "...##....",
+          "...##....",
+          "...##....",
+          "...##....",
+          "...##....",
+          "...##....",
+          ".#######."],
+    '2': ["..#####..",
+          ".##...##.",
+          "##.....##",
+          ".......##",
+          ".......##",
+          "......##.",
+          ".....##..",
+          "....##...",
+          "...##....",
+          "..##.....",
+          ".##......",
+          "##.......",
+          "##.......",
+          "#########"],
+    '3': ["..#####..",
+          ".##...##.",
+          "##.....##",
+          ".......##",
+          ".......##",
+          "......##.",
+          "...####..",
+          "......##.",
+          ".......##",
+          ".......##",
+          ".......##",
+          "##.....##",
+          ".##...##.",
+          "..#####.."],
+    '4': ["......##.",
+          ".....###.",
+          "....####.",
+          "...##.##.",
+          "..##..##.",
+          ".##...##.",
+          "##....##.",
+          "##....##.",
+          "#########",
+          "#########",
+          "......##.",
+          "......##.",
+          "......##.",
+          "......##."],
+    '5': ["#########",
+          "##.......",
+          "##.......",
+          "##.......",
+          "##.####..",
+          "###...##.",
+          ".......##",
+          ".......##",
+          ".......##",
+          ".......##",
+          ".......##",
+          "##.....##",
+          ".##...##.",
+          "..#####.."],
+    '6': ["...####..",
+          "..##.....",
+          ".##......",
+          "##.......",
+          "##.......",
+          "##.####..",
+          "###...##.",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          ".##...##.",
+          "..#####.."],
+    '7': ["#########",
+          ".......##",
+          ".......##",
+          "......##.",
+          "......##.",
+          ".....##..",
+          ".....##..",
+          "....##...",
+          "....##...",
+          "...##....",
+          "...##....",
+          "..##.....",
+          "..##.....",
+          "..##....."],
+    '8': ["..#####..",
+          ".##...##.",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          ".##...##.",
+          "..#####..",
+          ".##...##.",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          ".##...##.",
+          "..#####.."],
+    '9': ["..#####..",
+          ".##...##.",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          "##.....##",
+          ".##...###",
+          "..####.##",
+          ".......##",
+          ".......##",
+          "......##.",
+          ".....##..",
+          "..####..."],
+    '.': ["..",
+          "..",
+          "..",
+          "..",
+          "..",
+          "..",
+          "..",
+          "..",
+          "..",
+          "..",
+          "..",
+          "..",
+          "##",
+          "##"],
+    '-': ["......",
+          "......",
+          "......",
+          "......",
+          "......",
+          "......",
+          "######",
+          "######",
+          "......",
+          "......",
+          "......",
+          "......",
+          "......",
+          "......"],
+    '+': ["........",
+          "........",
+          "........",
+          "...##...",
+          "...##...",
+          "...##...",
+          "########",
+          "########",
+          "...##...",
+          "...##...",
+          "...##...",
+          "........",
+          "........",
+          "........"],
+    ':': ["..",
+          "..",
+          "..",
+          "##",
+          "##",
+          "..",
+          "..",
+          "..",
+          "..",
+          "##",
+          "##",
+          "..",
+          "..",
+          ".."],
+  }
+}
+
+FONTS = [NUMERALS_10, NUMERALS_14]
+
+
+def columns(rows):
+  """Glyph rows -> list of column bitmasks (bit 0 = top row)."""
+  width = len(rows[0])
+  cols = []
+  for x in range(width):
+    bits = 0
+    for y, row in enumerate(rows):
+      assert len(row) == width
+      if row[x] == '#':
+        bits |= 1 << y
+    cols.append(bits)
+  return cols
+
+
+def generate_font(font):
+  heights = set(len(rows) for rows in font['glyphs'].values())
+  assert len(heights) == 1, font['name']
+  height = heights.pop()
+  pages = (height + 7 + 7) // 8
+
+  widths, advances, offsets, data = [], [], [], []
+  for c in range(ord(FIRST_CHAR), ord(LAST_CHAR) + 1):
+    rows = font['glyphs'].get(chr(c))
+    offsets.append(len(data))
+    if rows is None:
+      widths.append(0)
+      advances.append(font['space'] if chr(c) == ' ' else 0)
+      continue
+    cols = columns(rows)
+    widths.append(len(cols))
+    advances.append(len(cols) + font['spacing'])
+    for shift in range(8):
+      for page in range(pages):
+        data.extend(((col << shift) >> (page * 8)) & 0xff for col in cols)
+
+  return height, pages, widths, advances, offsets, data
+
+
+def format_table(ctype, name, values, per_line=16):
+  lines = ['static const %s %s[] = {' % (ctype, name)]
+  for i in range(0, len(values), per_line):
+    lines.append('  ' + ' '.join('0x%02x,' % v if ctype == 'uint8_t' else '%d,' % v
+                                 for v in values[i:i + per_line]))
+  lines.append('};')
+  return '\n'.join(lines)
+
+
+def main():
+  print('// Automatically generated by res/weegfx_fonts.py, do not edit')
+  print()
+  print('#include <stdint.h>')
+  print('#include "weegfx_fonts.h"')
+  print()
+  print('namespace weegfx {')
+  for font in FONTS:
+    height, pages, widths, advances, offsets, data = generate_font(font)
+    name = font['name']
+    print()
+    print(format_table('uint8_t', name + '_widths', widths))
+    print(format_table('uint8_t', name + '_advances', advances))
+    print(format_table('uint16_t', name + '_offsets', offsets))
+    print(format_table('uint8_t', name + '_data', data))
+    print()
+    print('const GlyphFont %s = {' % name)
+    print('  %d, %d, \'%s\', \'%s\',' % (height, pages, FIRST_CHAR, LAST_CHAR))
+    print('  %s_widths, %s_advances, %s_offsets, %s_data' % (name, name, name, name))
+    print('};')
+  print()
+  print('}  // namespace weegfx')
+
+
+if __name__ == '__main__':
+  main()
@@ -56,6 +56,9 @@ enum ByteBeatSettings {
   BYTEBEAT_SETTING_CV2,
   BYTEBEAT_SETTING_CV3,
   BYTEBEAT_SETTING_CV4,
+#ifdef BYTEBEAT_USER_FORMULAS
+  BYTEBEAT_SETTING_USER_FORMULA,
+#endif
   BYTEBEAT_SETTING_LAST,
   BYTEBEAT_SETTING_FIRST=BYTEBEAT_SETTING_EQUATION,
 };
@@ -111,6 +114,13 @@ public:
     return values_[BYTEBEAT_SETTING_EQUATION];
   }
 
+#ifdef BYTEBEAT_USER_FORMULAS
+  // 0 = built-in equation, else 1 + index into peaks::bytebeat_user_formulas
+  uint8_t get_user_formula() const {
+    return values_[BYTEBEAT_SETTING_USER_FORMULA];
+  }
+#endif
+
   bool get_step_mode() const {
     return values_[BYTEBEAT_SETTING_STEP_MODE];
   }
@@ -207,6 +217,9 @@ public:
   void update_enabled_settings() {
     ByteBeatSettings *settings = enabled_settings_;
     *settings++ = BYTEBEAT_SETTING_EQUATION;
+#ifdef BYTEBEAT_USER_FORMULAS
+    *settings++ = BYTEBEAT_SETTING_USER_FORMULA;
+#endif
     *settings++ = BYTEBEAT_SETTING_SPEED;
     *settings++ = BYTEBEAT_SETTING_PITCH;
     *settings++ = BYTEBEAT_SETTING_P0;
@@ -299,6 +312,11 @@ public:
     }
 
     bytebeat_.Configure(s, get_step_mode(), get_loop_mode()) ;
+#ifdef BYTEBEAT_USER_FORMULAS
+    // The active program may have been swapped by the editor
+    const uint8_t user_formula = get_user_formula();
+    bytebeat_.set_program(user_formula ? &peaks::bytebeat_user_formulas[user_formula - 1].program() : nullptr);
+#endif
 
     OC::DigitalInput trigger_input = get_trigger_input();
     uint8_t gate_state = 0;
@@ -376,6 +394,9 @@ SETTINGS_DECLARE(ByteBeat, BYTEBEAT_SETTING_LAST) {
   { BYTEBEAT_CV_MAPPING_NONE, BYTEBEAT_CV_MAPPING_NONE, BYTEBEAT_CV_MAPPING_LAST - 1, "CV2 -> ", bytebeat_cv_mapping_names, settings::STORAGE_TYPE_U4 },
   { BYTEBEAT_CV_MAPPING_NONE, BYTEBEAT_CV_MAPPING_NONE, BYTEBEAT_CV_MAPPING_LAST - 1, "CV3 -> ", bytebeat_cv_mapping_names, settings::STORAGE_TYPE_U4 },
   { BYTEBEAT_CV_MAPPING_NONE, BYTEBEAT_CV_MAPPING_NONE, BYTEBEAT_CV_MAPPING_LAST - 1, "CV4 -> ", bytebeat_cv_mapping_names, settings::STORAGE_TYPE_U4 },
+#ifdef BYTEBEAT_USER_FORMULAS
+  { 0, 0, peaks::kNumUserFormulas, "Formula", peaks::bytebeat_user_formula_names, settings::STORAGE_TYPE_U4 },
+#endif
 };
 
 class QuadByteBeats {
@@ -399,6 +420,10 @@ public:
     ui.selected_segment = 0;
     ui.cursor.Init(BYTEBEAT_SETTING_EQUATION, BYTEBEAT_SETTING_LAST - 1);
     ui.cursor.AdjustEnd(bytebeats_[0].num_enabled_settings() - 1);
+#ifdef BYTEBEAT_USER_FORMULAS
+    ui.formula_editor = -1;
+    ui.formula_pos = 0;
+#endif
   }
 
   void ISR() {
@@ -436,6 +461,10 @@ public:
     int selected_channel;
     int selected_segment;
     menu::ScreenCursor<menu::kScreenLines> cursor;
+#ifdef BYTEBEAT_USER_FORMULAS
+    int formula_editor; // user formula being edited, or -1
+    int formula_pos;
+#endif
   } ui;
 
   ByteBeat &selected() {
@@ -453,17 +482,28 @@ public:
 QuadByteBeats bytebeatgen;
 
 void BYTEBEATGEN_init() {
+#ifdef BYTEBEAT_USER_FORMULAS
+  peaks::InitByteBeatUserFormulas();
+#endif
   bytebeatgen.Init();
 }
 
 static constexpr size_t BYTEBEATGEN_storageSize() {
+#ifdef BYTEBEAT_USER_FORMULAS
+  return 4 * ByteBeat::storageSize() + peaks::kNumUserFormulas * peaks::ByteBeatUserFormula::storageSize();
+#else
   return 4 * ByteBeat::storageSize();
+#endif
 }
 
 static size_t BYTEBEATGEN_save(void *storage) {
   size_t s = 0;
   for (auto &bytebeat : bytebeatgen.bytebeats_)
     s += bytebeat.Save(static_cast<byte *>(storage) + s);
+#ifdef BYTEBEAT_USER_FORMULAS
+  for (auto &formula : peaks::bytebeat_user_formulas)
+    s += formula.Save(static_cast<byte *>(storage) + s);
+#endif
   return s;
 }
 
@@ -473,6 +513,10 @@ static size_t BYTEBEATGEN_restore(const void *storage) {
     s += bytebeat.Restore(static_cast<const byte *>(storage) + s);
     bytebeat.update_enabled_settings();
   }
+#ifdef BYTEBEAT_USER_FORMULAS
+  for (auto &formula : peaks::bytebeat_user_formulas)
+    s += formula.Restore(static_cast<const byte *>(storage) + s);
+#endif
   bytebeatgen.ui.cursor.AdjustEnd(bytebeatgen.bytebeats_[0].num_enabled_settings() - 1);
   return s;
 }
@@ -482,6 +526,9 @@ void BYTEBEATGEN_handleAppEvent(OC::AppEvent event) {
   switch (event) {
     case OC::APP_EVENT_RESUME:
       bytebeatgen.ui.cursor.set_editing(false);
+#ifdef BYTEBEAT_USER_FORMULAS
+      bytebeatgen.ui.formula_editor = -1;
+#endif
       break;
     case OC::APP_EVENT_SUSPEND:
     case OC::APP_EVENT_SCREENSAVER_ON:
@@ -493,7 +540,98 @@ void BYTEBEATGEN_handleAppEvent(OC::AppEvent event) {
 void BYTEBEATGEN_loop() {
 }
 
+#ifdef BYTEBEAT_USER_FORMULAS
+// Tokens flow left to right and wrap; the cursor can sit one past the end to
+// append. Tokens are edited in place and the formula recompiled on every
+// change, but the channel keeps playing the last version that compiled.
+void BYTEBEATGEN_drawFormulaEditor() {
+  const int slot = bytebeatgen.ui.formula_editor;
+  const auto &formula = peaks::bytebeat_user_formulas[slot];
+
+  menu::DefaultTitleBar::Draw();
+  graphics.print("Formula ");
+  graphics.print(peaks::bytebeat_user_formula_names[slot + 1]);
+  graphics.setPrintPos(menu::kDisplayWidth - 3 * weegfx::kFixedFontW - 2, 2);
+  graphics.print(formula.valid() ? " ok" : "err");
+
+  const size_t length = formula.length();
+  weegfx::coord_t x = 0;
+  weegfx::coord_t y = menu::kMenuLineH + 4;
+  for (size_t i = 0; i <= length && i < peaks::ByteBeatUserFormula::kMaxTokens; ++i) {
+    const char *name = i < length ? peaks::bytebeat_token_names[formula.token(i)] : "_";
+    const weegfx::coord_t w = strlen(name) * weegfx::kFixedFontW;
+    if (x + w > menu::kDisplayWidth) {
+      x = 0;
+      y += menu::kMenuLineH;
+    }
+    graphics.setPrintPos(x, y);
+    graphics.print(name);
+    if (static_cast<int>(i) == bytebeatgen.ui.formula_pos)
+      graphics.invertRect(x, y - 1, w, menu::kFontHeight + 1);
+    if (static_cast<int>(i) == formula.error_pos())
+      graphics.drawHLine(x, y + menu::kFontHeight + 1, w);
+    x += w;
+  }
+}
+
+void BYTEBEATGEN_openFormulaEditor() {
+  auto &selected = bytebeatgen.selected();
+  if (selected.enabled_setting_at(bytebeatgen.ui.cursor.cursor_pos()) != BYTEBEAT_SETTING_USER_FORMULA)
+    return;
+  const int slot = selected.get_user_formula() - 1;
+  if (slot < 0)
+    return;
+  bytebeatgen.ui.cursor.set_editing(false);
+  bytebeatgen.ui.formula_editor = slot;
+  bytebeatgen.ui.formula_pos = peaks::bytebeat_user_formulas[slot].length();
+  CONSTRAIN(bytebeatgen.ui.formula_pos, 0, static_cast<int>(peaks::ByteBeatUserFormula::kMaxTokens) - 1);
+}
+
+void BYTEBEATGEN_handleFormulaEditorEvent(const UI::Event &event) {
+  auto &formula = peaks::bytebeat_user_formulas[bytebeatgen.ui.formula_editor];
+  int &pos = bytebeatgen.ui.formula_pos;
+
+  if (UI::EVENT_BUTTON_PRESS == event.type) {
+    switch (event.control) {
+      case OC::CONTROL_BUTTON_UP:
+        formula.Insert(pos);
+        break;
+      case OC::CONTROL_BUTTON_DOWN:
+        formula.Erase(pos);
+        break;
+      case OC::CONTROL_BUTTON_L:
+      case OC::CONTROL_BUTTON_R:
+        bytebeatgen.ui.formula_editor = -1;
+        break;
+    }
+  } else if (UI::EVENT_ENCODER == event.type) {
+    if (OC::CONTROL_ENCODER_L == event.control) {
+      pos += event.value;
+    } else if (OC::CONTROL_ENCODER_R == event.control) {
+      // Cycle through all tokens except NONE
+      static constexpr int kNumTokens = peaks::BYTEBEAT_TOKEN_LAST - 1;
+      int token = formula.token(pos);
+      if (token == peaks::BYTEBEAT_TOKEN_NONE)
+        token = event.value > 0 ? 0 : 1;
+      token = (token - 1 + event.value) % kNumTokens;
+      if (token < 0)
+        token += kNumTokens;
+      formula.set_token(pos, token + 1);
+    }
+  }
+  int max_pos = formula.length();
+  CONSTRAIN(max_pos, 0, static_cast<int>(peaks::ByteBeatUserFormula::kMaxTokens) - 1);
+  CONSTRAIN(pos, 0, max_pos);
+}
+#endif
+
 void BYTEBEATGEN_menu() {
+#ifdef BYTEBEAT_USER_FORMULAS
+  if (bytebeatgen.ui.formula_editor >= 0) {
+    BYTEBEATGEN_drawFormulaEditor();
+    return;
+  }
+#endif
 
   menu::QuadTitleBar::Draw();
   for (uint_fast8_t i = 0; i < 4; ++i) {
@@ -526,6 +664,12 @@ void BYTEBEATGEN_lowerButton() {
 }
 
 void BYTEBEATGEN_handleButtonEvent(const UI::Event &event) {
+#ifdef BYTEBEAT_USER_FORMULAS
+  if (bytebeatgen.ui.formula_editor >= 0) {
+    BYTEBEATGEN_handleFormulaEditorEvent(event);
+    return;
+  }
+#endif
   if (UI::EVENT_BUTTON_PRESS == event.type) {
     switch (event.control) {
       case OC::CONTROL_BUTTON_UP:
@@ -535,6 +679,9 @@ void BYTEBEATGEN_handleButtonEvent(const UI::Event &event) {
         BYTEBEATGEN_lowerButton();
         break;
       case OC::CONTROL_BUTTON_L:
+#ifdef BYTEBEAT_USER_FORMULAS
+        BYTEBEATGEN_openFormulaEditor();
+#endif
         break;
       case OC::CONTROL_BUTTON_R:
         bytebeatgen.ui.cursor.toggle_editing();
@@ -544,6 +691,12 @@ void BYTEBEATGEN_handleButtonEvent(const UI::Event &event) {
 }
 
 void BYTEBEATGEN_handleEncoderEvent(const UI::Event &event) {
+#ifdef BYTEBEAT_USER_FORMULAS
+  if (bytebeatgen.ui.formula_editor >= 0) {
+    BYTEBEATGEN_handleFormulaEditorEvent(event);
+    return;
+  }
+#endif
 
   if (OC::CONTROL_ENCODER_L == event.control) {
     int left_value = bytebeatgen.ui.selected_channel + event.value;
@@ -33,7 +33,6 @@
 #include "braids_quantizer_scales.h"
 #include "OC_scales.h"
 #include "OC_autotuner.h"
-#include "SegmentDisplay.h"
 #include "src/drivers/FreqMeasure/OC_FreqMeasure.h"
 #include "HemisphereApplet.h"
 #ifdef ARDUINO_TEENSY41
@@ -211,8 +210,6 @@ public:
 
 
     void Start() {
-        segment.Init(SegmentSize::BIG_SEGMENTS);
-
         // make sure to turn this off, just in case
         FreqMeasure.end();
         OC::DigitalInputs::reInit();
@@ -612,7 +609,6 @@ public:
 
     int trigger_flash[DAC_CHANNEL_LAST];
 
-    SegmentDisplay segment;
     Cal8ChannelConfig channel[DAC_CHANNEL_LAST];
 
     void DrawPresetSelector() {
@@ -678,9 +674,9 @@ public:
         gfxFrame(20, y-3, 64, 18);
         gfxIcon(23, y+2, positive? PLUS_ICON : MINUS_ICON);
 
-        segment.PrintWhole(33, y, abs(octave), 10);
-        gfxPrint(53, y+5, ".");
-        segment.PrintWhole(61, y, abs(degrees), 10);
+        gfxGlyphsRight(weegfx::numerals_14, 54, y-1, abs(octave));
+        gfxGlyphs(weegfx::numerals_14, 53, y-1, ".");
+        gfxGlyphsRight(weegfx::numerals_14, 82, y-1, abs(degrees));
 
         // Scale
         gfxIcon(89, y, SCALE_ICON);
@@ -33,6 +33,7 @@
 #include "util/util_trigger_delay.h"
 #include "braids_quantizer.h"
 #include "braids_quantizer_scales.h"
+#include "HSPitchMemo.h"
 #include "OC_menus.h"
 #include "OC_scales.h"
 #include "OC_scale_edit.h"
@@ -411,12 +412,17 @@ public:
     trigger_delay_.Init();
     input_map_.Init();
     quantizer_.Init();
+    voice_quantizer_.Init();
     chords_.Init();
     update_scale(true, false);
     clock_display_.Init();
     update_enabled_settings();
   }
 
+  const HS::PitchMemo<3, 16> &voice_memo() const {
+    return voice_memo_;
+  }
+
   void force_update() {
     //force_update_ = true;
   }
@@ -819,12 +825,8 @@ public:
       sample_a = temp_sample = OC::DAC::pitch_to_scaled_voltage_dac(DAC_CHANNEL_A, quantized, octave + OC::inversion[_inversion][0], OC::DAC::get_voltage_scaling(DAC_CHANNEL_A));
 
       // now derive chords ...
-      transpose += OC::qualities[_quality][1];
-      int32_t sample_b  = quantizer_.Process(pitch, root << 7, transpose);
-      transpose += OC::qualities[_quality][2];
-      int32_t sample_c  = quantizer_.Process(pitch, root << 7, transpose);
-      transpose += OC::qualities[_quality][3];
-      int32_t sample_d  = quantizer_.Process(pitch, root << 7, transpose);
+      int32_t sample_b, sample_c, sample_d;
+      voices(quantized, root, transpose, _quality, sample_b, sample_c, sample_d);
 
       //todo voicing for root note
       sample_b = OC::DAC::pitch_to_scaled_voltage_dac(DAC_CHANNEL_B, sample_b, octave + OC::voicing[_voicing][1] + OC::inversion[_inversion][1], OC::DAC::get_voltage_scaling(DAC_CHANNEL_B));
@@ -962,6 +964,8 @@ private:
 
   util::TriggerDelay<OC::kMaxTriggerDelayTicks> trigger_delay_;
   braids::Quantizer quantizer_;
+  braids::Quantizer voice_quantizer_; // for the upper voices, so the root keeps its hysteresis
+  HS::PitchMemo<3, 16> voice_memo_;
   OC::Input_Map input_map_;
   OC::DigitalInputDisplay clock_display_;
   OC::Chords chords_;
@@ -969,6 +973,28 @@ private:
   int num_enabled_settings_;
   CHORDS_SETTINGS enabled_settings_[CHORDS_SETTING_LAST];
 
+  // The other three voices of a chord on the quantized root. They're worked out from the
+  // root's scale degree, and the same root and chord always gives the same voices.
+  void voices(int32_t quantized, int32_t root, int32_t transpose, int8_t quality,
+              int32_t &sample_b, int32_t &sample_c, int32_t &sample_d) {
+    const HS::PitchMemo<3, 16>::Key key = {
+      quantized, static_cast<int16_t>(root), static_cast<int8_t>(transpose), static_cast<uint8_t>(quality)
+    };
+    bool hit;
+    int32_t *voice = voice_memo_.Get(key, hit);
+    if (!hit) {
+      int32_t degrees = 0;
+      for (int v = 0; v < 3; v++) {
+        degrees += OC::qualities[quality][v + 1];
+        voice_quantizer_.Requantize();
+        voice[v] = voice_quantizer_.Process(quantized, root << 7, degrees);
+      }
+    }
+    sample_b = voice[0];
+    sample_c = voice[1];
+    sample_d = voice[2];
+  }
+
   bool update_scale(bool force, int32_t mask_rotate) {
 
     force_update_ = false;
@@ -982,6 +1008,8 @@ private:
       last_scale_ = scale;
       last_mask_ = mask;
       quantizer_.Configure(OC::Scales::GetScale(scale), mask);
+      voice_quantizer_.Configure(OC::Scales::GetScale(scale), mask);
+      voice_memo_.Invalidate();
       return true;
     } else {
       return false;
@@ -1114,6 +1142,16 @@ void CHORDS_isr() {
 void CHORDS_loop() {
 }
 
+void CHORDS_debug() {
+  const HS::PitchMemo<3, 16> &memo = chords.voice_memo();
+  graphics.setPrintPos(2, 12);
+  graphics.print("voices");
+  graphics.setPrintPos(2, 22);
+  graphics.printf("%lu hit %lu miss", memo.hits(), memo.misses());
+  graphics.setPrintPos(2, 32);
+  graphics.printf("%d%% hit rate", memo.hit_rate());
+}
+
 void CHORDS_menu() {
 
   menu::TitleBar<0, 4, 0>::Draw();
@@ -32,6 +32,7 @@
 #include "HSApplication.h"
 
 #include "HSMIDI.h"
+#include "HSTuringMachineTable.h"
 #include "enigma/TuringMachine.h"
 #include "enigma/TuringMachineState.h"
 #include "enigma/EnigmaStep.h"
@@ -86,6 +87,7 @@ public:
 	        output[o].InitAs(o);
 	        track[o].InitAs(o);
 	    }
+	    tm_tables.Invalidate();
 
 	    ResetSong();
 
@@ -308,6 +310,11 @@ private:
     bool playback_end[4]; // End non-looping playback until reset
     TuringMachineState track_tm[4]; // Turing Machine states for each track
 
+    // Locked steps play from a precomputed table of each machine's outputs
+    typedef HS::TuringMachineTableCache<4, 8> TMTables;
+    TMTables tm_tables;
+    TMTables::Playback track_table[4];
+
     //////// DATA
     EnigmaStep song_step[400]; // Max 99 steps per track
     EnigmaOutput output[4];
@@ -319,7 +326,7 @@ private:
     int16_t edit_index = 0; // Current Song Mode step within track_step[]
 
     // Primary object cursors, one for each mode
-    int8_t tm_cursor = 0; // For Library mode, choose the Turing Machine (0-39: A1-F8)
+    int8_t tm_cursor = 0; // For Library mode, choose the Turing Machine (A-1 onwards, eight per bank)
     int8_t output_cursor = 0; // For Output mode, choose the Output (0-3: A~D)
     int8_t track_cursor = 0; // For Song mode, choose the Track number (0-3: Tr1-Tr4)
 
@@ -671,10 +678,12 @@ private:
         if (output_param == ENIGMA_OUTPUT_TYPE) {
             if (output[output_cursor].type() > 0 || direction > 0)
                 output[output_cursor].set_type(output[output_cursor].type() + direction);
+            tm_tables.Invalidate();
         }
         if (output_param == ENIGMA_OUTPUT_SCALE) {
             if (output[output_cursor].scale() > 0 || direction > 0)
                 output[output_cursor].set_scale(output[output_cursor].scale() + direction);
+            tm_tables.Invalidate();
         }
         if (output_param == ENIGMA_OUTPUT_MIDI_CH) {
             if (output[output_cursor].midi_channel() > 0 || direction > 0)
@@ -772,6 +781,7 @@ private:
                         // If the repeat and beat are both at 0, set the Turing Machine state
                         if (playback_step_repeat[t] == 0 && playback_step_beat[t] == 0) {
                             track_tm[t].Init(song_step[ssi].tm());
+                            StartTrackTable(t, song_step[ssi].p());
                             playback_step_number[t]++;
                         }
 
@@ -813,11 +823,19 @@ private:
                         }
 
                         // Send the track to the appopriate outputs
+                        const TMTables::Table *table = nullptr;
+                        if (track_table[t].table) table = tm_tables.Find(track_table[t], OutputValue(this));
                         for (byte o = 0; o < 4; o++)
                         {
                             if (output[o].track() == t) {
                                 uint16_t reg = track_tm[t].GetRegister();
-                                output[o].SendToDAC<EnigmaTMWS>(this, reg, song_step[ssi].transpose() * 128);
+                                if (table) {
+                                    reg = table->step_reg[track_table[t].step];
+                                    output[o].SendValueToDAC<EnigmaTMWS>(this, table->value[track_table[t].step][o],
+                                                                         song_step[ssi].transpose() * 128);
+                                } else {
+                                    output[o].SendToDAC<EnigmaTMWS>(this, reg, song_step[ssi].transpose() * 128);
+                                }
 
                                 if (deferred_note > -1) output[o].SetDeferredNote(deferred_note);
                                 output[o].SendToMIDI(reg, song_step[ssi].transpose() * 128);
@@ -825,7 +843,8 @@ private:
                             }
                         }
 
-                        track_tm[t].Advance(song_step[ssi].p());
+                        if (table) tm_tables.Advance(track_table[t]);
+                        track_tm[t].Advance(song_step[ssi].p()); // still kept for the display
                     } else { // End of step availability check
                         playback_end[t] = 1;
                     }
@@ -925,11 +944,28 @@ private:
             playback_step_repeat[t] = 0;
             playback_step_beat[t] = 0;
             playback_end[t] = 0;
+            tm_tables.Stop(track_table[t]);
 
             output[t].NoteOff();
         }
     }
 
+    // What each output sends for a register, for building tables
+    struct OutputValue {
+        EnigmaTMWS *app;
+        explicit OutputValue(EnigmaTMWS *app_) : app(app_) {}
+        int operator()(int o, uint16_t reg) const {return app->output[o].DACValue(reg);}
+    };
+
+    // A step whose machine can't change (probability 0, or a favorite) plays from a table
+    void StartTrackTable(byte t, byte p) {
+        if (p == 0 || track_tm[t].IsFavorite()) {
+            tm_tables.Start(track_table[t], track_tm[t].GetRegister(), track_tm[t].GetLength(), OutputValue(this));
+        } else {
+            tm_tables.Stop(track_table[t]);
+        }
+    }
+
     uint16_t GetFirstStep(byte track) {
         uint16_t step = ENIGMA_NO_STEP_AVAILABLE;
         for (uint16_t s = 0; s < total_steps; s++)
@@ -1093,7 +1129,9 @@ private:
             output[o].ty = V[ix++];
             output[o].sc = V[ix++];
             output[o].mc = V[ix++];
+            output[o].set_scale(output[o].sc);
         }
+        tm_tables.Invalidate();
     }
 
     //////// Data Storage
@@ -1135,7 +1173,9 @@ private:
             output[o].ty = values_[ix++];
             output[o].sc = values_[ix++];
             output[o].mc = values_[ix++];
+            output[o].set_scale(output[o].sc);
         }
+        tm_tables.Invalidate();
 
         // Song length
         byte song_steps = values_[ix++];
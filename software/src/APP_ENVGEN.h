@@ -419,7 +419,9 @@ public:
     return false;
   }
 
-  void Update(uint32_t triggers, uint32_t internal_trigger_mask, const int32_t cvs[ADC_CHANNEL_LAST], DAC_CHANNEL dac_channel) {
+  // Applies settings and CVs to the envelope and returns its gate state for
+  // this tick. The envelope itself is stepped by QuadEnvelopeGenerator.
+  uint8_t Update(uint32_t triggers, uint32_t internal_trigger_mask, const int32_t cvs[ADC_CHANNEL_LAST]) {
     int32_t s[CV_MAPPING_LAST];
     s[CV_MAPPING_NONE] = 0; // unused, but needs a placeholder to align with enum CVMapping
     s[CV_MAPPING_SEG1] = SCALE8_16(static_cast<int32_t>(get_segment_value(0)));
@@ -450,49 +452,33 @@ public:
     CONSTRAIN(s[CV_MAPPING_AMPLITUDE], 0, 65535);
     CONSTRAIN(s[CV_MAPPING_MAX_LOOPS], 0, 65535);
 
-    EnvelopeType type = get_type();
-    switch (type) {
-      case ENV_TYPE_AD: env_.set_ad(s[CV_MAPPING_SEG1], s[CV_MAPPING_SEG2], 0, 0); break;
-      case ENV_TYPE_ADSR: env_.set_adsr(s[CV_MAPPING_SEG1], s[CV_MAPPING_SEG2], s[CV_MAPPING_SEG3]>>1, s[CV_MAPPING_SEG4]); break;
-      case ENV_TYPE_ADR: env_.set_adr(s[CV_MAPPING_SEG1], s[CV_MAPPING_SEG2], s[CV_MAPPING_SEG3]>>1, s[CV_MAPPING_SEG4], 0, 0 ); break;
-      case ENV_TYPE_AR: env_.set_ar(s[CV_MAPPING_SEG1], s[CV_MAPPING_SEG2]); break;
-      case ENV_TYPE_ADSAR: env_.set_adsar(s[CV_MAPPING_SEG1], s[CV_MAPPING_SEG2], s[CV_MAPPING_SEG3]>>1, s[CV_MAPPING_SEG4]); break;
-      case ENV_TYPE_ADAR: env_.set_adar(s[CV_MAPPING_SEG1], s[CV_MAPPING_SEG2], s[CV_MAPPING_SEG3]>>1, s[CV_MAPPING_SEG4], 0, 0); break;
-      case ENV_TYPE_ADL2: env_.set_ad(s[CV_MAPPING_SEG1], s[CV_MAPPING_SEG2], 0, 2); break;
-      case ENV_TYPE_ADRL3: env_.set_adr(s[CV_MAPPING_SEG1], s[CV_MAPPING_SEG2], s[CV_MAPPING_SEG3]>>1, s[CV_MAPPING_SEG4], 0, 3); break;
-      case ENV_TYPE_ADL2R: env_.set_adr(s[CV_MAPPING_SEG1], s[CV_MAPPING_SEG2], s[CV_MAPPING_SEG3]>>1, s[CV_MAPPING_SEG4], 0, 2); break;
-      case ENV_TYPE_ADARL4: env_.set_adar(s[CV_MAPPING_SEG1], s[CV_MAPPING_SEG2], s[CV_MAPPING_SEG3]>>1, s[CV_MAPPING_SEG4], 0, 4); break;
-      case ENV_TYPE_ADAL2R: env_.set_adar(s[CV_MAPPING_SEG1], s[CV_MAPPING_SEG2], s[CV_MAPPING_SEG3]>>1, s[CV_MAPPING_SEG4], 1, 3); break; // was 2, 4
-      default:
-      break;
-    }
-
-    // set the amplitude
-    env_.set_amplitude(s[CV_MAPPING_AMPLITUDE], is_amplitude_sampled()) ;
-    
-    if (type != last_type_) {
-      last_type_ = type;
-      env_.reset();
+    // Everything the envelope is set up from. This rarely changes, so the
+    // envelope is only reconfigured when it does.
+    EnvelopeConfig config;
+    config.segments[0] = s[CV_MAPPING_SEG1];
+    config.segments[1] = s[CV_MAPPING_SEG2];
+    config.segments[2] = s[CV_MAPPING_SEG3];
+    config.segments[3] = s[CV_MAPPING_SEG4];
+    config.amplitude = s[CV_MAPPING_AMPLITUDE];
+    config.max_loops = s[CV_MAPPING_MAX_LOOPS];
+    config.time_multipliers[0] = get_attack_time_multiplier();
+    config.time_multipliers[1] = get_decay_time_multiplier();
+    config.time_multipliers[2] = get_release_time_multiplier();
+    config.shapes[0] = get_attack_shape();
+    config.shapes[1] = get_decay_shape();
+    config.shapes[2] = get_release_shape();
+    config.type = get_type();
+    config.amplitude_sampled = is_amplitude_sampled();
+    config.attack_reset_behaviour = get_attack_reset_behaviour();
+    config.attack_falling_gate_behaviour = get_attack_falling_gate_behaviour();
+    config.decay_release_reset_behaviour = get_decay_release_reset_behaviour();
+
+    envelope_changed_ = memcmp(&config, &config_, sizeof(config));
+    if (envelope_changed_) {
+      config_ = config;
+      Configure();
     }
 
-    // set the specified reset behaviours
-    env_.set_attack_reset_behaviour(get_attack_reset_behaviour());
-    env_.set_attack_falling_gate_behaviour(get_attack_falling_gate_behaviour());
-    env_.set_decay_release_reset_behaviour(get_decay_release_reset_behaviour());
-
-    // set the envelope segment shapes
-    env_.set_attack_shape(get_attack_shape());
-    env_.set_decay_shape(get_decay_shape());
-    env_.set_release_shape(get_release_shape());
-
-    // set the envelope segment time multipliers
-    env_.set_attack_time_multiplier(get_attack_time_multiplier());
-    env_.set_decay_time_multiplier(get_decay_time_multiplier());
-    env_.set_release_time_multiplier(get_release_time_multiplier());
-
-    // set the looping envelope maximum number of loops
-    env_.set_max_loops(s[CV_MAPPING_MAX_LOOPS]);
-
     int trigger_input = get_trigger_input();
     bool triggered = false;
     bool gate_raised = false;
@@ -566,7 +552,11 @@ public:
       gate_state |= peaks::CONTROL_GATE_FALLING;
     gate_raised_ = gate_raised;
 
-    uint32_t value = env_.ProcessSingleSample(gate_state); // 0 to 32767
+    return gate_state;
+  }
+
+  void Output(uint32_t value, DAC_CHANNEL dac_channel) {
+    // value is 0 to 32767
     if (is_inverted()) value = 32767 - value;
     const int max_val = OC::DAC::MAX_VALUE;
 
@@ -623,11 +613,35 @@ public:
     return env_.get_state_mask();
   }
 
+  peaks::MultistageEnvelope *envelope() {
+    return &env_;
+  }
+
+  // The envelope's settings were changed by the last Update()
+  bool envelope_changed() const {
+    return envelope_changed_;
+  }
+
 private:
 
+  struct EnvelopeConfig {
+    uint16_t segments[4];
+    uint16_t amplitude;
+    uint16_t max_loops;
+    uint16_t time_multipliers[3];
+    uint8_t shapes[3];
+    uint8_t type;
+    uint8_t amplitude_sampled;
+    uint8_t attack_reset_behaviour;
+    uint8_t attack_falling_gate_behaviour;
+    uint8_t decay_release_reset_behaviour;
+  };
+
   int channel_index_;
  
   peaks::MultistageEnvelope env_;
+  EnvelopeConfig config_;
+  bool envelope_changed_;
   EnvelopeType last_type_;
   bool gate_raised_;
   uint32_t euclidean_counter_;
@@ -647,6 +661,52 @@ private:
 
   OC::DigitalInputDisplay trigger_display_;
 
+  void Configure() {
+    const EnvelopeConfig &c = config_;
+
+    // set the envelope segment shapes and time multipliers first, so the
+    // set_ functions below pick them up
+    env_.set_attack_shape(static_cast<peaks::EnvelopeShape>(c.shapes[0]));
+    env_.set_decay_shape(static_cast<peaks::EnvelopeShape>(c.shapes[1]));
+    env_.set_release_shape(static_cast<peaks::EnvelopeShape>(c.shapes[2]));
+    env_.set_attack_time_multiplier(c.time_multipliers[0]);
+    env_.set_decay_time_multiplier(c.time_multipliers[1]);
+    env_.set_release_time_multiplier(c.time_multipliers[2]);
+
+    EnvelopeType type = static_cast<EnvelopeType>(c.type);
+    switch (type) {
+      case ENV_TYPE_AD: env_.set_ad(c.segments[0], c.segments[1], 0, 0); break;
+      case ENV_TYPE_ADSR: env_.set_adsr(c.segments[0], c.segments[1], c.segments[2]>>1, c.segments[3]); break;
+      case ENV_TYPE_ADR: env_.set_adr(c.segments[0], c.segments[1], c.segments[2]>>1, c.segments[3], 0, 0 ); break;
+      case ENV_TYPE_AR: env_.set_ar(c.segments[0], c.segments[1]); break;
+      case ENV_TYPE_ADSAR: env_.set_adsar(c.segments[0], c.segments[1], c.segments[2]>>1, c.segments[3]); break;
+      case ENV_TYPE_ADAR: env_.set_adar(c.segments[0], c.segments[1], c.segments[2]>>1, c.segments[3], 0, 0); break;
+      case ENV_TYPE_ADL2: env_.set_ad(c.segments[0], c.segments[1], 0, 2); break;
+      case ENV_TYPE_ADRL3: env_.set_adr(c.segments[0], c.segments[1], c.segments[2]>>1, c.segments[3], 0, 3); break;
+      case ENV_TYPE_ADL2R: env_.set_adr(c.segments[0], c.segments[1], c.segments[2]>>1, c.segments[3], 0, 2); break;
+      case ENV_TYPE_ADARL4: env_.set_adar(c.segments[0], c.segments[1], c.segments[2]>>1, c.segments[3], 0, 4); break;
+      case ENV_TYPE_ADAL2R: env_.set_adar(c.segments[0], c.segments[1], c.segments[2]>>1, c.segments[3], 1, 3); break; // was 2, 4
+      default:
+      break;
+    }
+
+    // set the amplitude
+    env_.set_amplitude(c.amplitude, c.amplitude_sampled) ;
+    
+    if (type != last_type_) {
+      last_type_ = type;
+      env_.reset();
+    }
+
+    // set the specified reset behaviours
+    env_.set_attack_reset_behaviour(static_cast<peaks::EnvResetBehaviour>(c.attack_reset_behaviour));
+    env_.set_attack_falling_gate_behaviour(static_cast<peaks::EnvFallingGateBehaviour>(c.attack_falling_gate_behaviour));
+    env_.set_decay_release_reset_behaviour(static_cast<peaks::EnvResetBehaviour>(c.decay_release_reset_behaviour));
+
+    // set the looping envelope maximum number of loops
+    env_.set_max_loops(c.max_loops);
+  }
+
   bool DelayedTriggers() {
     bool triggered = false;
 
@@ -686,6 +746,8 @@ void EnvelopeGenerator::Init(OC::DigitalInput default_trigger) {
   env_.Init();
   channel_index_ = default_trigger;
   last_type_ = ENV_TYPE_LAST;
+  memset(&config_, 0xff, sizeof(config_));
+  envelope_changed_ = false;
   gate_raised_ = false;
   euclidean_counter_ = 0;
   euclidean_reset_counter_ = 0;
@@ -776,6 +838,8 @@ public:
       env.Init(static_cast<OC::DigitalInput>(input));
       ++input;
     }
+    for (size_t i = 0; i < peaks::MultistageEnvelopeBank::kNumChannels; ++i)
+      envelope_bank_.Bind(i, envelopes_[i].envelope());
 
     ui.edit_mode = MODE_EDIT_SEGMENTS;
     ui.selected_channel = 0;
@@ -808,10 +872,20 @@ public:
         envelopes_[2].internal_trigger_mask() << 16 |
         envelopes_[3].internal_trigger_mask() << 24;
 
-    envelopes_[0].Update(triggers, internal_trigger_mask, cvs, DAC_CHANNEL_A);
-    envelopes_[1].Update(triggers, internal_trigger_mask, cvs, DAC_CHANNEL_B);
-    envelopes_[2].Update(triggers, internal_trigger_mask, cvs, DAC_CHANNEL_C);
-    envelopes_[3].Update(triggers, internal_trigger_mask, cvs, DAC_CHANNEL_D);
+    uint8_t gate_state[4];
+    for (int i = 0; i < 4; ++i) {
+      gate_state[i] = envelopes_[i].Update(triggers, internal_trigger_mask, cvs);
+      if (envelopes_[i].envelope_changed())
+        envelope_bank_.Configure(i);
+    }
+
+    uint16_t values[4];
+    envelope_bank_.Process(gate_state, values);
+
+    envelopes_[0].Output(values[0], DAC_CHANNEL_A);
+    envelopes_[1].Output(values[1], DAC_CHANNEL_B);
+    envelopes_[2].Output(values[2], DAC_CHANNEL_C);
+    envelopes_[3].Output(values[3], DAC_CHANNEL_D);
   }
 
   bool euclidean_edit_active() const {
@@ -846,6 +920,7 @@ public:
   }
 
   EnvelopeGenerator envelopes_[4];
+  peaks::MultistageEnvelopeBank envelope_bank_;
 
   SmoothedValue<int32_t, kCvSmoothing> cv1;
   SmoothedValue<int32_t, kCvSmoothing> cv2;
@@ -349,6 +349,7 @@ public:
                 applet_data[h] = hem_active_preset->GetData(HEM_SIDE(h));
                 SetApplet(HEM_SIDE(h), index);
                 HS::available_applets[index].instance[h]->OnDataReceive(applet_data[h]);
+                HS::available_applets[index].instance[h]->ViewChanged();
             }
 
 
@@ -605,6 +606,7 @@ public:
             // regular applets get button release
             int index = my_applet[h];
             HS::available_applets[index].instance[h]->OnButtonPress();
+            HS::available_applets[index].instance[h]->ViewChanged();
         }
     }
 
@@ -711,6 +713,7 @@ public:
           if (applet->EditMode()) {
             // select button becomes aux button while editing a param
             applet->AuxButton();
+            applet->ViewChanged();
           } else {
             // Select Mode
             if (hemisphere == select_mode) select_mode = -1; // Exit Select Mode if same button is pressed
@@ -749,6 +752,7 @@ public:
         } else {
             int index = my_applet[h];
             HS::available_applets[index].instance[h]->OnEncoderMove(event.value);
+            HS::available_applets[index].instance[h]->ViewChanged();
         }
     }
 
@@ -142,11 +142,18 @@ void LorenzGenerator::Init() {
   InitDefaults();
   lorenz.Init(0);
   lorenz.Init(1);
+  // Euler unless built with LORENZ_RK4; RK4 doesn't fit in the ISR alongside
+  // everything else on a Teensy 3.2, so that's T4 only
+#if defined(LORENZ_RK4) && defined(__IMXRT1062__)
+  lorenz.set_integrator(streams::LORENZ_INTEGRATOR_RK4);
+#else
+  lorenz.set_integrator(streams::LORENZ_INTEGRATOR_EULER);
+#endif
   frozen_= false;
 }
 
-const char* const lorenz_freq_range_names[5] = {
- "sloth",  "lazy",  "slow", "med", "fast",
+const char* const lorenz_freq_range_names[6] = {
+ "sloth",  "lazy",  "slow", "med", "fast", "warp",
 };
 
 // TOTAL EEPROM SIZE: 9 bytes
@@ -160,8 +167,8 @@ SETTINGS_DECLARE(LorenzGenerator, LORENZ_SETTING_LAST) {
   #endif
   { 63, 4, 127, "Rho/c 1", NULL, settings::STORAGE_TYPE_U8 },
   { 63, 4, 127, "Rho/c 2", NULL, settings::STORAGE_TYPE_U8 },
-  { 2, 0, 4, "LFreq 1 Rng", lorenz_freq_range_names, settings::STORAGE_TYPE_U4 },
-  { 2, 0, 4, "LFreq 2 Rng", lorenz_freq_range_names, settings::STORAGE_TYPE_U4 },
+  { 2, 0, streams::kMaxFreqRange, "LFreq 1 Rng", lorenz_freq_range_names, settings::STORAGE_TYPE_U4 },
+  { 2, 0, streams::kMaxFreqRange, "LFreq 2 Rng", lorenz_freq_range_names, settings::STORAGE_TYPE_U4 },
   {streams::LORENZ_OUTPUT_X1, streams::LORENZ_OUTPUT_X1, streams::LORENZ_OUTPUT_LAST - 1, "Out A ", lorenz_output_names, settings::STORAGE_TYPE_U8},
   {streams::LORENZ_OUTPUT_Y1, streams::LORENZ_OUTPUT_X1, streams::LORENZ_OUTPUT_LAST - 1, "Out B ", lorenz_output_names, settings::STORAGE_TYPE_U8},
   {streams::LORENZ_OUTPUT_X2, streams::LORENZ_OUTPUT_X1, streams::LORENZ_OUTPUT_LAST - 1, "Out C ", lorenz_output_names, settings::STORAGE_TYPE_U8},
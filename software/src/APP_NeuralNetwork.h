@@ -32,6 +32,7 @@
 #include "HSApplication.h"
 #include "HSMIDI.h"
 #include "neuralnet/LogicGate.h"
+#include "util/util_profiling.h"
 
 // 9 sets of 24 bytes allocated for storage
 #define NN_SETTING_LAST 216
@@ -41,6 +42,7 @@ class NeuralNetwork : public HSApplication, public SystemExclusiveHandler,
 public:
     void Start() {
         for (int ch = 0; ch < 16; ch++) output_neuron[ch] = ch % 4;
+        for (int s = 0; s < 4; s++) Compile(s);
     }
     
     void Resume() {
@@ -49,36 +51,33 @@ public:
 
     void Controller() {
         ListenForSysEx();
-        uint16_t tmp_source_state = source_state; // Set temporary state for this cycle
 
         // Check inputs
+        uint8_t inputs = 0;
         for (byte i = 0; i < 8; i++)
         {
             bool set = (i < 4) ? Gate(i) : (In(i - 4) > HSAPPLICATION_3V);
-            tmp_source_state = SetSource(tmp_source_state, i, set);
+            inputs |= set << i;
             input_state[i] = set; // For display
         }
         
         // Process neurons
-        for (byte n = 0; n < 6; n++)
-        {
-            byte ix = (setup * 6) + n;
-            bool set = neuron[ix].Calculate(tmp_source_state);
-            tmp_source_state = SetSource(tmp_source_state, 8 + n, set);
-        }
+        debug::CycleMeasurement cycles;
+        netlist[setup].Tick(inputs);
+        eval_cycles.push(cycles.read());
         
         // Set outputs based on assigned neuron's last state
         for (byte o = 0; o < 4; o++)
         {
             byte ix = (setup * 4) + o;
-            byte n = output_neuron[ix] + (setup * 6);
-            bool set = neuron[n].state;
+            bool set = netlist[setup].gate(output_neuron[ix]);
             Out(o, set * HSAPPLICATION_5V);
         }
-
-        source_state = tmp_source_state;
     }
 
+    const debug::AveragedCycles &evaluation_cycles() const { return eval_cycles; }
+    int evaluated_neurons() const { return netlist[setup].ops(); }
+
     void View() {
         if (copy_mode) DrawCopyScreen();
         else DrawInterface();
@@ -139,9 +138,8 @@ public:
                 neuron[ni].weight2 = static_cast<int>(V[ix++] - 128);
                 neuron[ni].weight3 = static_cast<int>(V[ix++] - 128);
                 neuron[ni].threshold = static_cast<int>(V[ix++] - 128);
-                neuron[ni].state = 0;
-                neuron[ni].source_state = 0;
             }
+            Compile(setup, 0x3f);
 
             // Decode output assignments
             byte o = (setup * 4);
@@ -166,6 +164,7 @@ public:
             for (byte o = 0; o < 4; o++)
                 output_neuron[(target * 4) + 0] = output_neuron[(source * 4) + o];
 
+            Compile(target);
             setup = target;
         }
         copy_mode = 0;
@@ -230,6 +229,7 @@ public:
         if (selected < 6) {
             byte ix = (setup * 6) + selected;
             neuron[ix].UpdateValue(cursor, direction);
+            Compile(setup, cursor == 0 ? (1u << selected) : 0); // a new type starts from 0
         } else {
             byte ix = (setup * 4) + cursor;
             output_neuron[ix] = constrain(output_neuron[ix] + direction, 0, 5);
@@ -250,13 +250,33 @@ private:
     int output_neuron[16]; // Four sets of four output assignments
     bool input_state[8];
     
-    // Source state is passed to each neuron for use in its logic gate calculation.
-    // The value is a bitfield, with each bit indicating the value of a source's most-
-    // recent result:
+    // Each setup compiled to run, and holding the state of its neurons. The state is a
+    // bitfield, with each bit indicating the value of a source's most-recent result:
     //     Bits 0-3: Digital inputs
     //     Bits 4-7: CV inputs
     //     Bits 8-13: Neuron outputs
-    uint16_t source_state = 0;
+    typedef HS::LogicNetlist<6> Netlist;
+    Netlist netlist[4];
+    debug::AveragedCycles eval_cycles;
+
+    /* Rebuild a setup's netlist after an edit. Neurons in clear (a bit per neuron) reset. */
+    void Compile(int setup_, uint32_t clear = 0) {
+        HS::LogicGateSpec spec[6];
+        for (byte n = 0; n < 6; n++) spec[n] = neuron[(setup_ * 6) + n].Spec<6>();
+        netlist[setup_].Compile(spec, clear);
+    }
+
+    bool NeuronState(byte ix) {
+        return netlist[ix / 6].gate(ix % 6);
+    }
+
+    /* The value at one of a neuron's inputs */
+    bool SourceValue(byte ix, byte d) {
+        int source = neuron[ix].Source(d);
+        if (source == 14) return 1;
+        if (source == 15) return 0;
+        return netlist[ix / 6].bit(source);
+    }
 
     void DrawInterface() {
         gfxHeader("Neural Net");
@@ -405,13 +425,6 @@ private:
             setup = setup_;
     }
     
-    uint16_t SetSource(uint16_t source_state, byte b, bool v)
-    {
-        if (v) source_state |= (0x01 << b);
-        else source_state &= ~(0x01 << b);
-        return source_state;
-    }
-    
     /* The system settings are just bytes. Move them into the instance variables here */
     void LoadFromEEPROMStage() {
         byte ix = 0;
@@ -433,7 +446,7 @@ private:
             if (neuron[n].threshold == -128) neuron[n].threshold = 0;
         }
         for (byte o = 0; o < 16; o++) output_neuron[o] = values_[ix++];
-            
+        for (byte s = 0; s < 4; s++) Compile(s);
     }
     
     void SaveToEEPROMStage() {
@@ -468,7 +481,7 @@ private:
             gfxCircle(73 + indent, 22 + (16 * d), 8); // Dendrite
             gfxPrint((weight < 0 ? 66 : 72) + indent , 19 + (16 * d), weight);
             if (cursor == (d + 4) && CursorBlink()) gfxCircle(73 + indent, 22 + (16 * d), 7);
-            gfxDottedLine(81 + indent, 22 + (16 * d), 100, 38, neuron[ix].SourceValue(d) ? 1 : 3); // Synapse
+            gfxDottedLine(81 + indent, 22 + (16 * d), 100, 38, SourceValue(ix, d) ? 1 : 3); // Synapse
         }
 
         // Draw Axon
@@ -480,7 +493,7 @@ private:
         if (cursor == 7 && CursorBlink()) gfxCircle(112, 38, 11);
         
         int r = 0;
-        if (neuron[ix].state) {
+        if (NeuronState(ix)) {
         		if (random(1, 100) > 60) r = random(0, 3) - 1;
         }
         gfxCircle(112, 38, 12 + (r * 2));
@@ -497,10 +510,10 @@ private:
 
     void DrawInputs(byte ix) {
         if (neuron[ix].type == LogicGateType::NOT) {
-            gfxDottedLine(64, 36, 76, 36, neuron[ix].SourceValue(0) ? 1 : 3);
+            gfxDottedLine(64, 36, 76, 36, SourceValue(ix, 0) ? 1 : 3);
         } else {
-            gfxDottedLine(64, 28, 76, 28, neuron[ix].SourceValue(0) ? 1 : 3);
-            gfxDottedLine(64, 44, 76, 44, neuron[ix].SourceValue(1) ? 1 : 3);
+            gfxDottedLine(64, 28, 76, 28, SourceValue(ix, 0) ? 1 : 3);
+            gfxDottedLine(64, 44, 76, 44, SourceValue(ix, 1) ? 1 : 3);
         }
     }
 
@@ -571,17 +584,17 @@ private:
         ) {
             gfxCircle(112, 36, 4);
         } else {
-            gfxDottedLine(108, 36, 117, 36, neuron[ix].state ? 1 : 3);
+            gfxDottedLine(108, 36, 117, 36, NeuronState(ix) ? 1 : 3);
         }
     }
 
     void DrawOutput(byte ix) {
 		int y = 0;
-    		if (neuron[ix].state) {
+    		if (NeuronState(ix)) {
     			// Shimmer
     			if (random(1, 100) > 60) y = random(0, 3) - 1;
     		}
-        gfxDottedLine(116, 36 + (y * 2), 127, 36 + (y * 2), neuron[ix].state ? 1 : 3);
+        gfxDottedLine(116, 36 + (y * 2), 127, 36 + (y * 2), NeuronState(ix) ? 1 : 3);
     }
 };
 
@@ -627,6 +640,15 @@ void NeuralNetwork_handleAppEvent(OC::AppEvent event) {
 
 void NeuralNetwork_loop() {} // Deprecated
 
+// Cost of evaluating the current setup's netlist, per core tick
+void NeuralNetwork_debug() {
+    const debug::AveragedCycles &cycles = NeuralNetwork_instance.evaluation_cycles();
+    graphics.setPrintPos(2, 12);
+    graphics.printf("%d neurons", NeuralNetwork_instance.evaluated_neurons());
+    graphics.setPrintPos(2, 22);
+    graphics.printf("%lu/%lu/%lu cycles", cycles.min_value(), cycles.value(), cycles.max_value());
+}
+
 void NeuralNetwork_menu() {
     NeuralNetwork_instance.BaseView();
 }
@@ -189,9 +189,29 @@ public:
     freq_mult_ = freq_mult;
   }
 
+  // The LFO renders kBlockSize ticks at a time into a small output FIFO, and
+  // each ISR consumes one tick. Reset and sync triggers start a new block
+  // right away so they aren't delayed.
+  static constexpr size_t kBlockSize = 8;
+
+  void Render(int32_t freq, bool reset_phase, bool tempo_sync, uint8_t freq_mult) {
+    if (reset_phase || tempo_sync || block_pos_ >= kBlockSize) {
+      uint16_t *const out[frames::kNumChannels] = { block_[0], block_[1], block_[2], block_[3] };
+      lfo.RenderBlock(freq, reset_phase, tempo_sync, freq_mult, out, kBlockSize);
+      block_pos_ = 0;
+    }
+    ++block_pos_;
+  }
+
+  uint16_t dac_code(uint8_t channel) const {
+    return block_[channel][block_pos_ - 1];
+  }
+
   frames::PolyLfo lfo;
   bool frozen_;
   uint8_t freq_mult_;
+  uint16_t block_[frames::kNumChannels][kBlockSize];
+  size_t block_pos_;
 
   // ISR update is at 16.666kHz, we don't need it that fast so smooth the values to ~1Khz
   static constexpr int32_t kSmoothing = 16;
@@ -205,6 +225,8 @@ public:
 void PolyLfo::Init() {
   InitDefaults();
   lfo.Init();
+  memset(block_, 0, sizeof(block_));
+  block_pos_ = kBlockSize;
   frozen_= false;
   freq_mult_ = 0x3; // == x2 / default
 }
@@ -371,12 +393,12 @@ void FASTRUN POLYLFO_isr() {
   poly_lfo.set_freq_mult(freq_mult);
 
   if (!freeze && !poly_lfo.frozen())
-    poly_lfo.lfo.Render(freq, reset_phase, tempo_sync, freq_mult);
+    poly_lfo.Render(freq, reset_phase, tempo_sync, freq_mult);
 
-  OC::DAC::set<DAC_CHANNEL_A>(poly_lfo.lfo.dac_code(0));
-  OC::DAC::set<DAC_CHANNEL_B>(poly_lfo.lfo.dac_code(1));
-  OC::DAC::set<DAC_CHANNEL_C>(poly_lfo.lfo.dac_code(2));
-  OC::DAC::set<DAC_CHANNEL_D>(poly_lfo.lfo.dac_code(3));
+  OC::DAC::set<DAC_CHANNEL_A>(poly_lfo.dac_code(0));
+  OC::DAC::set<DAC_CHANNEL_B>(poly_lfo.dac_code(1));
+  OC::DAC::set<DAC_CHANNEL_C>(poly_lfo.dac_code(2));
+  OC::DAC::set<DAC_CHANNEL_D>(poly_lfo.dac_code(3));
 }
 
 void POLYLFO_init() {
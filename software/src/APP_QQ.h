@@ -107,6 +107,9 @@ enum ChannelSetting {
   CHANNEL_SETTING_INT_SEQ_RANGE_CV_SOURCE,
   CHANNEL_SETTING_INT_SEQ_STRIDE_CV_SOURCE,
   CHANNEL_SETTING_INT_SEQ_RESET_TRIGGER,
+#ifdef BYTEBEAT_USER_FORMULAS
+  CHANNEL_SETTING_BYTEBEAT_USER_FORMULA,
+#endif
   CHANNEL_SETTING_LAST
 };
 
@@ -276,6 +279,12 @@ public:
     return values_[CHANNEL_SETTING_BYTEBEAT_EQUATION];
   }
 
+#ifdef BYTEBEAT_USER_FORMULAS
+  uint8_t get_bytebeat_user_formula() const {
+    return values_[CHANNEL_SETTING_BYTEBEAT_USER_FORMULA];
+  }
+#endif
+
   uint8_t get_bytebeat_range() const {
     return values_[CHANNEL_SETTING_BYTEBEAT_RANGE];
   }
@@ -529,6 +538,11 @@ public:
               bytebeat_eqn = USAT16(bytebeat_eqn);
             }
             bytebeat_.set_equation(bytebeat_eqn);
+#ifdef BYTEBEAT_USER_FORMULAS
+            // Formulas are edited in Viznutcracker
+            const uint8_t user_formula = get_bytebeat_user_formula();
+            bytebeat_.set_program(user_formula ? &peaks::bytebeat_user_formulas[user_formula - 1].program() : nullptr);
+#endif
 
             int32_t bytebeat_p0 = get_bytebeat_p0() << 8;
             if (get_bytebeat_p0_cv_source()) {
@@ -980,6 +994,9 @@ public:
       break;
       case CHANNEL_SOURCE_BYTEBEAT:
         *settings++ = CHANNEL_SETTING_BYTEBEAT_EQUATION;
+#ifdef BYTEBEAT_USER_FORMULAS
+        *settings++ = CHANNEL_SETTING_BYTEBEAT_USER_FORMULA;
+#endif
         *settings++ = CHANNEL_SETTING_BYTEBEAT_RANGE;
         *settings++ = CHANNEL_SETTING_BYTEBEAT_P0;
         *settings++ = CHANNEL_SETTING_BYTEBEAT_P1;
@@ -1036,6 +1053,9 @@ public:
       case CHANNEL_SETTING_LOGISTIC_MAP_R_CV_SOURCE:
       case CHANNEL_SETTING_LOGISTIC_MAP_RANGE_CV_SOURCE:
       case CHANNEL_SETTING_BYTEBEAT_EQUATION:
+#ifdef BYTEBEAT_USER_FORMULAS
+      case CHANNEL_SETTING_BYTEBEAT_USER_FORMULA:
+#endif
       case CHANNEL_SETTING_BYTEBEAT_RANGE:
       case CHANNEL_SETTING_BYTEBEAT_P0:
       case CHANNEL_SETTING_BYTEBEAT_P1:
@@ -1175,7 +1195,10 @@ SETTINGS_DECLARE(QuantizerChannel, CHANNEL_SETTING_LAST) {
   { 0, 0, 4, "IntSeq mod CV", OC::Strings::cv_input_names_none, settings::STORAGE_TYPE_U4 },
   { 0, 0, 4, "IntSeq rng CV", OC::Strings::cv_input_names_none, settings::STORAGE_TYPE_U4 },
   { 0, 0, 4, "F. stride CV >", OC::Strings::cv_input_names_none, settings::STORAGE_TYPE_U4 },
-  { 0, 0, 4, "IntSeq reset", OC::Strings::trigger_input_names_none, settings::STORAGE_TYPE_U4 }
+  { 0, 0, 4, "IntSeq reset", OC::Strings::trigger_input_names_none, settings::STORAGE_TYPE_U4 },
+#ifdef BYTEBEAT_USER_FORMULAS
+  { 0, 0, peaks::kNumUserFormulas, "Bytebeat usr", peaks::bytebeat_user_formula_names, settings::STORAGE_TYPE_U4 },
+#endif
 };
 
 // WIP refactoring to better encapsulate and for possible app interface change
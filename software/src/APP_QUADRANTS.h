@@ -324,6 +324,7 @@ public:
                 applet_data[h] = quad_active_preset->GetData(HEM_SIDE(h));
                 SetApplet(HEM_SIDE(h), index);
                 HS::available_applets[index].instance[h]->OnDataReceive(applet_data[h]);
+                HS::available_applets[index].instance[h]->ViewChanged();
             }
         }
         preset_id = id;
@@ -535,6 +536,7 @@ public:
         }
 
         active_applet[slot]->OnButtonPress();
+        active_applet[slot]->ViewChanged();
     }
 
     const HEM_SIDE ButtonToSlot(const UI::Event &event) {
@@ -593,6 +595,7 @@ public:
         // A/B/X/Y buttons becomes aux button while editing a param
         if (SlotIsVisible(slot) && active_applet[slot]->EditMode()) {
           active_applet[slot]->AuxButton();
+          active_applet[slot]->ViewChanged();
           return true;
         }
 
@@ -627,6 +630,7 @@ public:
             ChangeApplet(slot, event.value);
         } else {
             active_applet[slot]->OnEncoderMove(event.value);
+            active_applet[slot]->ViewChanged();
         }
     }
 
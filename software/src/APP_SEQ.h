@@ -35,6 +35,7 @@
 #include "OC_input_map.h"
 #include "OC_input_maps.h"
 #include "braids_quantizer.h"
+#include "HSPitchMemo.h"
 #include "braids_quantizer_scales.h"
 #include "extern/dspinst.h"
 #include "util/util_arp.h"
@@ -780,6 +781,7 @@ public:
     apply_value(SEQ_CHANNEL_SETTING_CLOCK, trigger_source);
     quantizer_.Init();
     quantizer_.Requantize();
+    step_memo_.Invalidate();
     input_map_.Init();
     env_.Init();
     force_update_ = true;
@@ -834,12 +836,30 @@ public:
       last_scale_ = scale;
       last_scale_mask_ = scale_mask;
       quantizer_.Configure(OC::Scales::GetScale(scale), scale_mask);
+      step_memo_.Invalidate();
       return true;
     } else {
       return false;
     }
   }
 
+  // Step pitches are notes from the pattern, not noisy CV, so each one quantizes on its own
+  // rather than with hysteresis from the one before. That makes it a lookup the next time.
+  int32_t quantize_step(int32_t pitch, int8_t root, int8_t transpose) {
+    const HS::PitchMemo<1, 32>::Key key = { pitch, root, transpose, 0 };
+    bool hit;
+    int32_t *quantized = step_memo_.Get(key, hit);
+    if (!hit) {
+      quantizer_.Requantize();
+      *quantized = quantizer_.Process(pitch, root << 7, transpose);
+    }
+    return *quantized;
+  }
+
+  const HS::PitchMemo<1, 32> &step_memo() const {
+    return step_memo_;
+  }
+
   bool update_scale(bool force) {
 
     const int scale = get_scale(DUMMY);
@@ -851,6 +871,7 @@ public:
       last_scale_ = scale;
       last_scale_mask_ = scale_mask;
       quantizer_.Configure(OC::Scales::GetScale(scale), scale_mask);
+      step_memo_.Invalidate();
       return true;
     } else {
       return false;
@@ -1111,7 +1132,7 @@ public:
                 gate_state_ = step_state_ = OFF;
             }
             // update output:
-            step_pitch_ = quantizer_.Process(step_pitch_, _root << 7, _transpose);
+            step_pitch_ = quantize_step(step_pitch_, _root, _transpose);
 
             int32_t _attack = get_attack_duration();
             int32_t _decay = get_decay_duration();
@@ -1937,6 +1958,7 @@ private:
   int num_enabled_settings_;
   SEQ_ChannelSetting enabled_settings_[SEQ_CHANNEL_SETTING_LAST];
   braids::Quantizer quantizer_;
+  HS::PitchMemo<1, 32> step_memo_; // quantized step pitches, which come round again and again
   OC::Input_Map input_map_;
   OC::DigitalInputDisplay clock_display_;
   peaks::MultistageEnvelope env_;
@@ -2126,6 +2148,16 @@ void SEQ_handleAppEvent(OC::AppEvent event) {
 void SEQ_loop() {
 }
 
+void SEQ_debug() {
+  for (int i = 0; i < NUM_CHANNELS; ++i) {
+    const HS::PitchMemo<1, 32> &memo = seq_channel[i].step_memo();
+    graphics.setPrintPos(2, 12 + i * 20);
+    graphics.printf("#%d %lu hit %lu miss", i + 1, memo.hits(), memo.misses());
+    graphics.setPrintPos(2, 22 + i * 20);
+    graphics.printf("   %d%% hit rate", memo.hit_rate());
+  }
+}
+
 void SEQ_isr() {
 
   ticks_src1++; // src #1 ticks
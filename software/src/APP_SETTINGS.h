@@ -158,6 +158,10 @@ public:
           SERIAL_PRINTLN("timeout=%d", calibration_state.encoder_value);
           break;
 
+        case CALIBRATE_FRAME_RATE:
+          calibration_state.encoder_value = OC::calibration_data.frame_rate;
+          break;
+
         case CALIBRATE_NONE:
         default:
           if (CALIBRATION_EXIT != next_step->step) {
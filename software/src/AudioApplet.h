@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////////////////
+//// Audio Applet Base Class
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * The audio-rate counterpart to HemisphereApplet, for T4.1. An audio applet
+ * fills one block at a time from ProcessBlock(), which is called from the
+ * Teensy Audio update interrupt by an AudioAppletSlot (see AudioSetup.cpp).
+ *
+ * CV arrives once per block, as a snapshot of HS::frame: the ADC inputs and
+ * then the DAC outputs, in the same order as OC::AudioDSP::mod_map.
+ */
+
+#pragma once
+#ifndef _AUDIO_APPLET_H_
+#define _AUDIO_APPLET_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class AudioApplet {
+public:
+    static constexpr int MAX_CV_CHANNELS = 16; // ADC_CHANNEL_LAST + DAC_CHANNEL_LAST on T4.1
+    static constexpr int CV_FULL_SCALE = 9216; // 6V, as OC::AudioDSP::MAX_CV
+
+    virtual const char* applet_name() = 0; // Maximum of 5 characters
+    virtual void Start() { }
+
+    /* Runs in the audio interrupt, so keep it short and don't touch the display.
+     * in and out are n samples each, and never the same buffer. */
+    virtual void ProcessBlock(const int16_t *in, int16_t *out, size_t n) = 0;
+
+    /* Latch the CV for the next block. mod_source indexes values, or is -1 for none. */
+    void SetCV(const int *values, int count, int mod_source) {
+        if (count > MAX_CV_CHANNELS) count = MAX_CV_CHANNELS;
+        memcpy(cv_, values, count * sizeof(cv_[0]));
+        mod_cv_ = (mod_source >= 0 && mod_source < count) ? values[mod_source] : 0;
+    }
+
+protected:
+    int CV(int n) const { return cv_[n]; }
+    int ModCV() const { return mod_cv_; } // the CV mapped to this applet's slot
+
+    // ModCV() from 0 to 6V as Q15
+    int32_t ModQ15() const {
+        int32_t cv = mod_cv_;
+        if (cv < 0) cv = 0;
+        if (cv > CV_FULL_SCALE) cv = CV_FULL_SCALE;
+        return cv * 32767 / CV_FULL_SCALE;
+    }
+
+private:
+    int cv_[MAX_CV_CHANNELS] = {0};
+    int mod_cv_ = 0;
+};
+
+#endif // _AUDIO_APPLET_H_
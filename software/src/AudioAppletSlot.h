@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Audio.h>
+#include "AudioApplet.h"
+
+// Runs an AudioApplet in the audio update. Each slot is its own AudioStream,
+// so processorUsage() and processorUsageMax() meter the applet on its own.
+// With no input connected or no input block, the applet gets silence.
+class AudioAppletSlot : public AudioStream {
+public:
+  AudioAppletSlot() : AudioStream(1, inputQueueArray) { }
+
+  void begin(AudioApplet *applet) {
+    AudioNoInterrupts();
+    applet_ = applet;
+    if (applet_) applet_->Start();
+    AudioInterrupts();
+    processorUsageMaxReset();
+  }
+
+  AudioApplet *applet() const {
+    return applet_;
+  }
+
+  // From the controller, every tick; update() hands the latest to the applet.
+  // A block may see a mix of this tick's and the last one's values, which is fine for CV.
+  void SetCV(const int *values, int count, int mod_source) {
+    if (count > AudioApplet::MAX_CV_CHANNELS) count = AudioApplet::MAX_CV_CHANNELS;
+    for (int i = 0; i < count; ++i) cv_[i] = values[i];
+    cv_count_ = count;
+    mod_source_ = mod_source;
+  }
+
+  virtual void update(void) {
+    audio_block_t *in = receiveReadOnly(0);
+    if (!applet_) {
+      if (in) release(in);
+      return;
+    }
+    audio_block_t *out = allocate();
+    if (out) {
+      static const int16_t silence[AUDIO_BLOCK_SAMPLES] = {0};
+      applet_->SetCV(const_cast<const int *>(cv_), cv_count_, mod_source_);
+      applet_->ProcessBlock(in ? in->data : silence, out->data, AUDIO_BLOCK_SAMPLES);
+      transmit(out);
+      release(out);
+    }
+    if (in) release(in);
+  }
+
+private:
+  audio_block_t *inputQueueArray[1];
+  AudioApplet *volatile applet_ = nullptr;
+  volatile int cv_[AudioApplet::MAX_CV_CHANNELS] = {0};
+  volatile int cv_count_ = 0;
+  volatile int mod_source_ = -1;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <Audio.h>
+#include "HSCombReverb.h"
+
+// Mono in, wet reverb out, running an HS::CombReverb. The reverb holds its
+// own delay memory, so it's passed in from somewhere in DMAMEM rather than
+// living in this object. The tail keeps ringing after the input stops, so
+// it has to be disabled to stop costing anything.
+class AudioEffectCombReverb : public AudioStream {
+public:
+  AudioEffectCombReverb() : AudioStream(1, inputQueueArray) { }
+
+  void begin(HS::CombReverb *reverb, int spread = 0) {
+    reverb->Init(spread);
+    reverb_ = reverb;
+  }
+
+  void enable(bool on) {
+    enabled_ = on;
+  }
+
+  // 0.0 to 1.0, like AudioEffectFreeverb
+  void roomsize(float n) {
+    size_ = ToQ15(n);
+  }
+
+  void damping(float n) {
+    damping_ = ToQ15(n);
+  }
+
+  virtual void update(void) {
+    audio_block_t *block = receiveWritable(0);
+    if (!enabled_ || !reverb_) {
+      if (block) release(block);
+      return;
+    }
+    if (!block) {
+      block = allocate();
+      if (!block) return;
+      memset(block->data, 0, sizeof(block->data));
+    }
+    reverb_->set_size(size_);
+    reverb_->set_damping(damping_);
+    reverb_->Process(block->data, block->data, AUDIO_BLOCK_SAMPLES);
+    transmit(block);
+    release(block);
+  }
+
+private:
+  static int32_t ToQ15(float n) {
+    if (n < 0.0f) n = 0.0f;
+    else if (n > 1.0f) n = 1.0f;
+    return static_cast<int32_t>(n * 32767.0f);
+  }
+
+  audio_block_t *inputQueueArray[1];
+  HS::CombReverb *reverb_ = nullptr;
+  volatile bool enabled_ = true;
+  volatile int32_t size_ = 16384;
+  volatile int32_t damping_ = 16384;
+};
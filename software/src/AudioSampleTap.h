@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Audio.h>
+
+// Keeps the latest few thousand samples of its input, for analysis outside the
+// audio ISR (the Tuner's pitch detector). update() only copies a block into a
+// ring; Latest() copies out of it from the UI side without stopping the audio,
+// and checks afterwards that the ISR didn't write over what it read.
+class AudioSampleTap : public AudioStream {
+public:
+  static constexpr size_t SIZE = 4096; // samples, a power of 2
+
+  AudioSampleTap() : AudioStream(1, inputQueueArray) { }
+
+  virtual void update(void) {
+    audio_block_t *block = receiveReadOnly(0);
+    if (!block) return;
+    const size_t head = written_ & (SIZE - 1);
+    memcpy(ring_ + head, block->data, sizeof(block->data)); // SIZE is a multiple of the block
+    written_ = written_ + AUDIO_BLOCK_SAMPLES;
+    release(block);
+  }
+
+  // The newest n samples, oldest first, averaged in pairs when decimate is set.
+  // False if there aren't that many yet, or they were overwritten while copying.
+  bool Latest(int16_t *dst, size_t n, bool decimate = false) {
+    const size_t span = decimate ? n * 2 : n;
+    const uint32_t end = written_;
+    if (span > SIZE - AUDIO_BLOCK_SAMPLES || end < span) return false;
+
+    size_t i = end - span;
+    for (size_t k = 0; k < n; ++k) {
+      if (decimate) {
+        const int32_t a = ring_[i++ & (SIZE - 1)];
+        const int32_t b = ring_[i++ & (SIZE - 1)];
+        dst[k] = int16_t((a + b) >> 1);
+      } else {
+        dst[k] = ring_[i++ & (SIZE - 1)];
+      }
+    }
+    // The ring has a block of slack, so one update during the copy is fine
+    return written_ - end <= AUDIO_BLOCK_SAMPLES;
+  }
+
+  void clear() {
+    written_ = 0;
+  }
+
+private:
+  audio_block_t *inputQueueArray[1];
+  int16_t ring_[SIZE];
+  volatile uint32_t written_ = 0; // samples, ever
+};
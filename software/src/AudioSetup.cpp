@@ -1,6 +1,12 @@
 #if defined(__IMXRT1062__) && defined(ARDUINO_TEENSY41)
 
 #include "AudioSetup.h"
+#include "AudioVectorOsc.h"
+#include "AudioCombReverb.h"
+#include "AudioAppletSlot.h"
+#include "AudioSampleTap.h"
+#include "audio_applets/AudioVCA.h"
+#include "audio_applets/AudioBitCrush.h"
 #include "OC_ADC.h"
 #include "OC_DAC.h"
 #include "HSUtils.h"
@@ -8,56 +14,47 @@
 #include "OC_strings.h"
 
 // Use the web GUI tool as a guide: https://www.pjrc.com/teensy/gui/
-
-// GUItool: begin automatically generated code
-AudioInputI2S2           i2s1;           //xy=67,259
-AudioAmplifier           amp2;           //xy=249,406
-AudioAmplifier           amp1;           //xy=252,143
-AudioFilterStateVariable svfilter1;      //xy=424,341
-AudioFilterLadder        ladder1;        //xy=444,63
-AudioSynthWaveformDc     dc1;            //xy=612,200
-AudioMixer4              mixer2;         //xy=615,370
-AudioMixer4              mixer1;         //xy=617,120
-AudioSynthWaveformDc     dc2;            //xy=631,498
-AudioEffectWaveFolder    wavefolder2;    //xy=859.8889083862305,425.22222232818604
-AudioEffectWaveFolder    wavefolder1;    //xy=874.7777633666992,155.22220993041992
-AudioMixer4              mixer4;         //xy=1130.2223625183105,375.33338928222656
-AudioMixer4              mixer3;         //xy=1132.3332710266113,80.22221755981445
-//AudioEffectFreeverb      freeverb2;      //xy=1132.5553283691406,255.11116409301758
-//AudioEffectFreeverb      freeverb1;      //xy=1135.6664810180664,188.5555362701416
-AudioOutputI2S2          i2s2;           //xy=1434.77783203125,232.5555591583252
-
-AudioConnection          patchCord1(i2s1, 0, amp1, 0);
-AudioConnection          patchCord2(i2s1, 1, amp2, 0);
-AudioConnection          patchCord3(amp2, 0, svfilter1, 0);
-AudioConnection          patchCord4(amp2, 0, mixer2, 3);
-AudioConnection          patchCord5(amp1, 0, ladder1, 0);
-AudioConnection          patchCord6(amp1, 0, mixer1, 3);
-AudioConnection          patchCord7(svfilter1, 0, mixer2, 0);
-AudioConnection          patchCord8(svfilter1, 1, mixer2, 1);
-AudioConnection          patchCord9(svfilter1, 2, mixer2, 2);
-AudioConnection          patchCord10(ladder1, 0, mixer1, 0);
-AudioConnection          patchCord11(dc1, 0, wavefolder1, 1);
-AudioConnection          patchCord12(mixer2, 0, wavefolder2, 0);
-AudioConnection          patchCord13(mixer2, 0, mixer4, 0);
-AudioConnection          patchCord14(mixer1, 0, wavefolder1, 0);
-AudioConnection          patchCord15(mixer1, 0, mixer3, 0);
-AudioConnection          patchCord16(dc2, 0, wavefolder2, 1);
-AudioConnection          patchCord17(wavefolder2, 0, mixer4, 3);
-AudioConnection          patchCord18(wavefolder1, 0, mixer3, 3);
-AudioConnection          patchCord19(mixer4, 0, i2s2, 1);
-AudioConnection          patchCord21(mixer3, 0, i2s2, 0);
-//AudioConnection          patchCord20(mixer4, freeverb2);
-//AudioConnection          patchCord22(mixer3, freeverb1);
-//AudioConnection          patchCord23(freeverb2, 0, mixer4, 1);
-//AudioConnection          patchCord24(freeverb2, 0, mixer3, 2);
-//AudioConnection          patchCord25(freeverb1, 0, mixer3, 1);
-//AudioConnection          patchCord26(freeverb1, 0, mixer4, 2);
-// GUItool: end automatically generated code
+// The objects are laid out as it would, but the patch cords are made by
+// Patch() below, for the mode of each channel. Objects left unconnected
+// aren't updated, so a channel only costs what its mode uses.
+// Order matters: objects are updated in the order they are declared here.
+
+AudioInputI2S2           i2s1;
+AudioSynthVectorOsc      vosc1;
+AudioSynthVectorOsc      vosc2;
+AudioAppletSlot          applet1;
+AudioAppletSlot          applet2;
+AudioAmplifier           amp1;
+AudioAmplifier           amp2;
+AudioFilterLadder        ladder1;
+AudioFilterStateVariable svfilter1;
+AudioMixer4              mixer2;
+AudioSynthWaveformDc     dc1;
+AudioSynthWaveformDc     dc2;
+AudioEffectWaveFolder    wavefolder1;
+AudioEffectWaveFolder    wavefolder2;
+AudioMixer4              mixer3;
+AudioMixer4              mixer4;
+AudioEffectCombReverb    reverb1;
+AudioEffectCombReverb    reverb2;
+AudioOutputI2S2          i2s2;
+
+const int CHANNEL_CORDS = 10;
+AudioConnection          channel_cords[2][CHANNEL_CORDS];
+AudioConnection          reverb_cross_cords[2];
 
 // Notes:
 //
-// amp1 and amp2 are beginning of chain, for pre-filter attenuation
+// Per channel, depending on mode:
+// Off  - I2S input straight to the output
+// VCA  - I2S input -> amp -> output, with amp as the VCA
+// LPG, VCF - I2S input -> amp -> filter -> mixer3/4 -> output
+// FOLD - I2S input -> amp -> wavefolder and dry -> mixer3/4 -> output
+// VOsc - vector oscillator -> amp -> mixer3/4 -> output
+// Aplt - I2S input -> audio applet -> mixer3/4 -> output
+//
+// amp1 and amp2 are for pre-filter attenuation, except as the VCA
+// mixer2 selects the state variable filter output: 0 - LPF, 1 - BPF, 2 - HPF
 // dc1 and dc2 are control signals for modulating the wavefold amount.
 //
 // The reverbs are fed from the final outputs and looped back into BOTH mixers...
@@ -71,15 +68,15 @@ AudioConnection          patchCord21(mixer3, 0, i2s2, 0);
 // VCA modulation could control all of them.
 //
 
-// this could be used for the Tuner or other pitch-tracking tricks
-//AudioAnalyzeNoteFrequency notefreq1;
-//AudioConnection          patchCord8(i2s1, 1, notefreq1, 0);
+// For the Tuner, or other pitch-tracking tricks. Patched by TunerListen().
+AudioSampleTap           tuner_tap;
+AudioConnection          tuner_cord;
 
 namespace OC {
   namespace AudioDSP {
 
     const char * const mode_names[] = {
-      "Off", "VCA", "LPG", "VCF", "FOLD",
+      "Off", "VCA", "LPG", "VCF", "FOLD", "VOsc", "Aplt",
     };
 
     /* Mod Targets:
@@ -90,18 +87,48 @@ namespace OC {
       REVERB_LEVEL,
       REVERB_SIZE,
       REVERB_DAMP,
+      OSC_PITCH,
+      APPLET_CV,
      */
     ChannelMode mode[2] = { PASSTHRU, PASSTHRU };
     int mod_map[2][TARGET_COUNT] = {
-      { 8, 8, -1, 8, -1, -1, -1 },
-      { 10, 10, -1, 10, -1, -1, -1 },
+      { 8, 8, -1, 8, -1, -1, -1, 9, 8 },
+      { 10, 10, -1, 10, -1, -1, -1, 11, 10 },
     };
     float bias[2][TARGET_COUNT];
     uint8_t audio_cursor[2] = { 0, 0 };
+    uint8_t osc_waveform[2] = { 0, 0 };
+    uint8_t applet_index[2] = { 0, 0 };
 
     float amplevel[2] = { 1.0, 1.0 };
     float foldamt[2] = { 0.0, 0.0 };
 
+    // Vector oscillators. The builder is shared, so the channels take turns
+    // regenerating; each table keeps playing its old contents meanwhile.
+    const float OSC_BASE_FREQ = 261.63; // C4 at 0V
+    DMAMEM HS::VectorWavetable osc_tables[2];
+    DMAMEM HS::VectorWavetableBuilder osc_builder;
+    HS::WavetableSegment osc_segments[2][HS::WAVETABLE_MAX_SEGMENTS]; // what each table is built from
+    size_t osc_segment_count[2] = { 0, 0 };
+    int osc_building = -1; // channel the builder is working for
+    int osc_pitch_cv[2];
+    bool initialized = false;
+
+    // Reverb delay memory, about 36K per channel
+    DMAMEM HS::CombReverb reverb_cores[2];
+
+    // Audio applets, one set for each channel since they keep state
+    AudioVCA audio_vca[2];
+    AudioBitCrush audio_bitcrush[2];
+    AudioApplet *const audio_applets[2][2] = {
+      { &audio_vca[0], &audio_bitcrush[0] },
+      { &audio_vca[1], &audio_bitcrush[1] },
+    };
+    const int AUDIO_APPLET_COUNT = 2;
+
+    // AudioProcessorUsageMax() seen with each pair of modes [left][right]
+    float mode_usage_max[MODE_COUNT][MODE_COUNT];
+
 
     // Right side state variable filter functions
     void SelectHPF() {
@@ -123,31 +150,6 @@ namespace OC {
       mixer2.gain(3, 0.0); // Dry
     }
 
-    void BypassFilter(int ch) {
-      if (ch == 0) {
-        mixer1.gain(0, 0.0); // LPF
-        mixer1.gain(1, 0.0); // unused
-        mixer1.gain(2, 0.0); // unused
-        mixer1.gain(3, 1.0); // Dry
-      } else {
-        mixer2.gain(0, 0.0); // LPF
-        mixer2.gain(1, 0.0); // BPF
-        mixer2.gain(2, 0.0); // HPF
-        mixer2.gain(3, 1.0); // Dry
-      }
-    }
-
-    void EnableFilter(int ch) {
-      if (ch == 0) {
-        mixer1.gain(0, 1.0); // LPF
-        mixer1.gain(1, 0.0); // unused
-        mixer1.gain(2, 0.0); // unused
-        mixer1.gain(3, 0.0); // Dry
-      } else {
-        SelectLPF();
-      }
-    }
-
     void ModFilter(int ch, int cv) {
       // quartertones squared
       // 1 Volt is 576 Hz
@@ -179,12 +181,177 @@ namespace OC {
 
     void AmpLevel(int ch, int cv) {
       amplevel[ch] = (float)cv / MAX_CV + bias[ch][AMP_LEVEL];
-      if (ch == 0)
+      if (mode[ch] == VCA_MODE)
+        (ch ? amp2 : amp1).gain(amplevel[ch]);
+      else if (ch == 0)
         mixer3.gain(0, amplevel[ch] * (1.0 - abs(foldamt[ch])));
       else
         mixer4.gain(0, amplevel[ch] * (1.0 - abs(foldamt[ch])));
     }
 
+    void ReverbParams(int ch, const int *values) {
+      float size = bias[ch][REVERB_SIZE];
+      float damp = bias[ch][REVERB_DAMP];
+      if (mod_map[ch][REVERB_SIZE] >= 0)
+        size += (float)values[mod_map[ch][REVERB_SIZE]] / MAX_CV;
+      if (mod_map[ch][REVERB_DAMP] >= 0)
+        damp += (float)values[mod_map[ch][REVERB_DAMP]] / MAX_CV;
+
+      AudioEffectCombReverb &reverb = ch ? reverb2 : reverb1;
+      reverb.roomsize(size);
+      reverb.damping(damp);
+    }
+
+    float ReverbUsage() {
+      return reverb1.processorUsage() + reverb2.processorUsage();
+    }
+
+    float ReverbUsageMax() {
+      return reverb1.processorUsageMax() + reverb2.processorUsageMax();
+    }
+
+    AudioAppletSlot &AppletSlot(int ch) {
+      return ch ? applet2 : applet1;
+    }
+
+    const char *AppletName(int ch) {
+      return audio_applets[ch][applet_index[ch]]->applet_name();
+    }
+
+    float AppletUsage(int ch) {
+      return AppletSlot(ch).processorUsage();
+    }
+
+    float AppletUsageMax(int ch) {
+      return AppletSlot(ch).processorUsageMax();
+    }
+
+    void SelectApplet(int ch, int direction) {
+      int n = constrain(applet_index[ch] + direction, 0, AUDIO_APPLET_COUNT - 1);
+      if (n == applet_index[ch]) return;
+      applet_index[ch] = n;
+      if (mode[ch] == AUDIO_APPLET) AppletSlot(ch).begin(audio_applets[ch][n]);
+    }
+
+    void OscPitch(int ch, int cv) {
+      if (cv == osc_pitch_cv[ch]) return;
+      osc_pitch_cv[ch] = cv;
+      float freq = OSC_BASE_FREQ * exp2f((float)cv / (12 << 7) + bias[ch][OSC_PITCH]);
+      (ch ? vosc2 : vosc1).frequency(freq);
+    }
+
+    // Returns true if the channel's waveform has changed since its table was
+    // last built, either because another one was selected or it was edited.
+    bool OscWaveformChanged(int ch) {
+      HS::WavetableSegment segments[HS::WAVETABLE_MAX_SEGMENTS];
+      size_t count = HS::GetWavetableSegments(osc_waveform[ch], segments);
+      if (count == osc_segment_count[ch] &&
+          !memcmp(segments, osc_segments[ch], count * sizeof(segments[0])))
+        return false;
+
+      memcpy(osc_segments[ch], segments, count * sizeof(segments[0]));
+      osc_segment_count[ch] = count;
+      return true;
+    }
+
+    void SelectOscWaveform(int ch, int direction) {
+      HS::WavetableSegment segments[HS::WAVETABLE_MAX_SEGMENTS];
+      int n = osc_waveform[ch];
+      do {
+        n += direction;
+      } while (n >= 0 && n <= 255 && HS::GetWavetableSegments(n, segments) < 2);
+      if (n >= 0 && n <= 255) osc_waveform[ch] = n;
+    }
+
+    // Modes that go through mixer3/4 and the reverbs
+    static bool UsesMixer(ChannelMode m) {
+      return m != PASSTHRU && m != VCA_MODE;
+    }
+
+    // Connects only the objects the channel's mode needs.
+    // Each reverb also feeds the other channel, when both are in use.
+    void Patch(int ch) {
+      const ChannelMode m = mode[ch];
+      const bool mix = UsesMixer(m);
+      AudioStream &source = (m == VECTOR_OSC) ? static_cast<AudioStream &>(ch ? vosc2 : vosc1)
+                                              : static_cast<AudioStream &>(i2s1);
+      const int source_port = (m == VECTOR_OSC) ? 0 : ch;
+      AudioAmplifier &amp = ch ? amp2 : amp1;
+      AudioMixer4 &outmix = ch ? mixer4 : mixer3;
+      AudioEffectCombReverb &reverb = ch ? reverb2 : reverb1;
+
+      AudioNoInterrupts();
+      for (AudioConnection &cord : channel_cords[ch]) cord.disconnect();
+      for (AudioConnection &cord : reverb_cross_cords) cord.disconnect();
+
+      AudioConnection *cord = channel_cords[ch];
+      if (m == PASSTHRU) {
+        (cord++)->connect(source, source_port, i2s2, ch);
+      } else if (m == VCA_MODE) {
+        (cord++)->connect(source, source_port, amp, 0);
+        (cord++)->connect(amp, 0, i2s2, ch);
+      } else if (m == AUDIO_APPLET) {
+        (cord++)->connect(source, source_port, AppletSlot(ch), 0);
+        (cord++)->connect(AppletSlot(ch), 0, outmix, 0);
+      } else {
+        amp.gain(0.85); // attenuate before filter
+        (cord++)->connect(source, source_port, amp, 0);
+
+        if (m == LPG_MODE || m == VCF_MODE) {
+          if (ch == 0) {
+            (cord++)->connect(amp, 0, ladder1, 0);
+            (cord++)->connect(ladder1, 0, outmix, 0);
+          } else {
+            (cord++)->connect(amp, 0, svfilter1, 0);
+            for (int i = 0; i < 3; ++i) (cord++)->connect(svfilter1, i, mixer2, i);
+            (cord++)->connect(mixer2, 0, outmix, 0);
+          }
+        } else {
+          (cord++)->connect(amp, 0, outmix, 0);
+        }
+
+        if (m == WAVEFOLDER) {
+          AudioEffectWaveFolder &folder = ch ? wavefolder2 : wavefolder1;
+          (cord++)->connect(amp, 0, folder, 0);
+          (cord++)->connect(ch ? dc2 : dc1, 0, folder, 1);
+          (cord++)->connect(folder, 0, outmix, 3);
+        }
+
+      }
+      if (mix) {
+        (cord++)->connect(outmix, 0, i2s2, ch);
+        (cord++)->connect(outmix, 0, reverb, 0);
+        (cord++)->connect(reverb, 0, outmix, 1);
+      }
+
+      if (UsesMixer(mode[0]) && UsesMixer(mode[1])) {
+        reverb_cross_cords[0].connect(reverb1, 0, mixer4, 2);
+        reverb_cross_cords[1].connect(reverb2, 0, mixer3, 2);
+      }
+      reverb.enable(mix);
+      (ch ? vosc2 : vosc1).enable(m == VECTOR_OSC);
+      AudioInterrupts();
+
+      // Unpatched slots have no applet, so they don't run even while active
+      AppletSlot(ch).begin(m == AUDIO_APPLET ? audio_applets[ch][applet_index[ch]] : nullptr);
+    }
+
+    void TunerListen(int ch) {
+      AudioNoInterrupts();
+      tuner_cord.disconnect();
+      tuner_tap.clear();
+      if (ch >= 0) tuner_cord.connect(i2s1, ch & 1, tuner_tap, 0);
+      AudioInterrupts();
+    }
+
+    bool TunerSamples(int16_t *dst, size_t n) {
+      return tuner_tap.Latest(dst, n, true);
+    }
+
+    float ModeUsageMax(ChannelMode left, ChannelMode right) {
+      return mode_usage_max[left][right];
+    }
+
     // Designated Integration Functions
     // ----- called from setup() in Main.cpp
     void Init() {
@@ -194,8 +361,7 @@ namespace OC {
       amp2.gain(0.85); // attenuate before filter
 
       // --Filters
-      BypassFilter(0);
-      BypassFilter(1);
+      SelectLPF();
 
       svfilter1.resonance(1.05);
       ladder1.resonance(0.65);
@@ -206,25 +372,82 @@ namespace OC {
       mixer3.gain(3, 0.9);
       mixer4.gain(3, 0.9);
 
+      // --Vector oscillators
+      osc_builder.Init();
+      for (int ch = 0; ch < 2; ++ch) {
+        osc_tables[ch].Init();
+        osc_pitch_cv[ch] = 0x7fffffff;
+      }
+      vosc1.begin(&osc_tables[0]);
+      vosc2.begin(&osc_tables[1]);
+      initialized = true;
+
       // --Reverbs
-      /*
-      freeverb1.roomsize(0.7);
-      freeverb1.damping(0.5);
+      bias[0][REVERB_SIZE] = 0.7;
+      bias[0][REVERB_DAMP] = 0.5;
+      bias[1][REVERB_SIZE] = 0.8;
+      bias[1][REVERB_DAMP] = 0.6;
+      reverb1.begin(&reverb_cores[0]);
+      reverb2.begin(&reverb_cores[1], 23); // Freeverb's stereo spread
+      for (int ch = 0; ch < 2; ++ch) {
+        AudioEffectCombReverb &reverb = ch ? reverb2 : reverb1;
+        reverb.roomsize(bias[ch][REVERB_SIZE]);
+        reverb.damping(bias[ch][REVERB_DAMP]);
+      }
       mixer3.gain(1, 0.08); // verb1
       mixer3.gain(2, 0.05); // verb2
-
-      freeverb2.roomsize(0.8);
-      freeverb2.damping(0.6);
       mixer4.gain(1, 0.08); // verb2
       mixer4.gain(2, 0.05); // verb1
-      */
-      
+
+      Patch(0);
+      Patch(1);
+    }
+
+    // ----- called from loop() in Main.cpp
+    // Wavetables are regenerated here, one FFT per call, so the audio and
+    // core ISRs never wait on it.
+    void Idle() {
+      if (!initialized) return;
+
+      // The max is reset on every mode change, so it belongs to this pair of modes
+      float usage = AudioProcessorUsageMax();
+      if (usage > mode_usage_max[mode[0]][mode[1]])
+        mode_usage_max[mode[0]][mode[1]] = usage;
+
+      if (osc_building < 0) {
+        for (int ch = 0; ch < 2; ++ch) {
+          if (mode[ch] == VECTOR_OSC && OscWaveformChanged(ch)) {
+            osc_builder.Start(osc_segments[ch], osc_segment_count[ch]);
+            osc_building = ch;
+            break;
+          }
+        }
+      }
+
+      if (osc_building >= 0) {
+        int level = osc_builder.Step();
+        if (level >= 0) {
+          AudioNoInterrupts();
+          osc_tables[osc_building].SetLevel(level, osc_builder.data());
+          AudioInterrupts();
+        }
+        if (!osc_builder.busy()) {
+          osc_tables[osc_building].set_ready();
+          osc_building = -1;
+        }
+      }
     }
 
     // ----- called from Controller thread
     void Process(const int *values) {
       for (int i = 0; i < 2; ++i) {
 
+        // other modulation happens regardless of mode, and first,
+        // since the mode switch below may skip the rest of the loop
+        ReverbParams(i, values);
+        if (mode[i] == AUDIO_APPLET)
+          AppletSlot(i).SetCV(values, ADC_CHANNEL_LAST + DAC_CHANNEL_LAST, mod_map[i][APPLET_CV]);
+
         // some things depend on mode
         switch(mode[i]) {
           default:
@@ -249,40 +472,52 @@ namespace OC {
             ModFilter(i, values[mod_map[i][FILTER_CUTOFF]]);
             break;
 
+          case VECTOR_OSC:
+            if (mod_map[i][OSC_PITCH] < 0) continue;
+            OscPitch(i, values[mod_map[i][OSC_PITCH]]);
+            break;
         }
-
-        // other modulation happens regardless of mode
-
       }
     }
 
     void SwitchMode(int ch, ChannelMode newmode) {
       mode[ch] = newmode;
+      Patch(ch);
       switch(newmode) {
           case PASSTHRU:
           case VCA_MODE:
+          case VCF_MODE:
+          case LPG_MODE:
             Wavefold(ch, 0);
             AmpLevel(ch, MAX_CV);
-            BypassFilter(ch);
             break;
 
-          case VCF_MODE:
-          case LPG_MODE:
+          case WAVEFOLDER:
+            AmpLevel(ch, MAX_CV);
+            break;
+
+          case VECTOR_OSC:
             Wavefold(ch, 0);
             AmpLevel(ch, MAX_CV);
-            EnableFilter(ch);
+            OscPitch(ch, 0);
             break;
 
-          case WAVEFOLDER:
+          case AUDIO_APPLET:
+            Wavefold(ch, 0);
             AmpLevel(ch, MAX_CV);
-            BypassFilter(ch);
             break;
           default: break;
       }
+      AudioProcessorUsageMaxReset();
     }
 
     void AudioMenuAdjust(int ch, int direction) {
-      if (audio_cursor[ch]) {
+      if (audio_cursor[ch] == 2) {
+        if (mode[ch] == AUDIO_APPLET)
+          SelectApplet(ch, direction);
+        else
+          SelectOscWaveform(ch, direction);
+      } else if (audio_cursor[ch]) {
         int mod_target = AMP_LEVEL;
         switch (mode[ch]) {
           case VCF_MODE:
@@ -291,6 +526,12 @@ namespace OC {
           case WAVEFOLDER:
             mod_target = WAVEFOLD_MOD;
             break;
+          case VECTOR_OSC:
+            mod_target = OSC_PITCH;
+            break;
+          case AUDIO_APPLET:
+            mod_target = APPLET_CV;
+            break;
           default: break;
         }
 
@@ -15,6 +15,8 @@ namespace OC {
       REVERB_LEVEL,
       REVERB_SIZE,
       REVERB_DAMP,
+      OSC_PITCH,
+      APPLET_CV,
 
       TARGET_COUNT
     };
@@ -25,6 +27,8 @@ namespace OC {
       LPG_MODE,
       VCF_MODE,
       WAVEFOLDER,
+      VECTOR_OSC,
+      AUDIO_APPLET,
 
       MODE_COUNT
     };
@@ -37,16 +41,30 @@ namespace OC {
     extern int mod_map[2][TARGET_COUNT]; // CV modulation sources (as channel indexes for [inputs..outputs])
     extern float bias[2][TARGET_COUNT]; // baseline settings
     extern uint8_t audio_cursor[2];
-    static constexpr int CURSOR_MAX = 2;
+    extern uint8_t osc_waveform[2]; // VECTOR_OSC waveform number, as in WaveformManager
+    extern uint8_t applet_index[2]; // AUDIO_APPLET selection
+    static constexpr int CURSOR_MAX = 3; // the last one is only for VECTOR_OSC and AUDIO_APPLET
 
     void Init();
+    void Idle(); // called from loop(), regenerates wavetables
     void Process(const int *values);
     void SwitchMode(int ch, ChannelMode newmode);
     void AudioMenuAdjust(int ch, int direction);
     void DrawAudioSetup();
+    float ReverbUsage(); // AudioProcessorUsage() of the reverbs alone
+    float ReverbUsageMax();
+    float ModeUsageMax(ChannelMode left, ChannelMode right); // AudioProcessorUsageMax() seen in those modes
+    const char *AppletName(int ch);
+    float AppletUsage(int ch); // processorUsage() of the channel's applet slot
+    float AppletUsageMax(int ch);
+
+    // Pitch tracking on an audio input, for the Tuner
+    void TunerListen(int ch); // input channel to tap, or -1 to stop
+    bool TunerSamples(int16_t *dst, size_t n); // newest n samples at half the audio rate
 
     static inline void AudioSetupButtonAction(int ch) {
-      ++audio_cursor[ch] %= CURSOR_MAX;
+      const bool third = (mode[ch] == VECTOR_OSC || mode[ch] == AUDIO_APPLET);
+      ++audio_cursor[ch] %= (third ? CURSOR_MAX : CURSOR_MAX - 1);
     }
   } // AudioDSP namespace
 } // OC namespace
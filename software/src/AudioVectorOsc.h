@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Audio.h>
+#include "vector_osc/HSVectorWavetable.h"
+
+// Plays a VectorWavetable at audio rate. The tables are generated outside the
+// audio interrupt (see OC::AudioDSP::Idle) and only have to be ready() before
+// this makes any sound; until then, and while disabled, no block is sent.
+class AudioSynthVectorOsc : public AudioStream {
+public:
+  AudioSynthVectorOsc() : AudioStream(0, NULL) { }
+
+  void begin(HS::VectorWavetable *table) {
+    table_ = table;
+  }
+
+  void enable(bool on) {
+    enabled_ = on;
+  }
+
+  void frequency(float freq) {
+    if (freq < 0.0f) freq = 0.0f;
+    else if (freq > AUDIO_SAMPLE_RATE_EXACT / 2.0f) freq = AUDIO_SAMPLE_RATE_EXACT / 2.0f;
+    increment_ = freq * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT);
+  }
+
+  virtual void update(void) {
+    if (!enabled_ || !table_ || !table_->ready()) return;
+    audio_block_t *block = allocate();
+    if (!block) return;
+    table_->Render(phase_, increment_, block->data, AUDIO_BLOCK_SAMPLES);
+    transmit(block);
+    release(block);
+  }
+
+private:
+  HS::VectorWavetable *table_ = nullptr;
+  volatile bool enabled_ = false;
+  volatile uint32_t increment_ = 0;
+  uint32_t phase_ = 0;
+};
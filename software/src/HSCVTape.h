@@ -0,0 +1,166 @@
+/*
+ * Delta-encoded CV recording for CVRecV2's tape mode, one channel per tape.
+ *
+ * Samples are stored as the difference from the one before, in variable-length codes:
+ *
+ *   0xxxxxxx                     delta of -64..63
+ *   10xxxxxx xxxxxxxx            delta of -8192..8191
+ *   110nnnnn                     n + 2 samples that repeat the last one
+ *   111xxxxx xxxxxxxx xxxxxxxx   any other delta, 21 bits
+ *
+ * so a slow gesture costs about a byte per sample and a held value much less. Writing
+ * or reading a sample is at most four bytes, so the work per tick has a fixed bound.
+ * The tape doesn't own its memory; it's given a region of whatever arena is free.
+ */
+
+#ifndef HS_CV_TAPE_H
+#define HS_CV_TAPE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace HS {
+
+class CVTape {
+public:
+    // Bytes a single Record() may need: a pending run, then the longest delta
+    static constexpr size_t WORST_CASE_BYTES = 4;
+
+    void Init(uint8_t *mem, size_t size) {
+        mem_ = mem;
+        size_ = size;
+        Erase();
+    }
+
+    void Erase() {
+        used_ = 0;
+        length_ = 0;
+        recording_ = false;
+        Rewind();
+    }
+
+    /* Recording replaces whatever was on the tape */
+    void StartRecording() {
+        Erase();
+        recording_ = true;
+        last_ = 0;
+        run_ = 0;
+    }
+
+    /* Adds one sample. Returns false, and stops recording, once the tape is full. */
+    bool Record(int16_t value) {
+        if (!recording_) return false;
+        if (size_ - used_ < WORST_CASE_BYTES) {
+            StopRecording();
+            return false;
+        }
+
+        int32_t delta = int32_t(value) - last_;
+        last_ = value;
+        ++length_;
+        if (delta == 0) {
+            if (++run_ == MAX_RUN) FlushRun();
+            return true;
+        }
+        FlushRun();
+        if (delta >= -64 && delta < 64) {
+            Put(delta & 0x7f);
+        } else if (delta >= -8192 && delta < 8192) {
+            Put(0x80 | ((delta >> 8) & 0x3f));
+            Put(delta & 0xff);
+        } else {
+            Put(0xe0 | ((delta >> 16) & 0x1f));
+            Put((delta >> 8) & 0xff);
+            Put(delta & 0xff);
+        }
+        return true;
+    }
+
+    void StopRecording() {
+        if (!recording_) return;
+        FlushRun();
+        recording_ = false;
+        Rewind();
+    }
+
+    void Rewind() {
+        read_pos_ = 0;
+        read_count_ = 0;
+        read_run_ = 0;
+        value_ = 0;
+    }
+
+    /* The next sample, going back to the start after the last one */
+    int16_t Next() {
+        if (recording_ || length_ == 0) return 0;
+        if (read_count_ == length_) Rewind();
+        ++read_count_;
+
+        if (read_run_) {
+            --read_run_;
+            return value_;
+        }
+
+        uint8_t code = mem_[read_pos_++];
+        int32_t delta;
+        if (!(code & 0x80)) {
+            delta = SignExtend(code, 7);
+        } else if (!(code & 0x40)) {
+            delta = SignExtend(((code & 0x3f) << 8) | mem_[read_pos_], 14);
+            read_pos_ += 1;
+        } else if (!(code & 0x20)) {
+            read_run_ = (code & 0x1f) + 1; // this sample is the first of the run
+            delta = 0;
+        } else {
+            delta = SignExtend(((code & 0x1f) << 16) | (mem_[read_pos_] << 8) | mem_[read_pos_ + 1], 21);
+            read_pos_ += 2;
+        }
+        value_ += delta;
+        return value_;
+    }
+
+    bool recording() const { return recording_; }
+    size_t length() const { return length_; } // in samples
+    size_t position() const { return read_count_; }
+    size_t used() const { return used_; } // in bytes
+    size_t capacity() const { return size_; }
+    size_t remaining() const { return size_ - used_; }
+
+private:
+    static constexpr int MAX_RUN = 33;
+
+    uint8_t *mem_ = nullptr;
+    size_t size_ = 0;
+    size_t used_ = 0;
+    size_t length_ = 0;
+    bool recording_ = false;
+
+    // Encoder
+    int32_t last_ = 0;
+    int run_ = 0;
+
+    // Decoder
+    size_t read_pos_ = 0;
+    size_t read_count_ = 0;
+    int read_run_ = 0;
+    int32_t value_ = 0;
+
+    void Put(uint8_t byte) {
+        mem_[used_++] = byte;
+    }
+
+    void FlushRun() {
+        if (run_ == 1) Put(0x00);
+        else if (run_ > 1) Put(0xc0 | (run_ - 2));
+        run_ = 0;
+    }
+
+    static int32_t SignExtend(int32_t x, int bits) {
+        const int32_t sign = int32_t(1) << (bits - 1);
+        return (x ^ sign) - sign;
+    }
+};
+
+} // namespace HS
+
+#endif // HS_CV_TAPE_H
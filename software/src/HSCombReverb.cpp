@@ -0,0 +1,110 @@
+#include <string.h>
+#include "HSCombReverb.h"
+
+namespace HS {
+
+// Freeverb's tunings, in samples at 44.1kHz
+static const uint16_t kCombTuning[CombReverb::kNumCombs] = {
+    1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617
+};
+static const uint16_t kAllpassTuning[CombReverb::kNumAllpasses] = { 556, 341 };
+
+// Feedback runs from 0.7 to 0.98, and the damping coefficient up to 0.4, as in Freeverb
+static const int32_t kMinFeedback = 22938;
+static const int32_t kFeedbackRange = 9175;
+static const int32_t kMaxDamping = 13107;
+
+static inline int32_t Saturate16(int32_t x) {
+    if (x > 32767) return 32767;
+    if (x < -32768) return -32768;
+    return x;
+}
+
+/* Rounds toward zero, so that a tail can die away completely instead of sticking at -1 */
+static inline int32_t MulQ15(int32_t x, int32_t q) {
+    int32_t p = x * q;
+    return (p + ((p >> 31) & 32767)) >> 15;
+}
+
+static inline int32_t ClampQ15(int32_t x) {
+    if (x < 0) return 0;
+    if (x > 32767) return 32767;
+    return x;
+}
+
+void CombReverb::Init(int spread) {
+    memset(combs_, 0, sizeof(combs_));
+    memset(allpasses_, 0, sizeof(allpasses_));
+    memset(comb_filter_, 0, sizeof(comb_filter_));
+    if (spread < 0) spread = 0;
+    for (int c = 0; c < kNumCombs; c++)
+    {
+        int delay = kCombTuning[c] + spread;
+        comb_delay_[c] = delay < static_cast<int>(kCombFrames) ? delay : kCombFrames - 1;
+    }
+    for (int a = 0; a < kNumAllpasses; a++)
+    {
+        int delay = kAllpassTuning[a] + spread;
+        allpass_delay_[a] = delay < static_cast<int>(kAllpassFrames) ? delay : kAllpassFrames - 1;
+    }
+    comb_index_ = 0;
+    allpass_index_ = 0;
+    set_size(16384);
+    set_damping(16384);
+}
+
+void CombReverb::set_size(int32_t size) {
+    feedback_ = kMinFeedback + ((ClampQ15(size) * kFeedbackRange) >> 15);
+}
+
+void CombReverb::set_damping(int32_t damping) {
+    damping_ = (ClampQ15(damping) * kMaxDamping) >> 15;
+}
+
+void CombReverb::Process(const int16_t *in, int16_t *out, size_t size) {
+    const size_t comb_mask = kCombFrames - 1;
+    const size_t allpass_mask = kAllpassFrames - 1;
+    const int32_t feedback = feedback_;
+    const int32_t damping = damping_;
+    int32_t filter[kNumCombs];
+    for (int c = 0; c < kNumCombs; c++) filter[c] = comb_filter_[c];
+    size_t comb_index = comb_index_;
+    size_t allpass_index = allpass_index_;
+
+    for (size_t n = 0; n < size; n++)
+    {
+        // Eight combs at up to 1 / (1 - 0.98) gain each, so the input goes in at about Freeverb's 0.015
+        int32_t input = in[n] >> 6;
+        int32_t wet = 0;
+
+        // One frame holds the sample going into every comb. Each comb reads its own column from an
+        // older frame, one comb delay behind.
+        int16_t *frame = combs_[comb_index];
+        for (int c = 0; c < kNumCombs; c++)
+        {
+            int32_t delayed = combs_[(comb_index - comb_delay_[c]) & comb_mask][c];
+            filter[c] = delayed + MulQ15(filter[c] - delayed, damping);
+            frame[c] = Saturate16(input + MulQ15(filter[c], feedback));
+            wet += delayed;
+        }
+        comb_index = (comb_index + 1) & comb_mask;
+        wet = Saturate16(wet);
+
+        for (int a = 0; a < kNumAllpasses; a++)
+        {
+            int16_t *line = allpasses_[a];
+            int32_t delayed = line[(allpass_index - allpass_delay_[a]) & allpass_mask];
+            line[allpass_index] = Saturate16(wet + MulQ15(delayed, 16384));
+            wet = Saturate16(delayed - wet);
+        }
+        allpass_index = (allpass_index + 1) & allpass_mask;
+
+        out[n] = wet;
+    }
+
+    for (int c = 0; c < kNumCombs; c++) comb_filter_[c] = filter[c];
+    comb_index_ = comb_index;
+    allpass_index_ = allpass_index;
+}
+
+} // namespace HS
@@ -0,0 +1,52 @@
+/*
+ * Integer Schroeder/Moorer reverb: eight damped comb filters in parallel, then two allpass
+ * diffusers, in the manner of Freeverb but in 16-bit fixed point throughout.
+ *
+ * The comb filters share one delay memory, interleaved so that sample n of every comb sits in
+ * the same frame. All eight are written through a single index, and each reads back at its own
+ * distance behind it. The object holds all of its delay memory, so on the Teensy it's meant to
+ * be placed in DMAMEM; call Init() before use, since that memory isn't cleared at startup.
+ */
+
+#ifndef HS_COMB_REVERB_H
+#define HS_COMB_REVERB_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace HS {
+
+class CombReverb {
+public:
+    static constexpr int kNumCombs = 8;
+    static constexpr int kNumAllpasses = 2;
+    static constexpr size_t kCombFrames = 2048; // power of 2, longer than any comb
+    static constexpr size_t kAllpassFrames = 1024; // power of 2, longer than any allpass
+
+    /* spread lengthens every delay by that many samples, to decorrelate two instances */
+    void Init(int spread = 0);
+
+    /* 0 to 32767, for a decay from short to very long */
+    void set_size(int32_t size);
+
+    /* 0 to 32767, from bright to dark */
+    void set_damping(int32_t damping);
+
+    /* Wet signal only. in and out may be the same buffer. */
+    void Process(const int16_t *in, int16_t *out, size_t size);
+
+private:
+    int16_t combs_[kCombFrames][kNumCombs];
+    int16_t allpasses_[kNumAllpasses][kAllpassFrames];
+    uint16_t comb_delay_[kNumCombs];
+    uint16_t allpass_delay_[kNumAllpasses];
+    int16_t comb_filter_[kNumCombs];
+    size_t comb_index_;
+    size_t allpass_index_;
+    int32_t feedback_; // Q15
+    int32_t damping_; // Q15
+};
+
+} // namespace HS
+
+#endif // HS_COMB_REVERB_H
@@ -0,0 +1,133 @@
+/*
+ * Envelope detector: true RMS over a sliding window, or peak with a hold, then smoothed with
+ * separate attack and release times.
+ *
+ * RMS keeps a running sum of squares. Each sample adds its square and takes away the square of
+ * the one leaving the window, so the cost doesn't depend on the window length. The smoothing is
+ * a one-pole filter that picks its coefficient by whether the level is above or below the
+ * envelope. Peak mode follows |x|, and holds a new peak for a while before releasing.
+ *
+ * Times are in samples, so the same detector works at the core tick rate or the audio rate.
+ * Coefficients are worked out when a time is set, never per sample.
+ */
+
+#ifndef HS_ENVELOPE_DETECTOR_H
+#define HS_ENVELOPE_DETECTOR_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace HS {
+
+template <size_t window_size = 128>
+class EnvelopeDetector {
+public:
+    static_assert((window_size & (window_size - 1)) == 0, "window_size must be a power of 2");
+
+    enum Mode { PEAK, RMS };
+
+    void Init() {
+        memset(window_, 0, sizeof(window_));
+        head_ = 0;
+        sum_ = 0;
+        env_ = 0;
+        rms_ = 0;
+        hold_count_ = 0;
+    }
+
+    void set_mode(Mode mode) { mode_ = mode; }
+
+    /* Time constants, in samples: the time to cover 63% of a step */
+    void set_attack(float samples) { attack_ = Coefficient(samples); }
+    void set_release(float samples) { release_ = Coefficient(samples); }
+
+    /* How long a new peak is held before it starts to release, in samples */
+    void set_hold(uint32_t samples) { hold_ = samples; }
+
+    /* Takes one sample, returns the envelope. Inputs are 16-bit. */
+    int32_t Process(int32_t x) {
+        // The window is kept in both modes so that switching mode doesn't start from nothing
+        const int32_t leaving = window_[head_];
+        window_[head_] = int16_t(x);
+        head_ = (head_ + 1) & (window_size - 1);
+        sum_ += uint64_t(int64_t(x) * x) - uint64_t(int64_t(leaving) * leaving);
+
+        int32_t level;
+        uint32_t coefficient;
+        if (mode_ == RMS) {
+            level = rms_ = SqrtNear(uint32_t(sum_ / window_size), rms_);
+            coefficient = (int64_t(level) << FRACTION) > env_ ? attack_ : release_;
+        } else {
+            level = x < 0 ? -x : x;
+            if ((int64_t(level) << FRACTION) > env_) {
+                hold_count_ = hold_;
+                coefficient = attack_;
+            } else if (hold_count_) {
+                --hold_count_;
+                return value();
+            } else {
+                coefficient = release_;
+            }
+        }
+
+        env_ += ((int64_t(level) << FRACTION) - env_) * coefficient >> 16;
+        return value();
+    }
+
+    int32_t value() const { return int32_t(env_ >> FRACTION); }
+
+    /* Q16 one-pole coefficient for a time constant in samples; 0 is instant */
+    static uint32_t Coefficient(float samples) {
+        if (samples <= 0.0f) return 65536;
+        return uint32_t(65536.0f * (1.0f - expf(-1.0f / samples)) + 0.5f);
+    }
+
+    /* Integer square root, rounded down, by Newton's method from a guess. Close guesses,
+       like the last root, take one or two divisions. */
+    static int32_t SqrtNear(uint32_t n, uint32_t guess) {
+        if (!n) return 0;
+        uint32_t x = guess ? guess : 1;
+        uint32_t y = (uint64_t(x) + n / x) >> 1;
+        if (y > x) x = y; // from above, the steps only go down
+        while ((y = (uint64_t(x) + n / x) >> 1) < x) x = y;
+        return int32_t(x);
+    }
+
+    /* Integer square root, rounded down */
+    static int32_t Sqrt(uint32_t n) {
+        if (!n) return 0;
+        uint32_t root = 0;
+        uint32_t bit = uint32_t(1) << ((31 - __builtin_clz(n)) & ~1); // highest power of 4 <= n
+        while (bit) {
+            if (n >= root + bit) {
+                n -= root + bit;
+                root = (root >> 1) + bit;
+            } else {
+                root >>= 1;
+            }
+            bit >>= 2;
+        }
+        return int32_t(root);
+    }
+
+private:
+    static constexpr int FRACTION = 8; // of the envelope, so slow releases don't stall
+
+    Mode mode_ = PEAK;
+    uint32_t attack_ = 65536;
+    uint32_t release_ = 65536;
+    uint32_t hold_ = 0;
+
+    int16_t window_[window_size];
+    size_t head_ = 0;
+    uint64_t sum_ = 0;
+    int64_t env_ = 0;
+    uint32_t rms_ = 0;
+    uint32_t hold_count_ = 0;
+};
+
+} // namespace HS
+
+#endif // HS_ENVELOPE_DETECTOR_H
@@ -0,0 +1,115 @@
+/*
+ * Game of Life board for the GameOfLife applet, one uint64_t per row and one bit per cell.
+ *
+ * A generation is computed a whole row at a time: the eight neighbours of every cell in the
+ * row are the row above, the row below and the row itself, each shifted left and right. They
+ * are summed with bit-sliced adders, so each bit position carries its own 3-bit count, and the
+ * rules become a few logic operations on those bits. Densities are popcounts.
+ */
+
+#ifndef HS_LIFE_BOARD_H
+#define HS_LIFE_BOARD_H
+
+#include <stdint.h>
+#include <string.h>
+
+namespace HS {
+
+class LifeBoard {
+public:
+    static constexpr int WIDTH = 64;
+    static constexpr int MAX_ROWS = 80;
+
+    /* A toroid wraps around at the edges; otherwise cells beyond them are always dead */
+    void Init(int rows, bool toroid) {
+        rows_ = rows < 1 ? 1 : (rows > MAX_ROWS ? MAX_ROWS : rows);
+        toroid_ = toroid;
+        Clear();
+    }
+
+    void Clear() {
+        memset(board_, 0, sizeof(board_));
+    }
+
+    int rows() const { return rows_; }
+    bool toroid() const { return toroid_; }
+    uint64_t row(int y) const { return board_[y]; }
+
+    bool Get(int x, int y) const {
+        return (board_[y] >> x) & 0x01;
+    }
+
+    void Set(int x, int y) {
+        if (x >= 0 && x < WIDTH && y >= 0 && y < rows_) board_[y] |= uint64_t(1) << x;
+    }
+
+    /* Advance one generation, and return the number of live cells */
+    int Step() {
+        const uint64_t first = board_[0]; // rows are replaced as they go
+        uint64_t above = toroid_ ? board_[rows_ - 1] : 0;
+        uint64_t current = first;
+        int live = 0;
+        for (int y = 0; y < rows_; y++)
+        {
+            uint64_t below = (y + 1 < rows_) ? board_[y + 1] : (toroid_ ? first : 0);
+            board_[y] = NextRow(above, current, below);
+            live += __builtin_popcountll(board_[y]);
+            above = current;
+            current = below;
+        }
+        return live;
+    }
+
+    /* Live cells within the rectangle from (x0, y0) to (x1, y1) inclusive, clipped to the board */
+    int CountIn(int x0, int y0, int x1, int y1) const {
+        if (x0 < 0) x0 = 0;
+        if (y0 < 0) y0 = 0;
+        if (x1 > WIDTH - 1) x1 = WIDTH - 1;
+        if (y1 > rows_ - 1) y1 = rows_ - 1;
+        if (x0 > x1 || y0 > y1) return 0;
+
+        uint64_t mask = (~uint64_t(0) >> (WIDTH - 1 - x1)) & (~uint64_t(0) << x0);
+        int count = 0;
+        for (int y = y0; y <= y1; y++) count += __builtin_popcountll(board_[y] & mask);
+        return count;
+    }
+
+private:
+    uint64_t board_[MAX_ROWS];
+    int rows_ = 40;
+    bool toroid_ = true;
+
+    // Bit x of the result is the neighbour at x - 1 (West) or x + 1 (East) of bit x in r
+    uint64_t West(uint64_t r) const { return toroid_ ? (r << 1) | (r >> 63) : r << 1; }
+    uint64_t East(uint64_t r) const { return toroid_ ? (r >> 1) | (r << 63) : r >> 1; }
+
+    static inline void FullAdd(uint64_t a, uint64_t b, uint64_t c, uint64_t &sum, uint64_t &carry) {
+        uint64_t t = a ^ b;
+        sum = t ^ c;
+        carry = (a & b) | (t & c);
+    }
+
+    uint64_t NextRow(uint64_t above, uint64_t current, uint64_t below) const {
+        // Ones and twos from each row: three cells above and below, two beside
+        uint64_t above1, above2, below1, below2;
+        FullAdd(West(above), above, East(above), above1, above2);
+        FullAdd(West(below), below, East(below), below1, below2);
+        uint64_t side1 = West(current) ^ East(current);
+        uint64_t side2 = West(current) & East(current);
+
+        // Count bits. Eight neighbours wrap around to 0, which is just as dead.
+        uint64_t count1, carry2, twos, carry4a, carry4b;
+        FullAdd(above1, below1, side1, count1, carry2);
+        FullAdd(above2, below2, side2, twos, carry4a);
+        uint64_t count2 = twos ^ carry2;
+        carry4b = twos & carry2;
+        uint64_t count4 = carry4a ^ carry4b;
+
+        // Alive with 2 or 3 neighbours, or born with 3
+        return count2 & ~count4 & (count1 | current);
+    }
+};
+
+} // namespace HS
+
+#endif // HS_LIFE_BOARD_H
@@ -0,0 +1,160 @@
+/*
+ * Compiled logic networks, for the Neural Network app.
+ *
+ * Every gate is reduced to a 32-entry truth table over its three sources, its own last state,
+ * and whether its clock (the second source) has just gone high. Flip-flops, latches and
+ * threshold neurons become tables just like AND or XOR, so a tick is the same few shifts and
+ * masks for every gate, with no decoding and no branches.
+ *
+ * All state is one word: bits 0-7 are the inputs, gate g is bit GATE_BIT + g, and ON and OFF
+ * are bits that never change. Gates are evaluated in order. A gate that reads an earlier one
+ * sees this tick's value, and a later one, last tick's. That order is part of how networks
+ * behave (a chain of flip-flops is a shift register one way round and not the other), so it's
+ * kept as the schedule rather than re-sorted.
+ *
+ * Compile() from the UI side, Tick() from the ISR. There are two banks of ops, so the ISR
+ * always sees a complete network.
+ */
+
+#ifndef HS_LOGIC_NETLIST_H
+#define HS_LOGIC_NETLIST_H
+
+#include <stdint.h>
+#include <type_traits>
+
+namespace HS {
+
+struct LogicGateSpec {
+    // Same order as the app's LogicGateType
+    enum Type {
+        NONE, NOT, AND, OR, XOR, NAND, NOR, XNOR, D_FLIPFLOP, T_FLIPFLOP, LATCH, TL_NEURON,
+        TYPE_COUNT
+    };
+
+    uint8_t type;
+    uint8_t source[3]; // bits of the state word
+    int8_t weight[3]; // TL_NEURON only
+    int8_t threshold;
+
+    /* Output for each combination of a, b, c, last state, and clock edge, in that bit order */
+    uint32_t TruthTable() const {
+        uint32_t table = 0;
+        for (int i = 0; i < 32; ++i) {
+            const bool a = i & 1, b = i & 2, c = i & 4, q = i & 8, edge = i & 16;
+            bool v = 0;
+            switch (type) {
+            case NOT: v = !a; break;
+            case AND: v = a && b; break;
+            case OR: v = a || b; break;
+            case XOR: v = a != b; break;
+            case NAND: v = !(a && b); break;
+            case NOR: v = !(a || b); break;
+            case XNOR: v = a == b; break;
+            case D_FLIPFLOP: v = edge ? a : q; break;
+            case T_FLIPFLOP: v = (edge && a) ? !q : q; break;
+            case LATCH: v = b || (!a && q); break; // set wins over reset
+            case TL_NEURON: v = (a * weight[0] + b * weight[1] + c * weight[2]) > threshold; break;
+            default: break;
+            }
+            table |= uint32_t(v) << i;
+        }
+        return table;
+    }
+};
+
+template <int gates>
+class LogicNetlist {
+public:
+    static_assert(gates > 0 && gates <= 32, "a netlist has 1 to 32 gates");
+
+    // Small networks fit a 32-bit word, which is much cheaper to shift on the Cortex-M4
+    typedef typename std::conditional<(gates <= 22), uint32_t, uint64_t>::type Word;
+
+    static constexpr int INPUTS = 8;
+    static constexpr int GATE_BIT = INPUTS;
+    static constexpr int ON_BIT = sizeof(Word) * 8 - 2;
+    static constexpr int OFF_BIT = sizeof(Word) * 8 - 1;
+
+    /* Build the ops for these gates. Gates in clear start again from 0, like a new type. */
+    void Compile(const LogicGateSpec *spec, uint32_t clear = 0) {
+        const int bank = 1 - bank_;
+        int n = 0;
+        for (int g = 0; g < gates; ++g) {
+            if (spec[g].type == LogicGateSpec::NONE) {
+                clear |= 1u << g; // not evaluated, so make sure it's off
+                continue;
+            }
+            Op &op = ops_[bank][n++];
+            op.a = Source(spec[g].source[0]);
+            op.b = Source(spec[g].source[1]);
+            op.c = Source(spec[g].source[2]);
+            op.gate = g;
+            op.bit = GATE_BIT + g;
+            op.table = spec[g].TruthTable();
+        }
+        count_[bank] = n;
+        // The clear goes in first, and adds to one a Tick hasn't taken yet, so the new ops never
+        // run without it
+        clear_ |= clear;
+        bank_ = bank;
+    }
+
+    /* One tick, with the inputs as a bitfield. Returns the whole state word. */
+    Word Tick(uint8_t inputs) {
+        const int bank = bank_;
+        const Op *op = ops_[bank];
+        const Op *end = op + count_[bank];
+
+        Word s = state_;
+        s &= ~(Word(clear_) << GATE_BIT);
+        clear_ = 0;
+        s = (s & ~Word(0xff)) | inputs | (Word(1) << ON_BIT);
+
+        uint32_t clocked = clocked_;
+        for (; op < end; ++op) {
+            const uint32_t a = (s >> op->a) & 1;
+            const uint32_t b = (s >> op->b) & 1;
+            const uint32_t c = (s >> op->c) & 1;
+            const uint32_t q = (s >> op->bit) & 1;
+            const uint32_t edge = b & ~(clocked >> op->gate) & 1;
+            clocked = (clocked & ~(1u << op->gate)) | (b << op->gate);
+
+            // Flip the gate's bit if the table says it changes
+            const uint32_t v = (op->table >> (a | (b << 1) | (c << 2) | (q << 3) | (edge << 4))) & 1;
+            s ^= Word(v ^ q) << op->bit;
+        }
+        clocked_ = clocked;
+        state_ = s;
+        return s;
+    }
+
+    bool gate(int g) const { return (state_ >> (GATE_BIT + g)) & 1; }
+    bool bit(int b) const { return (state_ >> b) & 1; }
+    Word state() const { return state_; }
+
+    /* Gates that will be evaluated, leaving out the empty ones */
+    int ops() const { return count_[bank_]; }
+
+private:
+    struct Op {
+        uint32_t table;
+        uint8_t a, b, c;
+        uint8_t gate;
+        uint8_t bit; // of its state
+    };
+
+    Op ops_[2][gates];
+    uint8_t count_[2] = {0, 0};
+    volatile uint8_t bank_ = 0;
+    volatile uint32_t clear_ = 0;
+    Word state_ = 0;
+    uint32_t clocked_ = 0; // each gate's clock at the last tick
+
+    static uint8_t Source(uint8_t bit) {
+        return bit < sizeof(Word) * 8 ? bit : OFF_BIT;
+    }
+};
+
+} // namespace HS
+
+#endif // HS_LOGIC_NETLIST_H
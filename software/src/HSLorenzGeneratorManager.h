@@ -40,6 +40,10 @@ class LorenzGeneratorManager {
         lorenz.set_out_b(streams::LORENZ_OUTPUT_Y1);
         lorenz.set_out_c(streams::LORENZ_OUTPUT_X2);
         lorenz.set_out_d(streams::LORENZ_OUTPUT_Y2);
+#ifdef LORENZ_RK4
+        // Only runs once every LORENZ_PROCESS_TICKS, so RK4 is cheap enough here
+        lorenz.set_integrator(streams::LORENZ_INTEGRATOR_RK4);
+#endif
         last_process_tick = 0;
     }
 
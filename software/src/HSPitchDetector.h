@@ -0,0 +1,146 @@
+/*
+ * YIN pitch detection, split into steps so it can run a few lags at a time from the UI loop.
+ *
+ * Fill buffer() with window + max_lag samples and call Start(). Then each Step(lags) works out
+ * the difference function d(tau) for the next few lags, and its cumulative mean normalised form
+ * d'(tau). The first dip of d' below the threshold, followed down to its minimum, is the
+ * period. Parabolic interpolation around it gives a fraction of a sample. Because d' is
+ * computed in order of lag, analysis stops as soon as that minimum has passed, so high
+ * pitches cost less than low ones.
+ *
+ * The samples don't have to be audio. The Tuner also runs it on the sequence of periods from
+ * FreqMeasure, where a lag of k means the waveform triggers k times per cycle.
+ */
+
+#ifndef HS_PITCH_DETECTOR_H
+#define HS_PITCH_DETECTOR_H
+
+#include <stdint.h>
+
+namespace HS {
+
+template <typename T, int window, int max_lag>
+class PitchDetector {
+public:
+    static constexpr int BUFFER_SIZE = window + max_lag;
+
+    /* Needed when it lives in DMAMEM, where the initial values below aren't set */
+    void Init(float threshold = 0.15f) {
+        threshold_ = threshold;
+        best_ = 0;
+        result_ = 0.0f;
+        busy_ = false;
+    }
+
+    T *buffer() { return x_; }
+
+    /* Begin analysing what's in buffer() */
+    void Start() {
+        tau_ = 1;
+        running_sum_ = 0;
+        best_ = 0;
+        result_ = 0.0f;
+        cmndf_[0] = 1.0f;
+        busy_ = true;
+    }
+
+    bool busy() const { return busy_; }
+
+    /* Work on up to lags more lags. Returns true when the analysis is finished. */
+    bool Step(int lags) {
+        if (!busy_) return true;
+
+        for (; lags > 0 && tau_ < max_lag; --lags, ++tau_) {
+            int64_t d = 0;
+            for (int j = 0; j < window; ++j) {
+                const int64_t diff = int64_t(x_[j]) - x_[j + tau_];
+                d += diff * diff;
+            }
+            running_sum_ += d;
+            d_[tau_] = float(d);
+            cmndf_[tau_] = running_sum_ ? float(d) * tau_ / float(running_sum_) : 1.0f;
+
+            // Below the threshold, and past its minimum?
+            if (!best_ && tau_ > 1 && cmndf_[tau_ - 1] < threshold_ && cmndf_[tau_] >= cmndf_[tau_ - 1])
+                best_ = tau_ - 1;
+            if (best_) {
+                ++tau_;
+                break;
+            }
+        }
+
+        if (best_ || tau_ >= max_lag) {
+            Finish();
+            busy_ = false;
+        }
+        return !busy_;
+    }
+
+    /* Analyse buffer() in one go */
+    float Run() {
+        Start();
+        while (!Step(max_lag)) { }
+        return result_;
+    }
+
+    /* The period, in samples, or 0 if there wasn't a clear one */
+    float period() const { return result_; }
+    int lag() const { return best_; }
+
+    /* d'(tau) at the period: near 0 for a clean periodic signal */
+    float aperiodicity() const { return best_ ? cmndf_[best_] : 1.0f; }
+
+    void set_threshold(float threshold) { threshold_ = threshold; }
+
+private:
+    T x_[BUFFER_SIZE];
+    float d_[max_lag];
+    float cmndf_[max_lag];
+    float threshold_ = 0.15f;
+
+    int tau_ = 1;
+    int64_t running_sum_ = 0;
+    int best_ = 0;
+    float result_ = 0.0f;
+    bool busy_ = false;
+
+    void Finish() {
+        // d' finds the period, but d itself is the better shape to interpolate
+        // A dip that hasn't come back up by the last lag still counts
+        if (!best_ && tau_ >= max_lag && max_lag > 2 && cmndf_[max_lag - 1] < threshold_)
+            best_ = max_lag - 1;
+        if (!best_) {
+            result_ = 0.0f;
+            return;
+        }
+
+        float shift = 0.0f;
+        if (best_ > 1 && best_ < tau_ - 1) {
+            const float a = d_[best_ - 1], b = d_[best_], c = d_[best_ + 1];
+            const float denominator = a - 2.0f * b + c;
+            if (denominator > 0.0f) shift = 0.5f * (a - c) / denominator;
+        }
+        result_ = best_ + shift;
+    }
+};
+
+/* How many of these FreqMeasure periods make up one cycle, given the lag a detector found in
+ * them. A period that falls between two counts comes out as a pattern of whole counts, such as
+ * N, N + 1, N, N + 1, which looks just like an input that triggers twice per cycle. So a lag
+ * only counts when the periods stray further than jitter counts from their mean.
+ */
+template <typename T>
+int PeriodsPerCycle(const T *x, int n, int lag, int32_t jitter) {
+    if (lag <= 1) return 1;
+    int64_t sum = 0;
+    for (int i = 0; i < n; ++i) sum += x[i];
+    for (int i = 0; i < n; ++i) {
+        const int64_t deviation = int64_t(x[i]) * n - sum;
+        if (deviation > int64_t(jitter) * n || -deviation > int64_t(jitter) * n) return lag;
+    }
+    return 1;
+}
+
+} // namespace HS
+
+#endif // HS_PITCH_DETECTOR_H
@@ -0,0 +1,97 @@
+/*
+ * A small memo of quantizer results, for pitches that come round again and again: arpeggios,
+ * sequences, and the upper voices of chords.
+ *
+ * Entries are keyed by the pitch being quantized, the root, a transpose, and a shape (a chord
+ * quality, say), and each holds a few results. A key can only go in one pair of entries, and
+ * a new key takes over the one of those used less recently, so a lookup is a hash and at most
+ * two compares. The results depend on the scale and mask, so whatever configures the
+ * quantizer also calls Invalidate().
+ */
+
+#ifndef HS_PITCH_MEMO_H
+#define HS_PITCH_MEMO_H
+
+#include <stdint.h>
+
+namespace HS {
+
+template <int values, int entries>
+class PitchMemo {
+public:
+    static_assert(entries > 1 && (entries & (entries - 1)) == 0, "entries must be a power of 2");
+
+    struct Key {
+        int32_t pitch;
+        int16_t root;
+        int8_t transpose;
+        uint8_t shape;
+
+        bool operator==(const Key &k) const {
+            return pitch == k.pitch && root == k.root && transpose == k.transpose && shape == k.shape;
+        }
+    };
+
+    void Invalidate() {
+        for (int i = 0; i < entries; ++i) entry_[i].valid = false;
+    }
+
+    /* The results for this key. On a miss the slot now belongs to it, for the caller to fill. */
+    int32_t *Get(const Key &key, bool &hit) {
+        Entry *pair = entry_ + (Slot(key) & ~1);
+        int way = 0;
+        hit = false;
+        for (; way < 2; ++way) {
+            if (pair[way].valid && pair[way].key == key) {
+                hit = true;
+                break;
+            }
+        }
+        if (hit) {
+            ++hits_;
+        } else {
+            ++misses_;
+            way = pair[0].recent ? 1 : 0;
+            pair[way].key = key;
+            pair[way].valid = true;
+        }
+        pair[way].recent = true;
+        pair[1 - way].recent = false;
+        return pair[way].value;
+    }
+
+    uint32_t hits() const { return hits_; }
+    uint32_t misses() const { return misses_; }
+
+    /* Hits as a percentage of lookups, or 0 before there have been any */
+    int hit_rate() const {
+        const uint32_t total = hits_ + misses_;
+        return total ? int(uint64_t(hits_) * 100 / total) : 0;
+    }
+
+private:
+    struct Entry {
+        Key key;
+        bool valid;
+        bool recent; // the more recently used of its pair
+        int32_t value[values];
+    };
+
+    Entry entry_[entries] = {};
+    uint32_t hits_ = 0;
+    uint32_t misses_ = 0;
+
+    static int Slot(const Key &key) {
+        uint32_t h = uint32_t(key.pitch) ^ (uint32_t(uint16_t(key.root)) << 16)
+                   ^ (uint32_t(uint8_t(key.transpose)) << 8) ^ (uint32_t(key.shape) << 24);
+        h *= 2654435761u; // Knuth's multiplicative hash; the top bits are the well mixed ones
+        return int(h >> (32 - SLOT_BITS));
+    }
+
+    static constexpr int Log2(int n) { return n > 1 ? 1 + Log2(n / 2) : 0; }
+    static constexpr int SLOT_BITS = Log2(entries);
+};
+
+} // namespace HS
+
+#endif // HS_PITCH_MEMO_H
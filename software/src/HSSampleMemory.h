@@ -0,0 +1,176 @@
+/*
+ * Sample memory shared by the applets, so buffers come from one pool of fixed-size blocks.
+ *
+ * Each applet slot asks for as many contiguous blocks as it needs, and gives them all back when
+ * it's done. A slot holds one allocation at a time, and asking again replaces it. Allocating
+ * searches the block map, so only do it from the UI side (Start, encoder moves, loading
+ * presets), never from Controller().
+ *
+ * The firmware's pool has no memory of its own: it takes it from the heap when the first block
+ * is asked for, and gives it back when the last one is released, so it costs nothing while no
+ * applet is using it.
+ *
+ * PackedSamples12 stores 12-bit samples two to every three bytes.
+ */
+
+#ifndef HS_SAMPLE_MEMORY_H
+#define HS_SAMPLE_MEMORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace HS {
+
+class SamplePool {
+public:
+    static constexpr int MAX_BLOCKS = 64;
+    static constexpr int MAX_OWNERS = 4;
+
+    struct Stats {
+        int blocks; // in the pool
+        int used;
+        int peak; // most ever used at once
+        int failed; // requests that didn't fit
+    };
+
+    /* With no mem, size bytes come from the heap while any block is held */
+    SamplePool(uint8_t *mem, size_t size, size_t block_size)
+        : mem_(mem), owns_mem_(mem == nullptr), block_size_(block_size) {
+        blocks_ = size / block_size;
+        if (blocks_ > MAX_BLOCKS) blocks_ = MAX_BLOCKS;
+        for (int b = 0; b < MAX_BLOCKS; ++b) owner_[b] = FREE;
+        for (int o = 0; o < MAX_OWNERS; ++o) held_[o] = 0;
+    }
+
+    ~SamplePool() {
+        if (owns_mem_) free(mem_);
+    }
+
+    size_t block_size() const { return block_size_; }
+    size_t size() const { return blocks_ * block_size_; }
+
+    /* Whether the pool has its memory right now */
+    bool allocated() const { return mem_ != nullptr; }
+
+    /* At least bytes of memory for owner, or nullptr if there isn't a run of blocks that long */
+    uint8_t *Acquire(int owner, size_t bytes) {
+        if (owner < 0 || owner >= MAX_OWNERS) return nullptr;
+        ReleaseBlocks(owner);
+
+        const int count = (bytes + block_size_ - 1) / block_size_;
+        if (count == 0) {
+            FreeIfUnused();
+            return nullptr;
+        }
+        if (!mem_) mem_ = static_cast<uint8_t *>(malloc(size()));
+
+        // First fit
+        int run = 0;
+        for (int b = 0; mem_ && b < blocks_; ++b) {
+            run = (owner_[b] == FREE) ? run + 1 : 0;
+            if (run == count) {
+                const int first = b - count + 1;
+                for (int i = first; i <= b; ++i) owner_[i] = owner;
+                held_[owner] = count;
+                used_ += count;
+                if (used_ > peak_) peak_ = used_;
+                return mem_ + first * block_size_;
+            }
+        }
+        ++failed_;
+        FreeIfUnused();
+        return nullptr;
+    }
+
+    void Release(int owner) {
+        ReleaseBlocks(owner);
+        FreeIfUnused();
+    }
+
+    /* Blocks held by owner */
+    int Held(int owner) const {
+        return (owner < 0 || owner >= MAX_OWNERS) ? 0 : held_[owner];
+    }
+
+    /* The longest allocation that would succeed right now, in bytes */
+    size_t Largest() const {
+        int run = 0, longest = 0;
+        for (int b = 0; b < blocks_; ++b) {
+            run = (owner_[b] == FREE) ? run + 1 : 0;
+            if (run > longest) longest = run;
+        }
+        return longest * block_size_;
+    }
+
+    Stats stats() const {
+        return Stats{ blocks_, used_, peak_, failed_ };
+    }
+
+private:
+    static constexpr int8_t FREE = -1;
+
+    uint8_t *mem_;
+    bool owns_mem_; // taken from the heap, and given back when no blocks are held
+    size_t block_size_;
+    int blocks_;
+    int8_t owner_[MAX_BLOCKS];
+    int held_[MAX_OWNERS];
+    int used_ = 0;
+    int peak_ = 0;
+    int failed_ = 0;
+
+    void ReleaseBlocks(int owner) {
+        if (owner < 0 || owner >= MAX_OWNERS || !held_[owner]) return;
+        for (int b = 0; b < blocks_; ++b) {
+            if (owner_[b] == owner) owner_[b] = FREE;
+        }
+        used_ -= held_[owner];
+        held_[owner] = 0;
+    }
+
+    void FreeIfUnused() {
+        if (owns_mem_ && mem_ && !used_) {
+            free(mem_);
+            mem_ = nullptr;
+        }
+    }
+};
+
+// 12-bit samples, -2048..2047, in 3 bytes per pair
+class PackedSamples12 {
+public:
+    static constexpr size_t BytesFor(size_t samples) {
+        return (samples * 3 + 1) / 2;
+    }
+
+    PackedSamples12(uint8_t *mem = nullptr) : mem_(mem) { }
+
+    int16_t Get(size_t i) const {
+        const uint8_t *p = mem_ + (i >> 1) * 3;
+        uint16_t raw = (i & 1) ? (p[1] >> 4) | (p[2] << 4) : p[0] | ((p[1] & 0x0f) << 8);
+        return int16_t(raw << 4) >> 4;
+    }
+
+    void Set(size_t i, int16_t value) {
+        uint8_t *p = mem_ + (i >> 1) * 3;
+        const uint16_t raw = value & 0x0fff;
+        if (i & 1) {
+            p[1] = (p[1] & 0x0f) | ((raw & 0x0f) << 4);
+            p[2] = raw >> 4;
+        } else {
+            p[0] = raw & 0xff;
+            p[1] = (p[1] & 0xf0) | (raw >> 8);
+        }
+    }
+
+private:
+    uint8_t *mem_;
+};
+
+// The firmware's pool, in HemisphereApplet.cpp
+extern SamplePool sample_pool;
+
+} // namespace HS
+
+#endif // HS_SAMPLE_MEMORY_H
@@ -0,0 +1,186 @@
+/*
+ * Triggered capture for the Scope applet.
+ *
+ * Every tick, both inputs are folded into the current column as a min and a max, so a spike
+ * shorter than a column still shows as a line. Columns go into a ring that keeps running while
+ * waiting for a trigger, which is where the pre-trigger part of the display comes from. The
+ * trigger is checked on every tick, not every column. Crossing the level needs the signal to
+ * have been a little way on the other side first, so noise around the level doesn't retrigger.
+ *
+ * Once the columns after the trigger are in, the ring is copied out in order, for drawing.
+ * Normal mode then arms again; single mode waits for Arm().
+ */
+
+#ifndef HS_SCOPE_CAPTURE_H
+#define HS_SCOPE_CAPTURE_H
+
+#include <stdint.h>
+#include <string.h>
+
+namespace HS {
+
+class ScopeCapture {
+public:
+    static constexpr int COLUMNS = 128;
+    static constexpr int HYSTERESIS = 4;
+
+    enum Mode { NORMAL, SINGLE };
+    enum Slope { RISING, FALLING };
+    enum State { ARMED, TRIGGERED, DONE };
+
+    void Init() {
+        memset(ring_min_, 0, sizeof(ring_min_));
+        memset(ring_max_, 0, sizeof(ring_max_));
+        memset(min_, 0, sizeof(min_));
+        memset(max_, 0, sizeof(max_));
+        frames_ = 0;
+        Arm();
+    }
+
+    /* Start looking for a trigger again, with a fresh pre-trigger history */
+    void Arm() {
+        state_ = ARMED;
+        filled_ = 0;
+        tick_ = 0;
+        primed_ = false;
+        StartColumn();
+    }
+
+    void set_mode(Mode mode) { mode_ = mode; }
+    void set_slope(Slope slope) { slope_ = slope; }
+    void set_level(uint8_t level) { level_ = level; }
+    void set_source(int ch) { source_ = ch & 1; }
+    void set_ticks_per_column(int ticks) { ticks_per_column_ = ticks < 1 ? 1 : ticks; }
+    void set_pre_trigger(int columns) {
+        pre_ = columns < 0 ? 0 : (columns > COLUMNS - 1 ? COLUMNS - 1 : columns);
+    }
+
+    /* One tick of both inputs, scaled to 0..255 */
+    void Process(uint8_t a, uint8_t b) {
+        if (state_ == DONE) return;
+
+        const uint8_t in[2] = {a, b};
+        for (int ch = 0; ch < 2; ++ch) {
+            if (in[ch] < col_min_[ch]) col_min_[ch] = in[ch];
+            if (in[ch] > col_max_[ch]) col_max_[ch] = in[ch];
+        }
+
+        if (state_ == ARMED && Edge(in[source_]) && filled_ >= pre_) {
+            state_ = TRIGGERED;
+            post_ = COLUMNS - pre_; // including this one
+        }
+
+        if (++tick_ < ticks_per_column_) return;
+
+        // Next column
+        tick_ = 0;
+        ring_min_[0][write_] = col_min_[0];
+        ring_max_[0][write_] = col_max_[0];
+        ring_min_[1][write_] = col_min_[1];
+        ring_max_[1][write_] = col_max_[1];
+        write_ = (write_ + 1) % COLUMNS;
+        if (filled_ < COLUMNS) ++filled_;
+        StartColumn();
+
+        if (state_ == TRIGGERED && --post_ == 0) {
+            // Oldest first, which puts the trigger at column pre_
+            const int older = COLUMNS - write_;
+            for (int ch = 0; ch < 2; ++ch) {
+                memcpy(min_[ch], ring_min_[ch] + write_, older);
+                memcpy(min_[ch] + older, ring_min_[ch], write_);
+                memcpy(max_[ch], ring_max_[ch] + write_, older);
+                memcpy(max_[ch] + older, ring_max_[ch], write_);
+            }
+            trigger_column_ = pre_;
+            ++frames_;
+            state_ = (mode_ == SINGLE) ? DONE : ARMED;
+            primed_ = false;
+        }
+    }
+
+    State state() const { return state_; }
+    uint32_t frames() const { return frames_; } // captures completed
+    int trigger_column() const { return trigger_column_; }
+    uint8_t level() const { return level_; }
+    const uint8_t *min(int ch) const { return min_[ch & 1]; }
+    const uint8_t *max(int ch) const { return max_[ch & 1]; }
+
+private:
+    Mode mode_ = NORMAL;
+    Slope slope_ = RISING;
+    State state_ = ARMED;
+    uint8_t level_ = 128;
+    int source_ = 0;
+    int ticks_per_column_ = 1;
+    int pre_ = COLUMNS / 4;
+
+    int tick_ = 0; // in the current column
+    int filled_ = 0; // columns in the ring since arming
+    int write_ = 0;
+    int post_ = 0; // columns still to come after the trigger
+    bool primed_ = false; // been far enough on the other side of the level to cross it
+    uint8_t col_min_[2];
+    uint8_t col_max_[2];
+    uint8_t ring_min_[2][COLUMNS];
+    uint8_t ring_max_[2][COLUMNS];
+
+    // The last complete capture
+    uint8_t min_[2][COLUMNS];
+    uint8_t max_[2][COLUMNS];
+    int trigger_column_ = 0;
+    uint32_t frames_ = 0;
+
+    void StartColumn() {
+        col_min_[0] = col_min_[1] = 255;
+        col_max_[0] = col_max_[1] = 0;
+    }
+
+    bool Edge(uint8_t v) {
+        if (slope_ == RISING) {
+            if (v + HYSTERESIS <= level_) primed_ = true;
+            else if (primed_ && v >= level_) {
+                primed_ = false;
+                return true;
+            }
+        } else {
+            if (v >= level_ + HYSTERESIS) primed_ = true;
+            else if (primed_ && v <= level_) {
+                primed_ = false;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+/* The Scope applet's saved settings. Saves from before it had any are all 0, so the level and
+ * pre-trigger are stored relative to their defaults, and a 0 field restores the default. */
+struct ScopeSettings {
+    static constexpr int DEFAULT_LEVEL = 128;
+    static constexpr int DEFAULT_PRE_TRIGGER = 20; // % of the display
+
+    int mode; // 0..3
+    int level; // 0..255
+    int slope; // 0..1
+    int pre_trigger; // 0..127
+
+    uint64_t Save() const {
+        return uint64_t(mode & 0x3)
+             | uint64_t((level - DEFAULT_LEVEL) & 0xff) << 2
+             | uint64_t(slope & 0x1) << 10
+             | uint64_t((pre_trigger - DEFAULT_PRE_TRIGGER) & 0x7f) << 11;
+    }
+
+    static ScopeSettings Restore(uint64_t data) {
+        ScopeSettings s;
+        s.mode = int(data & 0x3);
+        s.level = int(((data >> 2) + DEFAULT_LEVEL) & 0xff);
+        s.slope = int((data >> 10) & 0x1);
+        s.pre_trigger = int(((data >> 11) + DEFAULT_PRE_TRIGGER) & 0x7f);
+        return s;
+    }
+};
+
+} // namespace HS
+
+#endif // HS_SCOPE_CAPTURE_H
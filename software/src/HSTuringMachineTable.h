@@ -0,0 +1,126 @@
+/*
+ * Precomputed playback for Turing Machines, for ENIGMA's song mode.
+ *
+ * A locked machine (probability 0, or a favorite) plays a fixed sequence. Each step shifts the
+ * register left and feeds the bit at len - 1 back into bit 0. Once the 16 bits it started
+ * with have been shifted out, which takes at most 16 steps, the register repeats every len
+ * steps. So 32 steps cover any machine: the start, and then a loop back to step 32 - len.
+ *
+ * A table holds the register for each of those steps and what every output sends for it.
+ * Playback is then a table index, and quantizing only happens when a table is built. Tables
+ * are keyed by the starting register and length, so editing a machine in the library simply
+ * misses the old table. Editing the outputs means calling Invalidate().
+ */
+
+#ifndef HS_TURING_MACHINE_TABLE_H
+#define HS_TURING_MACHINE_TABLE_H
+
+#include <stdint.h>
+
+namespace HS {
+
+template <int outputs>
+struct TuringMachineTable {
+    static constexpr int STEPS = 32;
+
+    uint16_t reg; // at step 0
+    uint8_t len; // 0 for an unused table
+    uint8_t age; // since last used, for the cache
+
+    uint16_t step_reg[STEPS];
+    int16_t value[STEPS][outputs];
+
+    /* value_of(o, reg) is what output o sends for that register */
+    template <typename F>
+    void Build(uint16_t reg_, uint8_t len_, F value_of) {
+        reg = reg_;
+        len = len_;
+        uint16_t r = reg_;
+        for (int s = 0; s < STEPS; ++s) {
+            step_reg[s] = r;
+            for (int o = 0; o < outputs; ++o) value[s][o] = int16_t(value_of(o, r));
+            r = uint16_t((r << 1) | ((r >> (len_ - 1)) & 1));
+        }
+    }
+
+    /* The step after this one */
+    int Next(int step) const {
+        return ++step < STEPS ? step : STEPS - len;
+    }
+};
+
+template <int outputs, int entries>
+class TuringMachineTableCache {
+public:
+    typedef TuringMachineTable<outputs> Table;
+
+    /* Needed when it lives in DMAMEM, and whenever the outputs change */
+    void Invalidate() {
+        for (int i = 0; i < entries; ++i) {
+            table_[i].len = 0;
+            table_[i].age = 0;
+        }
+    }
+
+    /* The table for a machine with this register and length (1-16), built if needed */
+    template <typename F>
+    const Table *Get(uint16_t reg, uint8_t len, F value_of) {
+        int found = -1;
+        int oldest = 0;
+        for (int i = 0; i < entries; ++i) {
+            Table &t = table_[i];
+            if (t.len == len && t.reg == reg) found = i;
+            if (t.age < 0xff) ++t.age;
+            if (t.len == 0 || (table_[oldest].len && t.age > table_[oldest].age)) oldest = i;
+        }
+        if (found < 0) {
+            ++misses_;
+            found = oldest;
+            table_[found].Build(reg, len, value_of);
+        } else {
+            ++hits_;
+        }
+        table_[found].age = 0;
+        return &table_[found];
+    }
+
+    /* Where a track is in a machine's table. A table can be rebuilt for another machine while
+     * the track plays, so it keeps the key to check. No table means it isn't using one. */
+    struct Playback {
+        const Table *table;
+        uint16_t reg;
+        uint8_t len;
+        uint8_t step;
+    };
+
+    template <typename F>
+    void Start(Playback &p, uint16_t reg, uint8_t len, F value_of) {
+        p.table = Get(reg, len, value_of);
+        p.reg = reg;
+        p.len = len;
+        p.step = 0;
+    }
+
+    void Stop(Playback &p) { p.table = nullptr; }
+
+    /* Its table, found again if that one has been reused */
+    template <typename F>
+    const Table *Find(Playback &p, F value_of) {
+        if (p.table->len != p.len || p.table->reg != p.reg) p.table = Get(p.reg, p.len, value_of);
+        return p.table;
+    }
+
+    void Advance(Playback &p) { p.step = uint8_t(p.table->Next(p.step)); }
+
+    uint32_t hits() const { return hits_; }
+    uint32_t misses() const { return misses_; }
+
+private:
+    Table table_[entries];
+    uint32_t hits_ = 0;
+    uint32_t misses_ = 0;
+};
+
+} // namespace HS
+
+#endif // HS_TURING_MACHINE_TABLE_H
@@ -299,6 +299,12 @@ void OC::AudioDSP::DrawAudioSetup() {
       case WAVEFOLDER:
         mod_target = WAVEFOLD_MOD;
         break;
+      case VECTOR_OSC:
+        mod_target = OSC_PITCH;
+        break;
+      case AUDIO_APPLET:
+        mod_target = APPLET_CV;
+        break;
     }
 
     // Channel mode
@@ -309,8 +315,16 @@ void OC::AudioDSP::DrawAudioSetup() {
     gfxPrint(8 + 82*ch, 35, "Map");
     gfxPrint(8 + 82*ch, 45, OC::Strings::cv_input_names_none[ mod_map[ch][mod_target] + 1 ] );
 
+    // Oscillator waveform, user (U) or library (L)
+    if (mode[ch] == VECTOR_OSC) {
+      gfxPrint(8 + 82*ch, 55, osc_waveform[ch] < 32 ? "U" : "L");
+      gfxPrint(osc_waveform[ch] % 32 + 1);
+    }
+    if (mode[ch] == AUDIO_APPLET)
+      gfxPrint(8 + 82*ch, 55, AppletName(ch));
+
     // cursor
-    gfxIcon(120*ch, 25 + audio_cursor[ch]*20, ch ? LEFT_ICON : RIGHT_ICON);
+    gfxIcon(120*ch, audio_cursor[ch] < 2 ? 25 + audio_cursor[ch]*20 : 55, ch ? LEFT_ICON : RIGHT_ICON);
   }
 
   // Reverb params (size, damping, level?)
@@ -414,6 +428,23 @@ void gfxIcon(int x, int y, const uint8_t *data) {
     gfxBitmap(x, y, 8, data);
 }
 
+// Large numerals, see src/drivers/weegfx_fonts.h
+int gfxGlyphs(const weegfx::GlyphFont &font, int x, int y, const char *str) {
+    return graphics.drawGlyphs(font, x, y, str);
+}
+
+int gfxGlyphs(const weegfx::GlyphFont &font, int x, int y, int num) {
+    return graphics.drawGlyphs(font, x, y, num);
+}
+
+void gfxGlyphsRight(const weegfx::GlyphFont &font, int x, int y, const char *str) {
+    graphics.drawGlyphsRight(font, x, y, str);
+}
+
+void gfxGlyphsRight(const weegfx::GlyphFont &font, int x, int y, int num) {
+    graphics.drawGlyphsRight(font, x, y, num);
+}
+
 void gfxHeader(const char *str, const uint8_t *icon) {
   int x = 1;
   if (icon) {
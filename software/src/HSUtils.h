@@ -1,6 +1,7 @@
 #pragma once
 
 #include "OC_scales.h"
+#include "src/drivers/weegfx_fonts.h"
 
 // misc. utility functions extracted from Hemisphere
 // -NJM
@@ -155,6 +156,10 @@ void gfxCircle(int x, int y, int r);
 void gfxBitmap(int x, int y, int w, const uint8_t *data);
 void gfxIcon(int x, int y, const uint8_t *data);
 void gfxHeader(const char *str, const uint8_t *icon = nullptr);
+int gfxGlyphs(const weegfx::GlyphFont &font, int x, int y, const char *str);
+int gfxGlyphs(const weegfx::GlyphFont &font, int x, int y, int num);
+void gfxGlyphsRight(const weegfx::GlyphFont &font, int x, int y, const char *str);
+void gfxGlyphsRight(const weegfx::GlyphFont &font, int x, int y, int num);
 
 static constexpr uint8_t pad(int range, int number) {
     uint8_t padding = 0;
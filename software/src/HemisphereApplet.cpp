@@ -3,8 +3,17 @@
 HS::IOFrame HS::frame;
 HS::ClockManager HS::clock_m;
 
+// Taken from the heap only while an applet holds some of it
+#if defined(__IMXRT1062__)
+HS::SamplePool HS::sample_pool(nullptr, 96 * 1024, 4096);
+#else
+// Enough for a DrLoFi on each side
+HS::SamplePool HS::sample_pool(nullptr, 4 * 1024, 1024);
+#endif
+
 int HemisphereApplet::cursor_countdown[APPLET_SLOTS];
 const char* HemisphereApplet::help[HELP_LABEL_COUNT];
+HS::ViewCache HemisphereApplet::view_cache[2];
 
 void HemisphereApplet::BaseController() {
     // I moved the IO-related stuff to the parent HemisphereManager app.
@@ -12,17 +21,42 @@ void HemisphereApplet::BaseController() {
     // -NJM
 
     // Cursor countdowns. See CursorBlink(), ResetCursor(), gfxCursor()
-    if (--cursor_countdown[hemisphere] < -HEMISPHERE_CURSOR_TICKS) cursor_countdown[hemisphere] = HEMISPHERE_CURSOR_TICKS;
+    if (--cursor_countdown[hemisphere] < -HEMISPHERE_CURSOR_TICKS) ResetCursor();
+    else if (cursor_countdown[hemisphere] == 0) ViewChanged(); // blink off
+
+    // mapped CV inputs moving is visible in most applets
+    ForEachChannel(ch) {
+        const int c = cvmapping[ch + io_offset];
+        if (c && c <= ADC_CHANNEL_LAST && frame.changed_cv[c - 1]) ViewChanged();
+    }
 
     Controller();
 }
 
 void HemisphereApplet::BaseView(bool full_screen) {
+    HS::ViewCache &cache = view_cache[hemisphere % 2];
+    const bool cached = !full_screen && CachedView();
+
+    // Nothing visible has changed, reuse the pixels from last time
+    if (cached && cache.applet == this && cache.generation == view_generation) {
+        graphics.writeColumns(gfx_offset, 64, cache.pixels);
+        return;
+    }
+
+    // sample before drawing, so a bump from the ISR during View() triggers a redraw
+    const uint32_t generation = view_generation;
+
     //if (HS::select_mode == hemisphere)
     gfxHeader(applet_name(), (HS::ALWAYS_SHOW_ICONS || full_screen) ? applet_icon() : nullptr);
     // If active, draw the full screen view instead of the application screen
     if (full_screen) this->DrawFullScreen();
     else this->View();
+
+    if (cached) {
+        graphics.readColumns(gfx_offset, 64, cache.pixels);
+        cache.applet = this;
+        cache.generation = generation;
+    }
 }
 
 /*
@@ -63,6 +97,7 @@ bool HemisphereApplet::Clock(int ch, bool physical) {
     clocked = clocked || clock_m.Beep(virt_chan);
 
     if (clocked) {
+        ViewChanged();
         frame.cycle_ticks[io_offset + ch] = OC::CORE::ticks - frame.last_clock[io_offset + ch];
         frame.last_clock[io_offset + ch] = OC::CORE::ticks;
     }
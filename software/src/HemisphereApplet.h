@@ -44,6 +44,7 @@
 
 #include "HSUtils.h"
 #include "HSIOFrame.h"
+#include "HSSampleMemory.h"
 
 class HemisphereApplet;
 
@@ -58,6 +59,14 @@ typedef struct Applet {
 extern IOFrame frame;
 
 static constexpr bool ALWAYS_SHOW_ICONS = false;
+
+// Pixels of the last View() drawn on one half of the screen, tagged with the
+// applet and view generation that produced them.
+typedef struct ViewCache {
+  const HemisphereApplet *applet;
+  uint32_t generation;
+  uint8_t pixels[64 * 8];
+} ViewCache;
 } // namespace HS
 
 using namespace HS;
@@ -66,6 +75,7 @@ class HemisphereApplet {
 public:
     static int cursor_countdown[APPLET_SLOTS];
     static const char* help[HELP_LABEL_COUNT];
+    static HS::ViewCache view_cache[2]; // one per half-screen
 
     virtual const char* applet_name() = 0; // Maximum of 9 characters
     virtual const uint8_t* applet_icon() { return nullptr; }
@@ -88,6 +98,7 @@ public:
 
     void BaseStart(const HEM_SIDE hemisphere_) {
         hemisphere = hemisphere_;
+        ViewChanged();
 
         // Initialize some things for startup
         cursor_countdown[hemisphere] = HEMISPHERE_CURSOR_TICKS;
@@ -103,6 +114,15 @@ public:
     }
     virtual void Unload() { }
 
+    /* View caching: applets that return true here promise that View() output
+     * only changes when the view generation does. The base class bumps it for
+     * output changes, clocks, CV input changes, cursor movement and blinking;
+     * the managers bump it for UI events and data loads. Anything else that
+     * shows up on screen must call ViewChanged() itself.
+     */
+    virtual bool CachedView() { return false; }
+    void ViewChanged() { ++view_generation; }
+
     // Screensavers are deprecated in favor of screen blanking, but the BaseScreensaverView() remains
     // to avoid breaking applets based on the old boilerplate
     void BaseScreensaverView() {}
@@ -159,7 +179,10 @@ public:
 
     /* Check cursor blink cycle. */
     bool CursorBlink() { return (cursor_countdown[hemisphere] > 0); }
-    void ResetCursor() { cursor_countdown[hemisphere] = HEMISPHERE_CURSOR_TICKS; }
+    void ResetCursor() {
+      cursor_countdown[hemisphere] = HEMISPHERE_CURSOR_TICKS;
+      ViewChanged();
+    }
 
     // legacy cursor mode has been removed
     [[deprecated("Use CursorToggle() instead")]] void CursorAction(int &cursor, int max) {
@@ -222,7 +245,10 @@ public:
         return (t <= offset) ? frame.gate_high[t - 1] : (frame.outputs[t - 1 - offset] > GATE_THRESHOLD);
     }
     void Out(int ch, int value, int octave = 0) {
-        frame.Out( (DAC_CHANNEL)(ch + io_offset), value + (octave * (12 << 7)));
+        const DAC_CHANNEL channel = (DAC_CHANNEL)(ch + io_offset);
+        value += octave * (12 << 7);
+        if (value != frame.outputs[channel]) ViewChanged();
+        frame.Out(channel, value);
     }
 
     void SmoothedOut(int ch, int value, int kSmoothing) {
@@ -234,6 +260,7 @@ public:
     }
     void ClockOut(const int ch, const int ticks = HEMISPHERE_CLOCK_TICKS * trig_length) {
         frame.ClockOut( (DAC_CHANNEL)(io_offset + ch), ticks);
+        ViewChanged();
     }
 
     void GateOut(int ch, bool high) {
@@ -433,6 +460,21 @@ public:
         gfxPos(gfxGetPrintPosX() + w, gfxGetPrintPosY());
     }
 
+    // Large numerals, see src/drivers/weegfx_fonts.h
+    // @return x position after the last glyph
+    int gfxGlyphs(const weegfx::GlyphFont &font, int x, int y, const char *str) {
+        return graphics.drawGlyphs(font, x + gfx_offset, y, str) - gfx_offset;
+    }
+    int gfxGlyphs(const weegfx::GlyphFont &font, int x, int y, int num) {
+        return graphics.drawGlyphs(font, x + gfx_offset, y, num) - gfx_offset;
+    }
+    void gfxGlyphsRight(const weegfx::GlyphFont &font, int x, int y, const char *str) {
+        graphics.drawGlyphsRight(font, x + gfx_offset, y, str);
+    }
+    void gfxGlyphsRight(const weegfx::GlyphFont &font, int x, int y, int num) {
+        graphics.drawGlyphsRight(font, x + gfx_offset, y, num);
+    }
+
     //////////////// Hemisphere-specific graphics methods
     ////////////////////////////////////////////////////////////////////////////////
 
@@ -503,6 +545,7 @@ protected:
 
 private:
     bool applet_started; // Allow the app to maintain state during switching
+    volatile uint32_t view_generation = 0;
     int16_t cursor_start_x;
     int16_t cursor_start_y;
 };
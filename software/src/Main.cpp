@@ -39,6 +39,7 @@
 #include "OC_ui.h"
 #include "OC_options.h"
 #include "src/drivers/display.h"
+#include "src/drivers/spi_arbiter.h"
 #include "src/drivers/ADC/OC_util_ADC.h"
 #include "util/util_debugpins.h"
 #include "VBiasManager.h"
@@ -83,9 +84,14 @@ void FASTRUN CORE_timer_ISR() {
   // DAC and display share SPI. By first updating the DAC values, then starting
   // a DMA transfer to the display things are fairly nicely interleaved. In the
   // next ISR, the display transfer is finalized (CS update).
+  // The arbiter keeps display transfers from spilling into the DAC slot, and
+  // chains more subpages into the rest of the tick where possible.
 
+  SPIArbiter::BeginTick();
   display::Flush();
+  SPIArbiter::BeginDAC();
   OC::DAC::Update();
+  SPIArbiter::EndDAC();
   display::Update();
 
   // see OC_ADC.h for details; empirically (with current parameters), Scan_DMA() picks up new samples @ 5.55kHz
@@ -105,6 +111,7 @@ void FASTRUN CORE_timer_ISR() {
     OC::apps::ISR();
 
   OC_DEBUG_RESET_CYCLES(OC::CORE::ticks, 16384, OC::DEBUG::ISR_cycles);
+  SPIArbiter::EndTick();
 }
 
 /*       ---------------------------------------------------------         */
@@ -179,6 +186,13 @@ void setup() {
   display::AdjustOffset(OC::calibration_data.display_offset);
   display::SetFlipMode( OC::calibration_data.flipscreen() );
   display::Init();
+#if defined(__IMXRT1062__)
+  // Subpage completion is ISR-driven, so the display can fill the bus
+  SPIArbiter::Init(F_CPU / OC_CORE_ISR_FREQ, display::Fill);
+#else
+  SPIArbiter::Init(F_CPU / OC_CORE_ISR_FREQ, nullptr);
+#endif
+  display::SetFrameRate(static_cast<display::FrameRate>(OC::calibration_data.frame_rate));
 
   GRAPHICS_BEGIN_FRAME(true);
   GRAPHICS_END_FRAME();
@@ -234,8 +248,8 @@ void FASTRUN loop() {
       ui_mode = OC::UI_MODE_MENU;
     }
 
-    // Refresh display
-    if (MENU_REDRAW) {
+    // Refresh display, paced to the configured frame rate
+    if (MENU_REDRAW && display::frame_pacer.due(micros())) {
       GRAPHICS_BEGIN_FRAME(false); // Don't busy wait
         if (OC::UI_MODE_MENU == ui_mode) {
           OC_DEBUG_RESET_CYCLES(menu_redraws, 512, OC::DEBUG::MENU_draw_cycles);
@@ -254,12 +268,17 @@ void FASTRUN loop() {
         }
         MENU_REDRAW = 0;
         LAST_REDRAW_TIME = millis();
+        display::frame_pacer.Rendered(micros(), display::frame_stats);
       GRAPHICS_END_FRAME();
     }
 
     // Run current app
     OC::apps::current_app->loop();
 
+#if defined(__IMXRT1062__) && defined(ARDUINO_TEENSY41)
+    OC::AudioDSP::Idle();
+#endif
+
     // UI events
     OC::UiMode mode = OC::ui.DispatchEvents(OC::apps::current_app);
 
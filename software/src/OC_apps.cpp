@@ -183,7 +183,8 @@ struct GlobalSettings {
 
   OC::Scale user_scales[OC::Scales::SCALE_USER_LAST];
   OC::Pattern user_patterns[OC::Patterns::PATTERN_USER_ALL];
-  // These both occupy 160 bytes
+  // These both occupy 160 bytes, with the default five banks of Turing Machines. More banks
+  // (ENIGMA_TM_BANKS) grow this struct, and change its layout, so saved settings reset once.
 #ifdef ENABLE_APP_CHORDS
   OC::Chord user_chords[OC::Chords::CHORDS_USER_LAST];
 #else
@@ -76,7 +76,8 @@ const CalibrationData kCalibrationDefaults = {
   SH1106_128x64_Driver::kDefaultOffset,
   OC_CALIBRATION_DEFAULT_FLAGS,
   SCREENSAVER_TIMEOUT_S, 
-  { 0, 0, 0 }, // reserved0
+  display::FRAME_RATE_60,
+  { 0, 0 }, // reserved0
   #ifdef VOR
   DAC::VBiasBipolar | (DAC::VBiasAsymmetric << 16) // default v_bias values
   #else
@@ -113,6 +114,9 @@ FLASHMEM void calibration_load() {
 
   if (!OC::calibration_data.screensaver_timeout)
     OC::calibration_data.screensaver_timeout = SCREENSAVER_TIMEOUT_S;
+
+  if (OC::calibration_data.frame_rate >= display::FRAME_RATE_LAST)
+    OC::calibration_data.frame_rate = display::FRAME_RATE_60;
 }
 
 FLASHMEM void calibration_save() {
@@ -137,6 +141,7 @@ const char * const start_footer   = "[CANCEL]         [OK]";
 const char * const end_footer     = "[PREV]         [EXIT]";
 const char * const default_footer = "[PREV]         [NEXT]";
 const char * const default_help_r = "[R] => Adjust";
+const char * const frame_rate_strings[] = { "60", "30", "15" };
 const char * const long_press_hint = "Hold [DOWN] to set";
 const char * const select_help    = "[R] => Select";
 
@@ -234,6 +239,7 @@ const CalibrationStep calibration_steps[CALIBRATION_STEP_LAST] = {
   
   // Changing screensaver to screen blank, and seconds to minutes
   { CALIBRATION_SCREENSAVER_TIMEOUT, "Screen Blank", "(minutes)", default_help_r, default_footer, CALIBRATE_SCREENSAVER, 0, nullptr, (OC::Ui::kLongPressTicks * 2 + 500) / 1000, SCREENSAVER_TIMEOUT_MAX_S },
+  { CALIBRATION_FRAME_RATE, "Display Rate", "Frames/s ", default_help_r, default_footer, CALIBRATE_FRAME_RATE, 0, frame_rate_strings, 0, display::FRAME_RATE_LAST - 1 },
 
   { CALIBRATION_EXIT, "Calibration complete", "Save values? ", select_help, end_footer, CALIBRATE_NONE, 0, OC::Strings::no_yes, 0, 1 }
 };
@@ -279,6 +285,13 @@ FLASHMEM void calibration_draw(const CalibrationState &state) {
       menu::DrawEditIcon(kValueX, y, state.encoder_value, step->min, step->max);
       break;
 
+    case CALIBRATE_FRAME_RATE:
+      graphics.print(step->message);
+      graphics.setPrintPos(kValueX, y + 2);
+      graphics.print(step->value_str[state.encoder_value]);
+      menu::DrawEditIcon(kValueX, y, state.encoder_value, step->min, step->max);
+      break;
+
     case CALIBRATE_DISPLAY:
       graphics.print(step->message);
       graphics.setPrintPos(kValueX, y + 2);
@@ -399,6 +412,10 @@ FLASHMEM void calibration_update(CalibrationState &state) {
       DAC::set_all_octave(0);
       OC::calibration_data.screensaver_timeout = state.encoder_value;
       break;
+    case CALIBRATE_FRAME_RATE:
+      OC::calibration_data.frame_rate = state.encoder_value;
+      display::SetFrameRate(static_cast<display::FrameRate>(OC::calibration_data.frame_rate));
+      break;
   }
 }
 
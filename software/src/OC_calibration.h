@@ -59,6 +59,7 @@ enum CALIBRATION_STEP {
 #endif
   ADC_PITCH_C2, ADC_PITCH_C4,
   CALIBRATION_SCREENSAVER_TIMEOUT,
+  CALIBRATION_FRAME_RATE,
   CALIBRATION_EXIT,
   CALIBRATION_STEP_LAST,
   CALIBRATION_STEP_FINAL = ADC_PITCH_C4
@@ -76,6 +77,7 @@ enum CALIBRATION_TYPE {
   CALIBRATE_ADC_3V,
   CALIBRATE_DISPLAY,
   CALIBRATE_SCREENSAVER,
+  CALIBRATE_FRAME_RATE,
 };
 
 struct CalibrationStep {
@@ -148,7 +150,8 @@ struct CalibrationData {
   uint8_t display_offset;
   uint32_t flags;
   uint8_t screensaver_timeout; // 0: default, else seconds
-  uint8_t reserved0[3];
+  uint8_t frame_rate; // display::FrameRate, 0: default (60fps)
+  uint8_t reserved0[2];
 #ifdef VOR
   /* less complicated this way than adding it to DAC::CalibrationData... */
   uint32_t v_bias;
@@ -9,10 +9,13 @@
 #include "OC_ui.h"
 #include "OC_strings.h"
 #include "util/util_misc.h"
+#include "HSSampleMemory.h"
+#include "src/drivers/spi_arbiter.h"
 #include "extern/dspinst.h"
 
 #ifdef ARDUINO_TEENSY41
 #include <Audio.h>
+#include "AudioSetup.h"
 
 extern "C" uint8_t external_psram_size;
 #endif
@@ -45,6 +48,18 @@ extern void QQ_debug();
 extern void ASR_debug();
 #endif // ASR_DEBUG
 
+#ifdef ENABLE_APP_NEURAL_NETWORK
+extern void NeuralNetwork_debug();
+#endif
+
+#ifdef ENABLE_APP_CHORDS
+extern void CHORDS_debug();
+#endif
+
+#ifdef ENABLE_APP_SEQUINS
+extern void SEQ_debug();
+#endif
+
 namespace OC {
 
 namespace DEBUG {
@@ -87,6 +102,36 @@ static void debug_menu_core() {
 #endif
 }
 
+static void debug_menu_spi() {
+  graphics.setPrintPos(2, 12);
+  graphics.printf("DAC@ %3lu/%3lu/%3lu",
+                  debug::cycles_to_us(SPIArbiter::dac_delay().min_value()),
+                  debug::cycles_to_us(SPIArbiter::dac_delay().value()),
+                  debug::cycles_to_us(SPIArbiter::dac_delay().max_value()));
+
+  graphics.setPrintPos(2, 22);
+  graphics.printf("DAC  %3lu/%3lu/%3lu",
+                  debug::cycles_to_us(SPIArbiter::dac_cycles().min_value()),
+                  debug::cycles_to_us(SPIArbiter::dac_cycles().value()),
+                  debug::cycles_to_us(SPIArbiter::dac_cycles().max_value()));
+
+#if defined(__IMXRT1062__)
+  graphics.setPrintPos(2, 32);
+  graphics.printf("DISP %3lu/%3lu/%3lu",
+                  debug::cycles_to_us(SPIArbiter::subpage_cycles().min_value()),
+                  debug::cycles_to_us(SPIArbiter::subpage_cycles().value()),
+                  debug::cycles_to_us(SPIArbiter::subpage_cycles().max_value()));
+#endif
+
+  graphics.setPrintPos(2, 42);
+  graphics.printf("BUS %2lu%% max %2lu%%",
+                  SPIArbiter::occupancy_percent(),
+                  (SPIArbiter::occupancy().max_value() * 100) / SPIArbiter::tick_cycles());
+
+  graphics.setPrintPos(2, 52);
+  graphics.printf("+%lu subpages", SPIArbiter::chained_subpages());
+}
+
 static void debug_menu_version()
 {
   graphics.setPrintPos(2, 12);
@@ -117,6 +162,16 @@ static void debug_menu_gfx() {
                   debug::cycles_to_us(DEBUG::MENU_draw_cycles.min_value()),
                   debug::cycles_to_us(DEBUG::MENU_draw_cycles.value()),
                   debug::cycles_to_us(DEBUG::MENU_draw_cycles.max_value()));
+
+  graphics.setPrintPos(2, 32);
+  graphics.printf("FPS %2lu R%lu D%lu",
+                  display::frame_pacer.fps(),
+                  display::frame_stats.rendered,
+                  display::frame_stats.displayed);
+  graphics.setPrintPos(2, 42);
+  graphics.printf("LATE %lu DROP %lu",
+                  display::frame_stats.late,
+                  display::frame_stats.dropped);
 }
 
 static void debug_menu_adc() {
@@ -155,6 +210,24 @@ static void debug_menu_adc() {
   graphics.printf("T1=%u T2=%u T3=%u T4=%u", trigz[0], trigz[1], trigz[2], trigz[3]);
 }
 
+// Applet sample memory: what's in use, by which slot, and what has been turned away
+static void debug_menu_sample_pool() {
+  const HS::SamplePool::Stats stats = HS::sample_pool.stats();
+  const int kb = HS::sample_pool.block_size() / 1024;
+  graphics.setPrintPos(2, 12);
+  graphics.printf("%d/%d x %dK, peak %d", stats.used, stats.blocks, kb, stats.peak);
+  graphics.setPrintPos(2, 22);
+  graphics.printf("Largest %uK", unsigned(HS::sample_pool.Largest() / 1024));
+  graphics.setPrintPos(2, 32);
+  graphics.printf("Failed %d", stats.failed);
+  graphics.setPrintPos(2, 42);
+  graphics.print("Slots");
+  for (int slot = 0; slot < HS::SamplePool::MAX_OWNERS; ++slot)
+    graphics.printf(" %d", HS::sample_pool.Held(slot));
+  graphics.setPrintPos(2, 52);
+  graphics.printf("Heap %uK", unsigned(HS::sample_pool.allocated() ? HS::sample_pool.size() / 1024 : 0));
+}
+
 #ifdef ARDUINO_TEENSY41
 static void debug_menu_adc_value() {
   graphics.setPrintPos(2, 12);
@@ -190,8 +263,35 @@ static void debug_menu_audio() {
   graphics.setPrintPos(2, 22);
   graphics.printf("Max CPU %2d.%02d%%", int(whole), part);
 
+  whole = OC::AudioDSP::ReverbUsage();
+  part = int(whole * 100) % 100;
+  graphics.setPrintPos(2, 32);
+  graphics.printf("Reverb %d.%02d%% max %d%%", int(whole), part,
+                  int(OC::AudioDSP::ReverbUsageMax() + 0.5f));
+
   graphics.setPrintPos(2, 42);
   graphics.printf("PSRAM: %2u MB", external_psram_size);
+
+  using OC::AudioDSP::mode;
+  whole = OC::AudioDSP::ModeUsageMax(mode[0], mode[1]);
+  part = int(whole * 100) % 100;
+  graphics.setPrintPos(2, 52);
+  graphics.printf("%s+%s max %d.%02d%%", OC::AudioDSP::mode_names[mode[0]],
+                  OC::AudioDSP::mode_names[mode[1]], int(whole), part);
+}
+
+// CPU of each audio applet slot, now and at most since it was last loaded
+static void debug_menu_audio_applets() {
+  for (int ch = 0; ch < 2; ++ch) {
+    const bool loaded = (OC::AudioDSP::mode[ch] == OC::AudioDSP::AUDIO_APPLET);
+    float whole = OC::AudioDSP::AppletUsage(ch);
+    int part = int(whole * 100) % 100;
+    graphics.setPrintPos(2, 12 + ch * 20);
+    graphics.printf("%c: %s", ch ? 'R' : 'L', loaded ? OC::AudioDSP::AppletName(ch) : "-");
+    graphics.setPrintPos(2, 22 + ch * 20);
+    graphics.printf("   %d.%02d%% max %d%%", int(whole), part,
+                    int(OC::AudioDSP::AppletUsageMax(ch) + 0.5f));
+  }
 }
 #endif
 
@@ -211,12 +311,15 @@ struct DebugMenu {
 
 static const DebugMenu debug_menus[] = {
   { " CORE", debug_menu_core },
+  { " SPI", debug_menu_spi },
   { " VERS", debug_menu_version },
   { " GFX", debug_menu_gfx },
   { " ADC (raw)", debug_menu_adc },
+  { " SAMPLE POOL", debug_menu_sample_pool },
 #ifdef ARDUINO_TEENSY41
   { " ADC (value)", debug_menu_adc_value },
   { " AUDIO", debug_menu_audio },
+  { " AUDIO APPLETS", debug_menu_audio_applets },
 #endif
 #ifdef POLYLFO_DEBUG  
   { " POLYLFO", POLYLFO_debug },
@@ -239,6 +342,15 @@ static const DebugMenu debug_menus[] = {
 #ifdef ASR_DEBUG  
   { " ASR", ASR_debug },
 #endif // ASR_DEBUG
+#ifdef ENABLE_APP_NEURAL_NETWORK
+  { " NEURAL NET", NeuralNetwork_debug },
+#endif
+#ifdef ENABLE_APP_CHORDS
+  { " CHORDS", CHORDS_debug },
+#endif
+#ifdef ENABLE_APP_SEQUINS
+  { " SEQ", SEQ_debug },
+#endif
 #ifdef PEWPEWPEW
   { " ", debug_menu_pewpewpew },
 #endif
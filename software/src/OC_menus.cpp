@@ -6,6 +6,7 @@
 #include "OC_menus.h"
 #include "OC_DAC.h"
 #include "OC_options.h"
+#include "OC_visualfx.h"
 #include "util/util_templates.h"
 
 namespace OC {
@@ -118,23 +119,45 @@ void scope_averaging() {
   }
 }
 
+// The scope only changes when a new averaged column is complete, so it draws
+// into a scrolling canvas instead of re-plotting all columns each frame.
+static vfx::ScrollingCanvas<64, kScopeDepth - 1> scope_canvas;
+static size_t scope_canvas_tail = kScopeDepth; // invalid, forces rebuild
+
+static void scope_draw_column(size_t index) {
+  #ifdef NORTHERNLIGHT
+    scope_canvas.SetNewest(0, 0 + averaged_scope_history[2][index]);
+    scope_canvas.SetNewest(1, 0 + averaged_scope_history[3][index]);
+    scope_canvas.SetNewest(0, 32 + averaged_scope_history[0][index]);
+    scope_canvas.SetNewest(1, 32 + averaged_scope_history[1][index]);
+  #else
+    scope_canvas.SetNewest(0, 0 + averaged_scope_history[0][index]);
+    scope_canvas.SetNewest(1, 0 + averaged_scope_history[1][index]);
+    scope_canvas.SetNewest(0, 32 + averaged_scope_history[2][index]);
+    scope_canvas.SetNewest(1, 32 + averaged_scope_history[3][index]);
+  #endif
+}
+
 void scope_render() {
   scope_averaging<11, 0x1f>();
 
-  for (weegfx::coord_t x = 0; x < (weegfx::coord_t)kScopeDepth - 1; ++x) {
-    size_t index = (x + averaged_scope_tail + 1) % kScopeDepth;
-    #ifdef NORTHERNLIGHT
-      graphics.setPixel(x, 0 + averaged_scope_history[2][index]);
-      graphics.setPixel(64 + x, 0 + averaged_scope_history[3][index]);
-      graphics.setPixel(x, 32 + averaged_scope_history[0][index]);
-      graphics.setPixel(64 + x, 32 + averaged_scope_history[1][index]);
-    #else
-      graphics.setPixel(x, 0 + averaged_scope_history[0][index]);
-      graphics.setPixel(64 + x, 0 + averaged_scope_history[1][index]);
-      graphics.setPixel(x, 32 + averaged_scope_history[2][index]);
-      graphics.setPixel(64 + x, 32 + averaged_scope_history[3][index]);
-    #endif
+  if (averaged_scope_tail != scope_canvas_tail) {
+    if ((scope_canvas_tail + 1) % kScopeDepth == averaged_scope_tail) {
+      // Just one new column
+      scope_canvas.Scroll();
+      scope_draw_column((averaged_scope_tail + kScopeDepth - 1) % kScopeDepth);
+    } else {
+      // Out of sync (first use, or history was used by vectorscope)
+      scope_canvas.Clear();
+      for (size_t x = 0; x < kScopeDepth - 1; ++x) {
+        scope_canvas.Scroll();
+        scope_draw_column((x + averaged_scope_tail + 1) % kScopeDepth);
+      }
+    }
+    scope_canvas_tail = averaged_scope_tail;
   }
+
+  scope_canvas.Render(graphics);
 }
 
 void vectorscope_render() {
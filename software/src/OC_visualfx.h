@@ -24,6 +24,7 @@
 #define OC_VISUALFX_H_
 
 #include "util/util_history.h"
+#include "src/drivers/weegfx.h"
 
 namespace OC {
 
@@ -75,6 +76,50 @@ private:
   util::History<T, kDepth> history_;
 };
 
+// Persistent pixels for scrolling screensavers that run for hours: rather than
+// re-drawing the whole history each frame, the cached pixels are scrolled left
+// one column when a new value arrives, and only the newest column is drawn.
+// Rendering a frame is then just OR-ing them in, so anything drawn before
+// (e.g. ENVGEN's envelope previews) stays visible.
+// The screen is split into lanes of lane_width columns that scroll together;
+// each lane shows lane_columns columns, the newest at x = lane_columns - 1.
+template <weegfx::coord_t lane_width, weegfx::coord_t lane_columns = lane_width>
+class ScrollingCanvas {
+public:
+  static constexpr weegfx::coord_t kWidth = weegfx::Graphics::kWidth;
+  static constexpr weegfx::coord_t kPages = weegfx::Graphics::kHeight / 8;
+  static constexpr weegfx::coord_t kLanes = kWidth / lane_width;
+  static_assert(lane_columns <= lane_width, "Lane columns must fit in lane");
+
+  void Clear() {
+    memset(pixels_, 0, sizeof(pixels_));
+  }
+
+  // Shift all lanes one column to the left, and clear the newest column
+  void Scroll() {
+    uint8_t *page = pixels_;
+    for (weegfx::coord_t p = 0; p < kPages; ++p, page += kWidth) {
+      uint8_t *lane = page;
+      for (weegfx::coord_t l = 0; l < kLanes; ++l, lane += lane_width) {
+        memmove(lane, lane + 1, lane_columns - 1);
+        lane[lane_columns - 1] = 0;
+      }
+    }
+  }
+
+  // Set pixel in newest column of lane; y is not clipped
+  void SetNewest(weegfx::coord_t lane, weegfx::coord_t y) {
+    pixels_[(y >> 3) * kWidth + lane * lane_width + lane_columns - 1] |= 0x1 << (y & 0x7);
+  }
+
+  void Render(weegfx::Graphics &graphics) const {
+    graphics.orColumns(0, kWidth, pixels_);
+  }
+
+private:
+  uint8_t pixels_[weegfx::Graphics::kFrameSize];
+};
+
 }; // namespace vfx
 }; // namespace OC
 
@@ -37,7 +37,9 @@ public:
     }
 
     void Controller() {
+        const bool was_mixing = mix_final;
         mix_final = mix || Gate(1);
+        if (mix_final != was_mixing) ViewChanged();
         int prevSignal = 0;
         
         ForEachChannel(ch)
@@ -58,6 +60,7 @@ public:
     void View() {
         DrawInterface();
     }
+    bool CachedView() { return true; }
 
     void OnButtonPress() {
         if (cursor == 4) // special case toggle
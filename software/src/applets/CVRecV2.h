@@ -19,8 +19,16 @@
 // SOFTWARE.
 
 #include "../SegmentDisplay.h"
+#include "../HSCVTape.h"
 #define CVREC_MAX_STEP 384
 
+#if defined(__IMXRT1062__)
+// Tape memory per slot, from HS::sample_pool and only in tape mode. On the T3.2, tapes use
+// the step memory instead.
+#define CVREC_TAPE_BYTES (32 * 1024)
+#define CVREC_MIN_TAPE_BYTES (4 * 1024)
+#endif
+
 const char* const CVRecV2_MODES[4] = {
     "Play", "Rec 1", "Rec 2", "Rec 1+2"
 };
@@ -35,9 +43,27 @@ public:
 
     void Start() {
         segment.Init(SegmentSize::BIG_SEGMENTS);
+#if defined(__IMXRT1062__)
+        AttachTapes(tape_mode);
+#else
+        const size_t size = sizeof(cv) / 2;
+        uint8_t *mem = reinterpret_cast<uint8_t*>(cv);
+        ForEachChannel(ch) tape[ch].Init(mem + ch * size, size);
+#endif
+    }
+
+#if defined(__IMXRT1062__)
+    void Unload() override {
+        AttachTapes(false);
     }
+#endif
 
     void Controller() {
+        if (tape_mode) {
+            TapeController();
+            return;
+        }
+
         if (Clock(1)) reset = true;
         if (reset) {
             step = start;
@@ -90,14 +116,31 @@ public:
     }
 
     void OnButtonPress() {
-        if (cursor == 2 && !EditMode()) { // special case to toggle smoothing
+        if (TapeRecording()) { // any press ends a tape recording
+            StopTapes();
+            return;
+        }
+
+        if (cursor == 0) { // toggle steps/tape
+            SetTapeMode(!tape_mode);
+            return;
+        }
+
+        if (cursor == 3 && !EditMode()) { // special case to toggle smoothing
             smooth = 1 - smooth;
             ResetCursor();
             return;
         }
 
-        if (cursor == 3 && EditMode()) { // activate recording if selected
-            punch_out = (mode > 0) ? end - start + 1 : 0;
+        if (cursor == 4 && EditMode()) { // activate recording if selected
+            if (tape_mode) {
+                if (mode > 0) StartTapes();
+            } else {
+                punch_out = (mode > 0) ? end - start + 1 : 0;
+#if !defined(__IMXRT1062__)
+                if (punch_out) ForEachChannel(ch) tape[ch].Erase(); // shares the step memory
+#endif
+            }
         }
 
         CursorToggle();
@@ -105,28 +148,33 @@ public:
 
     void OnEncoderMove(int direction) {
         if (!EditMode()) { //not editing, move cursor
-            MoveCursor(cursor, direction, 3);
+            do {
+                MoveCursor(cursor, direction, 4);
+            } while (tape_mode && cursor == 2); // tapes have a rate, not a range
             return;
         }
         
         switch (cursor) {
-        case 0: {
-            int16_t fs = start; // Former start value
-            start = constrain(start + direction, 0, end - 1);
-            if (fs != start && punch_out) punch_out -= direction;
+        case 1:
+            if (tape_mode) {
+                rate = constrain(rate + direction, 0, CVREC_MAX_RATE);
+            } else {
+                int16_t fs = start; // Former start value
+                start = constrain(start + direction, 0, end - 1);
+                if (fs != start && punch_out) punch_out -= direction;
+            }
             break;
-        }
-        case 1: {
+        case 2: {
             int16_t fe = end; // Former end value
             end = constrain(end + direction, start + 1, CVREC_MAX_STEP - 1);
             if (fe != end && punch_out) punch_out += direction;
             break;
         }
-        case 2:
+        case 3:
             smooth = 1 - smooth;
             ResetCursor();
             break;
-        case 3:
+        case 4:
             mode = constrain(mode + direction, 0, 3);
             break;
         }
@@ -137,6 +185,9 @@ public:
         Pack(data, PackLocation {0,9}, start);
         Pack(data, PackLocation {9,9}, end);
         Pack(data, PackLocation {18,1}, smooth);
+        Pack(data, PackLocation {19,1}, tape_mode);
+        // Biased so that the 0 in saves from before tapes restores the default
+        Pack(data, PackLocation {20,3}, (rate - CVREC_DEFAULT_RATE) & CVREC_MAX_RATE);
         return data;
     }
 
@@ -144,6 +195,12 @@ public:
         start = Unpack(data, PackLocation {0,9});
         end = Unpack(data, PackLocation {9,9});
         smooth = Unpack(data, PackLocation {18,1});
+#if defined(__IMXRT1062__)
+        AttachTapes(Unpack(data, PackLocation {19,1}));
+#else
+        tape_mode = Unpack(data, PackLocation {19,1});
+#endif
+        rate = (Unpack(data, PackLocation {20,3}) + CVREC_DEFAULT_RATE) & CVREC_MAX_RATE;
     }
 
 protected:
@@ -161,10 +218,22 @@ protected:
   }
 
 private:
-    int cursor; // 0=Start 1=End 2=Smooth 3=Record Mode
+    // Tape sample rate is the tick rate >> rate
+    static constexpr int CVREC_MAX_RATE = 7;
+    static constexpr int CVREC_DEFAULT_RATE = 6; // about 260Hz
+
+    int cursor; // 0=Steps/Tape 1=Start or Rate 2=End 3=Smooth 4=Record Mode
     SegmentDisplay segment;
 
     int16_t cv[2][CVREC_MAX_STEP];
+
+    // Tape mode records continuously, at a fixed rate, instead of a value per clock
+    volatile bool tape_mode = false;
+    int rate = CVREC_DEFAULT_RATE;
+    HS::CVTape tape[2];
+    int tape_tick = 0;
+    int16_t tape_from[2] = {0, 0}; // interpolating from the last sample to the next one
+    int16_t tape_to[2] = {0, 0};
     simfloat rise[2];
     simfloat signal[2];
     bool smooth;
@@ -177,12 +246,121 @@ private:
     int16_t step = 0; // Current step
     int16_t punch_out = 0;
     
+    void TapeController() {
+        if (Clock(1)) RewindTapes();
+
+        if (++tape_tick >> rate) { // next sample
+            tape_tick = 0;
+            ForEachChannel(ch)
+            {
+                if (tape[ch].recording()) {
+                    // ran out of tape?
+                    if (!tape[ch].Record(In(ch)) && !TapeRecording()) mode = 0;
+                } else {
+                    tape_from[ch] = tape_to[ch];
+                    tape_to[ch] = tape[ch].Next();
+                }
+            }
+        }
+
+        ForEachChannel(ch)
+        {
+            if (tape[ch].recording()) Out(ch, In(ch));
+            else if (smooth) Out(ch, tape_from[ch] + (((tape_to[ch] - tape_from[ch]) * tape_tick) >> rate));
+            else Out(ch, tape_to[ch]);
+        }
+    }
+
+    bool TapeRecording() {
+        return tape[0].recording() || tape[1].recording();
+    }
+
+    void RewindTapes() {
+        tape_tick = 0;
+        ForEachChannel(ch)
+        {
+            tape[ch].Rewind();
+            tape_from[ch] = tape_to[ch] = 0;
+        }
+    }
+
+    void StartTapes() {
+        RewindTapes(); // so that the other channel plays along from its start
+        ForEachChannel(ch)
+        {
+            if (mode & (0x01 << ch)) tape[ch].StartRecording();
+        }
+    }
+
+    void StopTapes() {
+        ForEachChannel(ch) tape[ch].StopRecording();
+        RewindTapes();
+        mode = 0;
+    }
+
+    void SetTapeMode(bool on) {
+        StopTapes();
+        punch_out = 0;
+        reset = true;
+#if defined(__IMXRT1062__)
+        AttachTapes(on);
+#else
+        tape_mode = on;
+        // Tapes and steps share memory, so whichever was used last is all that's left
+        if (!tape_mode && tape[0].length() + tape[1].length() > 0) {
+            memset(cv, 0, sizeof(cv));
+            ForEachChannel(ch) tape[ch].Erase();
+        }
+#endif
+    }
+
+#if defined(__IMXRT1062__)
+    // Tapes hold pool memory only in tape mode, settling for less if the pool is short. With
+    // none at all they have no room and don't record. The Controller leaves the tapes alone
+    // while they change.
+    void AttachTapes(bool on) {
+        tape_mode = false;
+        ForEachChannel(ch) tape[ch].Init(nullptr, 0);
+        if (!on) {
+            HS::sample_pool.Release(hemisphere);
+            return;
+        }
+        for (size_t bytes = CVREC_TAPE_BYTES; bytes >= CVREC_MIN_TAPE_BYTES; bytes /= 2) {
+            uint8_t *mem = HS::sample_pool.Acquire(hemisphere, bytes);
+            if (mem) {
+                ForEachChannel(ch) tape[ch].Init(mem + ch * bytes / 2, bytes / 2);
+                break;
+            }
+        }
+        tape_mode = true;
+    }
+#endif
+
+    // Seconds of recording left at the rate so far, or played so far
+    int TapeSeconds() {
+        const int sample_rate = 16667 >> rate;
+        if (!TapeRecording()) return tape[tape[0].length() ? 0 : 1].position() / sample_rate;
+
+        int ch = tape[0].recording() ? 0 : 1;
+        if (tape[1].recording() && tape[1].remaining() < tape[0].remaining()) ch = 1;
+        float bytes_per_sample = tape[ch].length() ? float(tape[ch].used()) / tape[ch].length() : 1.0f;
+        if (bytes_per_sample < 0.1f) bytes_per_sample = 0.1f;
+        return int(tape[ch].remaining() / bytes_per_sample) / sample_rate;
+    }
+
     void DrawInterface() {
-        // Range
-        gfxIcon(1, 15, LOOP_ICON);
-        gfxPrint(18 + pad(100, start + 1), 15, start + 1);
-        gfxPrint("-");
-        gfxPrint(pad(100, end + 1), end + 1);
+        if (tape_mode) {
+            // Rate
+            gfxIcon(1, 15, WAVEFORM_ICON);
+            gfxPrint(18, 15, 16667 >> rate);
+            gfxPrint("Hz");
+        } else {
+            // Range
+            gfxIcon(1, 15, LOOP_ICON);
+            gfxPrint(18 + pad(100, start + 1), 15, start + 1);
+            gfxPrint("-");
+            gfxPrint(pad(100, end + 1), end + 1);
+        }
 
         // Smooth
         gfxPrint(1, 25, "Smooth");
@@ -192,23 +370,28 @@ private:
         gfxPrint(1, 35, CVRecV2_MODES[mode]);
 
         // Status icon
-        if (mode > 0 && punch_out > 0) {
+        if ((mode > 0 && punch_out > 0) || TapeRecording()) {
             if (!CursorBlink()) gfxIcon(54, 35, RECORD_ICON);
         }
         else gfxIcon(54, 35, PLAY_ICON);
 
         // Record time indicator
         if (punch_out > 0) gfxInvert(0, 34, punch_out / 6, 9);
+        if (TapeRecording()) {
+            const HS::CVTape &t = tape[tape[0].recording() ? 0 : 1];
+            gfxInvert(0, 34, 63 - (63 * t.remaining()) / t.capacity(), 9);
+        }
 
         // Cursor
         switch(cursor){
-            case 0: gfxCursor(19, 23, 18); break;
-            case 1: gfxCursor(43, 23, 18); break;
-            case 3: gfxCursor(1, 43, 63); break;
+            case 0: gfxCursor(1, 23, 8); break;
+            case 1: gfxCursor(19, 23, tape_mode ? 42 : 18); break;
+            case 2: gfxCursor(43, 23, 18); break;
+            case 4: gfxCursor(1, 43, 63); break;
         }
 
-        // Step indicator
-        segment.PrintWhole(gfx_offset, 50, step + 1, 100);
+        // Step indicator, or tape seconds
+        segment.PrintWhole(gfx_offset, 50, tape_mode ? TapeSeconds() : step + 1, 100);
 
         // CV Indicators
         ForEachChannel(ch)
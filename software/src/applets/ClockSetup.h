@@ -350,9 +350,9 @@ private:
         }
 
         // Tempo
-        gfxPrint(22 + pad(100, clock_m.GetTempo()), y, clock_m.GetTempo());
+        gfxGlyphsRight(weegfx::numerals_10, 43, y - 1, clock_m.GetTempo());
         if (cursor != SHUFFLE)
-            gfxPrint(" BPM");
+            gfxPrint(46, y, "BPM");
         else {
             // Shuffle
             gfxIcon(44, y, METRO_R_ICON);
@@ -399,7 +399,7 @@ private:
             gfxFrame(11, 0, 10, 10);
             break;
         case TEMPO:
-            gfxCursor(22, 9, 19);
+            gfxCursor(21, 10, 22, 11);
             break;
         case SHUFFLE:
             gfxCursor(52, 9, 13);
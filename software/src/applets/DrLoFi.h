@@ -30,10 +30,11 @@
 
 #define PCM_TO_CV(S) Proportion((int)S - 127, 127, CLIPLIMIT)
 #define CV_TO_PCM(S) Proportion(constrain(S, -CLIPLIMIT, CLIPLIMIT), CLIPLIMIT, 127) + 127
+#define PCM12_TO_CV(S) Proportion(S, 2047, CLIPLIMIT)
+#define CV_TO_PCM12(S) Proportion(constrain(S, -CLIPLIMIT, CLIPLIMIT), CLIPLIMIT, 2047)
 
 class DrLoFi : public HemisphereApplet {
 public:
-    const int length = HEM_LOFI_PCM_BUFFER_SIZE;
 
     const char* applet_name() { // Maximum 10 characters
         return "Dr. LoFi";
@@ -42,18 +43,18 @@ public:
 
     void Start() {
         countdown = HEM_LOFI_PCM_SPEED;
-        // this might take too long, which causes crashes. It's not crucial.
-        //for (int i = 0; i < HEM_LOFI_PCM_BUFFER_SIZE; i++) lofi_pcm_buffer[i] = 127;
         cursor = 1; //for gui
-        lofi_pcm_buffer = new uint8_t[HEM_LOFI_PCM_BUFFER_SIZE];
+        AllocateBuffer();
         AllowRestart();
     }
 
     void Unload() override {
-        delete lofi_pcm_buffer;
+        lofi_pcm_buffer = nullptr;
+        HS::sample_pool.Release(hemisphere);
     }
 
     void Controller() {
+        if (!lofi_pcm_buffer) return; // the pool had nothing to spare
         play = !Gate(0); // Continuously play unless gated
         fdbk_g = Gate(1) ? 100 : feedback; // Feedback = 100 when gated
 
@@ -74,8 +75,8 @@ public:
                 head_w = (head + length + dt_pct*length/100) % length; //have to add the extra length to keep modulo positive in case delaytime is neg
 
                 // mix input into the buffer ahead, respecting feedback
-                int fbmix = PCM_TO_CV(lofi_pcm_buffer[head]) * fdbk_g / 100 + cv;
-                lofi_pcm_buffer[head_w] = CV_TO_PCM(fbmix);
+                int fbmix = ReadCV(head) * fdbk_g / 100 + cv;
+                WriteCV(head_w, fbmix);
 
                 rate_mod = rate;
                 Modulate(rate_mod, 1, 1, 64);
@@ -83,21 +84,22 @@ public:
                 countdown = rate_mod;
             }
 
-            SmoothedOut(0, PCM_TO_CV(lofi_pcm_buffer[head]), (rate_mod+1)/2);
-            SmoothedOut(1, PCM_TO_CV(lofi_pcm_buffer[length-1 - head]), (rate_mod+1)/2); // reverse buffer!
+            SmoothedOut(0, ReadCV(head), (rate_mod+1)/2);
+            SmoothedOut(1, ReadCV(length-1 - head), (rate_mod+1)/2); // reverse buffer!
         }
     }
 
     void View() {
         DrawSelector();
-        if (play) DrawWaveform();
+        if (!lofi_pcm_buffer) gfxPrint(1, 35, "No memory");
+        else if (play) DrawWaveform();
     }
 
     //void OnButtonPress() { }
 
     void OnEncoderMove(int direction) {
         if (!EditMode()) {
-            MoveCursor(cursor, direction, 3);
+            MoveCursor(cursor, direction, 4);
             return;
         }
 
@@ -114,6 +116,14 @@ public:
         case 3:
             depth = constrain(depth + direction, 0, 13);
             break;
+        case 4: {
+            int f = constrain(format + direction, 0, FORMAT_COUNT - 1);
+            if (f != format) {
+                format = f;
+                AllocateBuffer();
+            }
+            break;
+        }
         }
     }
 
@@ -123,6 +133,7 @@ public:
         Pack(data, PackLocation {7,7}, feedback);
         Pack(data, PackLocation {14,5}, rate);
         Pack(data, PackLocation {19,4}, depth);
+        Pack(data, PackLocation {23,2}, format);
         return data;
     }
 
@@ -131,6 +142,8 @@ public:
         feedback = Unpack(data, PackLocation {7,7});
         rate = Unpack(data, PackLocation {14,5});
         depth = Unpack(data, PackLocation {19,4});
+        format = Unpack(data, PackLocation {23,2});
+        if (lofi_pcm_buffer) AllocateBuffer();
     }
 
 protected:
@@ -143,11 +156,25 @@ protected:
     help[HELP_OUT1]     = "Signal";
     help[HELP_OUT2]     = "Reverse";
     help[HELP_EXTRA1] = "Set: Time / Feedback";
-    help[HELP_EXTRA2] = "SamplRate / Bitcrush";
+    help[HELP_EXTRA2] = "Rate/Bitcrush/Buffer";
     //                  "---------------------" <-- Extra text size guide
   }
 
 private:
+    // Buffer formats, from the original 8-bit buffer up to the longest the pool can hold
+    static constexpr int FORMAT_COUNT = 4;
+    struct Format {
+        const char *name;
+        int samples;
+        bool packed; // 12-bit
+    };
+    const Format formats[FORMAT_COUNT] = {
+        {"8b 2K", 2048, false},
+        {"12b 2K", 2048, true},
+        {"12b 8K", 8192, true},
+        {"12b 32K", 32768, true},
+    };
+
     bool play = 0; //play always on unless gated on Digital 1
     uint16_t head = 0; // Location of read/play head
     uint16_t head_w = 0; // Location of write/record head
@@ -159,8 +186,43 @@ private:
     uint8_t rate_mod = rate;
     int depth = 0; // bit reduction depth aka bitcrush
     int cursor; //for gui
+    int format = 0; // chosen
+    int active_format = 0; // what the pool could give
 
-    uint8_t* lofi_pcm_buffer;
+    // From HS::sample_pool. The Controller skips a null buffer, so it's cleared while
+    // the length and format change.
+    uint8_t* volatile lofi_pcm_buffer = nullptr;
+    volatile int length = HEM_LOFI_PCM_BUFFER_SIZE;
+    volatile bool packed = false;
+
+    // Ask for the chosen format, settling for a shorter one if the pool is short
+    void AllocateBuffer() {
+        lofi_pcm_buffer = nullptr;
+        for (int f = format; f >= 0; --f) {
+            const size_t bytes = formats[f].packed
+                ? HS::PackedSamples12::BytesFor(formats[f].samples) : formats[f].samples;
+            uint8_t *mem = HS::sample_pool.Acquire(hemisphere, bytes);
+            if (mem) {
+                memset(mem, formats[f].packed ? 0 : 127, bytes); // silence
+                active_format = f;
+                length = formats[f].samples;
+                packed = formats[f].packed;
+                head = 0;
+                lofi_pcm_buffer = mem;
+                return;
+            }
+        }
+    }
+
+    int ReadCV(int i) {
+        if (packed) return PCM12_TO_CV(HS::PackedSamples12(lofi_pcm_buffer).Get(i));
+        return PCM_TO_CV(lofi_pcm_buffer[i]);
+    }
+
+    void WriteCV(int i, int cv) {
+        if (packed) HS::PackedSamples12(lofi_pcm_buffer).Set(i, CV_TO_PCM12(cv));
+        else lofi_pcm_buffer[i] = CV_TO_PCM(cv);
+    }
     
     void DrawWaveform() {
         int inc = rate_mod/2 + 1;
@@ -168,7 +230,7 @@ private:
         if (pos < 0) pos += length;
         for (int i = 0; i < 64; i++)
         {
-            int height = Proportion(127 - (int)lofi_pcm_buffer[pos], 128, 16);
+            int height = Proportion(-ReadCV(pos), CLIPLIMIT, 16);
             gfxLine(i, 46, i, 46+height);
 
             pos += inc;
@@ -185,6 +247,11 @@ private:
             gfxPrint(4 + pad(100, dt_pct), 15, dt_pct);
             gfxPrint(36 + pad(1000, fdbk_g), 15, fdbk_g);
             gfxCursor(10 + 31 * cursor, 23, 20);
+        } else if (cursor == 4) {
+            gfxIcon(0, 15, WAVEFORM_ICON);
+            gfxPrint(10, 15, formats[format].name);
+            if (!lofi_pcm_buffer || active_format != format) gfxPrint(" !"); // didn't fit
+            gfxCursor(10, 23, 44);
         } else {
             gfxIcon(0, 15, WAVEFORM_ICON);
             gfxIcon(8, 15, BURST_ICON);
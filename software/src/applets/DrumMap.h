@@ -69,25 +69,27 @@ public:
           break;
         }
 
+        // The view draws from the same lanes, so they're only rebuilt here
+        UpdatePattern();
+
         if (Clock(1)) Reset();
 
         if (Clock(0)) {
             // generate randomness for each drum type on first step of the pattern
             if (step == 0) {
-                for (int i = 0; i < 3; i++) {
+                for (int i = 0; i < PART_COUNT; i++) {
                     randomness[i] = random(0, _chaos >> 2);
                 }
             }
 
             ForEachChannel(ch) {
-                // accent on ch 1 will be for whatever part ch 0 is set to
-                uint8_t part = (ch == 1 && mode[ch] == 3) ? mode[0] : mode[ch];
-                int level = ReadDrumMap(step, part, _x, _y);
+                uint8_t part = Part(ch);
+                int level = pattern[part].level[step];
                 level = constrain(level + randomness[part], 0, MAX_VAL);
                 // use ch 0 fill if ch 1 is in accent mode
-                uint8_t threshold = (ch == 1 && mode[ch] == 3) ? ~_fill[0] : ~_fill[ch];
+                uint8_t threshold = (ch == 1 && mode[ch] == ACCENT) ? ~_fill[0] : ~_fill[ch];
                 if (level > threshold) {
-                    if (mode[ch] < 3) {
+                    if (mode[ch] != ACCENT) {
                         // normal part
                         ClockOut(ch);
                         pulse_animation[ch] = HEM_DRUMMAP_PULSE_ANIMATION_TICKS;
@@ -139,7 +141,7 @@ public:
         if (!EditMode()) {
             do {
                 MoveCursor(cursor, direction, 7);
-            } while (mode[1] > 2 && cursor == 3);
+            } while (mode[1] == ACCENT && cursor == 3);
 
             ResetCursor();
             return;
@@ -149,14 +151,13 @@ public:
         // modes
         switch (cursor) {
         case 0:
-            mode[0] += direction;
-            if (mode[0] > 2) mode[0] = 0;
-            if (mode[0] < 0) mode[0] = 2;
+            // only channel B can be the accent
+            do {
+                mode[0] = (mode[0] + direction + MODE_COUNT) % MODE_COUNT;
+            } while (mode[0] == ACCENT);
             break;
         case 1:
-            mode[1] += direction;
-            if (mode[1] > 3) mode[1] = 0;
-            if (mode[1] < 0) mode[1] = 3;
+            mode[1] = (mode[1] + direction + MODE_COUNT) % MODE_COUNT;
             break;
         // fill
         case 2:
@@ -234,14 +235,38 @@ protected:
   }
 
 private:
-    const uint8_t *MODE_ICONS[3] = {BD_ICON,SN_ICON,HH_ICON};
-    const uint8_t *MODE_PULSE_ICON[3] = {BD_HIT_ICON,SN_HIT_ICON,HH_HIT_ICON};
+    // Output modes. The first three are also the Grids parts.
+    enum {
+        KICK, SNARE, HIHAT,
+        ACCENT, // channel B only, accents channel A's part
+        HIHAT2, // a second hi-hat lane
+        MODE_COUNT
+    };
+
+    // Pattern lanes: the three Grids parts, and HIHAT2, which is the hi-hat
+    // part read from the map with x and y swapped
+    static constexpr int PART_COUNT = 4;
+
+    // Densities of one lane for all 32 steps at the current x/y. They're
+    // rebuilt in two stages, so that a change that leaves the x fades alone
+    // only redoes the y fade.
+    typedef struct PatternLane {
+        bool valid = false;
+        uint8_t u, v; // map position the lane was built for
+        uint8_t ab[32]; // fades along u, between the nodes in each of the two rows
+        uint8_t cd[32];
+        uint8_t level[32];
+    } PatternLane;
+
+    const uint8_t *MODE_ICONS[PART_COUNT] = {BD_ICON,SN_ICON,HH_ICON,HH_ICON};
+    const uint8_t *MODE_PULSE_ICON[PART_COUNT] = {BD_HIT_ICON,SN_HIT_ICON,HH_HIT_ICON,HH_HIT_ICON};
     const char * const CV_MODE_NAMES[3] = {"FILL 1/2", "X/Y", "FA/CHAOS"};
-    const char * const OUT_MODE_NAMES[4] = {"Kick", "Snare", "HiHat", "Accent"};
+    const char * const OUT_MODE_NAMES[MODE_COUNT] = {"Kick", "Snare", "HiHat", "Accent", "HiHat2"};
     const int *VALUE_MAP[5] = {&fill[0], &fill[1], &x, &y, &chaos};
     int cursor = 0;
     uint8_t step;
-    uint8_t randomness[3] = {0, 0, 0};
+    uint8_t randomness[PART_COUNT] = {0, 0, 0, 0};
+    PatternLane pattern[PART_COUNT];
     int pulse_animation[2] = {0, 0};
     int value_animation = 0;
     int knob_accel = 256;
@@ -259,42 +284,60 @@ private:
     int _chaos = 0;
     int8_t cv_mode = 0; // 0 = Fill A/B, 1 = X/Y, 2 = Fill A/Chaos
 
-    uint8_t ReadDrumMap(uint8_t step, uint8_t part, uint8_t x, uint8_t y) {
-      uint8_t i = x >> 6;
-      uint8_t j = y >> 6;
-      const uint8_t* a_map = grids::drum_map[i][j];
-      const uint8_t* b_map = grids::drum_map[i + 1][j];
-      const uint8_t* c_map = grids::drum_map[i][j + 1];
-      const uint8_t* d_map = grids::drum_map[i + 1][j + 1];
-      uint8_t offset = (part * 32) + step;
-      uint8_t a = a_map[offset];
-      uint8_t b = b_map[offset];
-      uint8_t c = c_map[offset];
-      uint8_t d = d_map[offset];
-      uint8_t quad_x = x << 2;
-      uint8_t quad_y = y << 2;
-      // return U8Mix(U8Mix(a, b, x << 2), U8Mix(c, d, x << 2), y << 2);
-      // U8Mix returns b * x + a * (255 - x) >> 8 
-      uint8_t ab_fade = (b * quad_x + a * (255 - quad_x)) >> 8;
-      uint8_t cd_fade = (d * quad_x + c * (255 - quad_x)) >> 8;
-      return (cd_fade * quad_y + ab_fade * (255 - quad_y)) >> 8;
+    // Pattern lane for a channel; accent on ch 1 will be for whatever part ch 0 is set to
+    uint8_t Part(int ch) {
+        int m = (ch == 1 && mode[ch] == ACCENT) ? mode[0] : mode[ch];
+        return m == HIHAT2 ? 3 : m;
     }
-    
+
+    void UpdatePattern() {
+        for (int part = 0; part < 3; ++part) UpdateLane(pattern[part], part, _x, _y);
+        UpdateLane(pattern[3], HIHAT, _y, _x);
+    }
+
+    // Bilinear interpolation of four grids::drum_map nodes around (u, v), for every step
+    void UpdateLane(PatternLane &lane, uint8_t part, uint8_t u, uint8_t v) {
+        if (lane.valid && lane.u == u && lane.v == v) return;
+
+        if (!lane.valid || lane.u != u || (lane.v >> 6) != (v >> 6)) {
+            uint8_t i = u >> 6;
+            uint8_t j = v >> 6;
+            const uint8_t* a_map = grids::drum_map[i][j] + part * 32;
+            const uint8_t* b_map = grids::drum_map[i + 1][j] + part * 32;
+            const uint8_t* c_map = grids::drum_map[i][j + 1] + part * 32;
+            const uint8_t* d_map = grids::drum_map[i + 1][j + 1] + part * 32;
+            uint8_t quad_u = u << 2;
+            // U8Mix returns b * x + a * (255 - x) >> 8
+            for (int s = 0; s < 32; ++s) {
+                lane.ab[s] = (b_map[s] * quad_u + a_map[s] * (255 - quad_u)) >> 8;
+                lane.cd[s] = (d_map[s] * quad_u + c_map[s] * (255 - quad_u)) >> 8;
+            }
+        }
+
+        uint8_t quad_v = v << 2;
+        for (int s = 0; s < 32; ++s)
+            lane.level[s] = (lane.cd[s] * quad_v + lane.ab[s] * (255 - quad_v)) >> 8;
+
+        lane.u = u;
+        lane.v = v;
+        lane.valid = true;
+    }
+
     void DrawInterface() {
         // output selection
         char outlabel[] = { (char)('A' + io_offset), ':', '\0' };
         gfxPrint(1,15, outlabel);
-        gfxIcon(15,15, (pulse_animation[0] > 0)? MODE_PULSE_ICON[mode[0]] : MODE_ICONS[mode[0]] );
+        gfxIcon(15,15, (pulse_animation[0] > 0)? MODE_PULSE_ICON[Part(0)] : MODE_ICONS[Part(0)] );
 
         ++outlabel[0];
         gfxPrint(32,15, outlabel);
-        if (mode[1] == 3) {
+        if (mode[1] == ACCENT) {
             // accent
-            gfxIcon(46,15,MODE_ICONS[mode[0]]);
+            gfxIcon(46,15,MODE_ICONS[Part(0)]);
             gfxPrint(53,15,">");
         } else {
             // standard
-            gfxIcon(46,15,(pulse_animation[1] > 0)? MODE_PULSE_ICON[mode[1]] : MODE_ICONS[mode[1]]);
+            gfxIcon(46,15,(pulse_animation[1] > 0)? MODE_PULSE_ICON[Part(1)] : MODE_ICONS[Part(1)]);
         }
         /*
         // pulse animation per channel
@@ -309,7 +352,7 @@ private:
         gfxPrint(1,25,"F");
         DrawSlider(9,25,20,_fill[0], MAX_VAL, cursor == 2);
         // don't show fill for channel b if it is an accent mode
-        if (mode[1] < 3) {
+        if (mode[1] != ACCENT) {
             gfxPrint(32,25,"F");
             DrawSlider(40,25,20,_fill[1], MAX_VAL, cursor == 3);
         }
@@ -356,9 +399,9 @@ private:
     }
 
     void DrawTracks(int y, int ch) {
-        uint8_t part = (ch == 1 && mode[ch] == 3) ? mode[0] : mode[ch];
+        const uint8_t *levels = pattern[Part(ch)].level;
         for (int i=0; i < 32; i++) {
-            int level = ReadDrumMap((step + i) % 32, part, _x, _y);
+            int level = levels[(step + i) % 32];
             int h = level >> 6;
             if (level > 0) h++;
             gfxRect(2 * i, y + 4 - h, 2, h);
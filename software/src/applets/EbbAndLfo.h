@@ -23,6 +23,8 @@ public:
   void Start() {
     phase = 0;
     phase_extractor.Init();
+    voice.Init();
+    disp_voice.Init();
   }
 
   void Reset() {
@@ -106,7 +108,8 @@ public:
 
     // COMPUTE
     int s = constrain(slope_mod, 0, 65535);
-    ProcessSample(s, shape_mod, fold_mod, phase, sample);
+    voice.Configure(s, shape_mod, fold_mod);
+    voice.Process(phase, sample);
 
     ForEachChannel(ch) {
       switch (output(ch)) {
@@ -134,13 +137,16 @@ public:
   }
 
   void View() {
+    // One cycle is the same for both outputs, only the mapping differs
+    disp_voice.Configure(slope_mod, shape_mod, fold_mod);
+    disp_voice.ProcessSamples(0, 0xffffffff / 64, disp_samples, 64);
+
     ForEachChannel(ch) {
       int h = 17;
       int bottom = 32 + (h + 1) * ch;
       int last = bottom;
       for (int i = 0; i < 64; i++) {
-        ProcessSample(slope_mod, shape_mod, fold_mod, 0xffffffff / 64 * i,
-                      disp_sample);
+        const TidesLiteSample &disp_sample = disp_samples[i];
         int next = 0;
         switch (output(ch)) {
         case UNIPOLAR:
@@ -402,7 +408,9 @@ private:
 
   uint8_t out = 0b0001; // Unipolar on A, bipolar on B
   uint8_t cv = 0b0001;  // Freq on 1, shape on 2
-  TidesLiteSample disp_sample;
+  TidesLiteVoice voice;
+  TidesLiteVoice disp_voice; // View runs outside the ISR, so it has its own
+  TidesLiteSample disp_samples[64];
   TidesLiteSample sample;
 
   int knob_accel = 1 << 8;
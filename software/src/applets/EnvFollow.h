@@ -18,7 +18,9 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
-#define HEM_ENV_FOLLOWER_SAMPLES 166
+#include "../HSEnvelopeDetector.h"
+
+#define HEM_ENV_FOLLOWER_SAMPLES 166 // peak hold
 #define HEM_ENV_FOLLOWER_MAXSPEED 16
 
 class EnvFollow : public HemisphereApplet {
@@ -28,7 +30,8 @@ public:
         MODE_1, MODE_2,
         GAIN_1, GAIN_2,
         SPEED,
-        MAX_CURSOR = SPEED
+        DETECT,
+        MAX_CURSOR = DETECT
     };
 
     const char* applet_name() {
@@ -39,38 +42,19 @@ public:
     void Start() {
         ForEachChannel(ch)
         {
-            max[ch] = 0;
             gain[ch] = 10;
             duck[ch] = ch; // Default: one of each
+            detector[ch].Init();
         }
-        countdown = HEM_ENV_FOLLOWER_SAMPLES;
+        SetupDetectors();
     }
 
     void Controller() {
-        if (--countdown == 0) {
-            ForEachChannel(ch)
-            {
-                target[ch] = max[ch] * gain[ch];
-                if (duck[ch]) target[ch] = HEMISPHERE_MAX_CV - target[ch]; // Handle ducking channel(s)
-                target[ch] = constrain(target[ch], 0, HEMISPHERE_MAX_CV);
-                max[ch] = 0;
-            }
-            countdown = HEM_ENV_FOLLOWER_SAMPLES;
-        }
-
         ForEachChannel(ch)
         {
-            int v = abs(In(ch));
-            if (v > max[ch]) max[ch] = v;
-            if (target[ch] > signal[ch]) {
-                signal[ch] += speed;
-                if (signal[ch] > target[ch]) signal[ch] = target[ch];
-            }
-            else if (target[ch] < signal[ch]) {
-                signal[ch] -= speed;
-                if (signal[ch] < target[ch]) signal[ch] = target[ch];
-            }
-            Out(ch, signal[ch]);
+            int signal = detector[ch].Process(In(ch)) * gain[ch];
+            if (duck[ch]) signal = HEMISPHERE_MAX_CV - signal; // Handle ducking channel(s)
+            Out(ch, constrain(signal, 0, HEMISPHERE_MAX_CV));
         }
     }
 
@@ -100,6 +84,12 @@ public:
 
         case SPEED:
             speed = constrain(speed + direction, 1, HEM_ENV_FOLLOWER_MAXSPEED);
+            SetupDetectors();
+            break;
+
+        case DETECT:
+            rms = !rms;
+            SetupDetectors();
             break;
         }
         ResetCursor();
@@ -112,6 +102,7 @@ public:
         Pack(data, PackLocation {10,1}, duck[0]);
         Pack(data, PackLocation {11,1}, duck[1]);
         Pack(data, PackLocation {12,4}, speed - 1);
+        Pack(data, PackLocation {16,1}, rms);
         return data;
     }
 
@@ -122,6 +113,8 @@ public:
         duck[1] = Unpack(data, PackLocation {11,1});
         speed = Unpack(data, PackLocation {12,4}) + 1;
         speed = constrain(speed, 1, HEM_ENV_FOLLOWER_MAXSPEED);
+        rms = Unpack(data, PackLocation {16,1});
+        SetupDetectors();
     }
 
 protected:
@@ -134,21 +127,31 @@ protected:
     help[HELP_OUT1]     = duck[0] ? "Duck 1" : "Follow1";
     help[HELP_OUT2]     = duck[1] ? "Duck 2" : "Follow2";
     help[HELP_EXTRA1] = "Set: Gain / Mode";
-    help[HELP_EXTRA2] = "     Speed";
+    help[HELP_EXTRA2] = "     Speed / Detect";
     //                  "---------------------" <-- Extra text size guide
   }
 
 private:
     int cursor;
-    int max[2];
-    uint8_t countdown;
-    int signal[2];
-    int target[2];
+    HS::EnvelopeDetector<> detector[2];
 
     // Setting
     uint8_t gain[2];
     bool duck[2]; // Choose between follow and duck per channel
     int speed = 1; // attack/release rate
+    bool rms = 0; // RMS or peak detection
+
+    // Release from 400ms at speed 1 to 25ms at the top, and attack 8 times faster
+    void SetupDetectors() {
+        const float release = 16667.0f * 0.4f / speed;
+        ForEachChannel(ch)
+        {
+            detector[ch].set_mode(rms ? HS::EnvelopeDetector<>::RMS : HS::EnvelopeDetector<>::PEAK);
+            detector[ch].set_attack(release / 8);
+            detector[ch].set_release(release);
+            detector[ch].set_hold(HEM_ENV_FOLLOWER_SAMPLES);
+        }
+    }
 
     void DrawInterface() {
         ForEachChannel(ch)
@@ -178,6 +181,11 @@ private:
             gfxCursor(28, 39, 14);
             break;
 
+        case DETECT:
+            gfxPrint(20, 31, rms ? "RMS" : "Peak");
+            gfxCursor(20, 39, 24);
+            break;
+
         default: break;
         }
     }
@@ -1,4 +1,4 @@
-#define GOL_ABS(X) (X < 0 ? -X : X)
+#include "../HSLifeBoard.h"
 
 class GameOfLife : public HemisphereApplet {
 public:
@@ -9,28 +9,21 @@ public:
     const uint8_t* applet_icon() { return PhzIcons::gameOfLife; }
 
     void Start() {
-        for (int i = 0; i < 80; i++) board[i] = 0;
         weight = 30;
         tx = 0;
         ty = 0;
-
-        // Start off with a sweet-looking board
-        for (int x = 0; x < 6; x++)
-        {
-            AddToBoard(x + 26, x + 23);
-            AddToBoard(x + 33, (5 - x) + 23);
-        }
-        AddToBoard(32, 28);
+        SetBoardType(TOROID);
     }
 
     void Controller() {
         tx = ProportionCV(In(0), 63);
-        ty = ProportionCV(In(1), 39);
+        ty = ProportionCV(In(1), board.rows() - 1);
 
         if (Clock(0)) {
-            ProcessGameBoard(tx, ty);
+            global_density = board.Step();
+            local_density = board.CountIn(tx - 7, ty - 7, tx + 7, ty + 7);
         }
-        if (Gate(1)) AddToBoard(tx, ty);
+        if (Gate(1)) board.Set(tx, ty);
 
         int global_density_cv = Proportion(global_density, 1200 - (weight * 10), HEMISPHERE_MAX_CV);
         int local_density_cv = Proportion(local_density, 225, HEMISPHERE_MAX_CV);
@@ -50,7 +43,11 @@ public:
     }
 
     void OnButtonPress() {
-        for (int i = 0; i < 80; i++) board[i] = 0;
+        board.Clear();
+    }
+
+    void AuxButton() {
+        SetBoardType((board_type + 1) % BOARD_TYPES);
     }
 
     void OnEncoderMove(int direction) {
@@ -59,12 +56,15 @@ public:
 
     uint64_t OnDataRequest() {
         uint64_t data = 0;
-        Pack(data, PackLocation {0,6}, weight);
+        Pack(data, PackLocation {0,7}, weight);
+        Pack(data, PackLocation {8,2}, board_type);
         return data;
     }
 
     void OnDataReceive(uint64_t data) {
-        weight = Unpack(data, PackLocation {0,6});
+        weight = Unpack(data, PackLocation {0,7});
+        int type = Unpack(data, PackLocation {8,2});
+        if (type != board_type) SetBoardType(type);
     }
 
 protected:
@@ -77,29 +77,54 @@ protected:
     help[HELP_OUT1]     = "Global";
     help[HELP_OUT2]     = "Local";
     help[HELP_EXTRA1] = "Set: Weight";
-    help[HELP_EXTRA2] = "Push to Clear";
+    help[HELP_EXTRA2] = "Push:Clear Aux:Board";
     //                  "---------------------" <-- Extra text size guide
   }
 
 private:
-    uint64_t board[80]; // 64x40 board
+    enum BoardType {
+        TOROID, // 64x40, wrapping around at the edges
+        FLAT, // 64x40, dead beyond the edges
+        BIG, // 64x80 toroid, shown two rows to a pixel
+        BOARD_TYPES
+    };
+
+    HS::LifeBoard board;
+    int board_type;
     int weight; // Weight of each cell
     int global_density; // Count of all live cells
     int local_density; // Count of cells in the vicinity of the Traveler
     int tx;
     int ty;
 
+    void SetBoardType(int type) {
+        board_type = constrain(type, 0, BOARD_TYPES - 1);
+        board.Init(board_type == BIG ? 80 : 40, board_type != FLAT);
+        global_density = 0;
+        local_density = 0;
+
+        // Start off with a sweet-looking board
+        int y = (board.rows() - 40) / 2;
+        for (int x = 0; x < 6; x++)
+        {
+            board.Set(x + 26, x + y + 23);
+            board.Set(x + 33, (5 - x) + y + 23);
+        }
+        board.Set(32, y + 28);
+    }
+
     void DrawBoard() {
+        const int scale = board.rows() / 40;
         for (int y = 0; y < 40; y++)
         {
-            for (int b = 0; b < 2; b++)
+            uint64_t row = board.row(y * scale);
+            if (scale > 1) row |= board.row(y * scale + 1);
+            for (int x = 0; row; x++, row >>= 1)
             {
-                for (int c = 0; c < 32; c++)
-                {
-                    if ((board[(y * 2) + b] >> c) & 0x01) gfxPixel(c + (32 * b), y + 22);
-                }
+                if (row & 0x01) gfxPixel(x, y + 22);
             }
         }
+        if (board_type == FLAT) gfxDottedLine(0, 21, 63, 21);
     }
 
     void DrawIndicator() {
@@ -112,80 +137,6 @@ private:
 
     void DrawCrosshairs() {
         gfxLine(tx, 23, tx, 63);
-        gfxLine(0, ty + 22, 62, ty + 22);
-    }
-
-    void ProcessGameBoard(int tx, int ty) {
-        uint64_t next_gen[80];
-        global_density = 0;
-        local_density = 0;
-        for (int y = 0; y < 40; y++)
-        {
-            next_gen[y * 2] = 0; // Clear next generation board
-            next_gen[y * 2 + 1] = 0;
-            for (int x = 0; x < 64; x++)
-            {
-                bool live = ValueAtCell(x, y);
-                int ln = CountLiveNeighborsAt(x, y);
-
-                // 1: Any live cell with fewer than two live neighbours dies (referred to as underpopulation or exposure).
-                // 2: Any live cell with more than three live neighbours dies (referred to as overpopulation or overcrowding).
-                // Nothing to do to observe these rules, since we start with an empty board
-
-                // 3: Any live cell with two or three live neighbours lives, unchanged, to the next generation.
-                // 4: Any dead cell with exactly three live neighbours will come to life.
-                if (((ln == 2 || ln == 3) && live) || (ln == 3 && !live)) {
-                    int i = y * 2;
-                    int xb = x;
-                    if (x > 31) {
-                        i += 1;
-                        xb -= 32;
-                    }
-                    next_gen[i] = next_gen[i] | (0x01 << xb);
-                    global_density++;
-
-                    if (GOL_ABS(tx - x) < 8 && GOL_ABS(ty - y) < 8) local_density++;
-                }
-            }
-        }
-
-        memcpy(&board, &next_gen, sizeof(next_gen));
-    }
-
-    int CountLiveNeighborsAt(int x, int y) {
-        int count = 0;
-        for (int nx = -1; nx < 2; nx++)
-        {
-            for (int ny = -1; ny < 2; ny++)
-            {
-                if (!(nx == 0 && ny == 0)) count += ValueAtCell(x + nx, y + ny);
-            }
-         }
-        return count;
-    }
-
-    bool ValueAtCell(int x, int y) {
-        // Toroid operation
-        if (x > 63) x -= 64;
-        if (x < 0) x += 64;
-        if (y > 39) y -= 40;
-        if (y < 0) y += 40;
-
-        int i = y * 2;
-        if (x > 31) {
-            i += 1;
-            x -= 32;
-        }
-        return ((board[i] >> x) & 0x01);
-    }
-
-    void AddToBoard(int x, int y) {
-        int i = y * 2;
-        int xb = x;
-        if (x > 31) {
-            i += 1;
-            xb -= 32;
-        }
-        board[i] = board[i] | (0x01 << xb);
+        gfxLine(0, ty * 40 / board.rows() + 22, 62, ty * 40 / board.rows() + 22);
     }
 };
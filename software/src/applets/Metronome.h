@@ -76,9 +76,9 @@ protected:
 private:
     void DrawInterface() {
         gfxIcon(1, 15, NOTE4_ICON);
-        gfxPrint(9, 15, "= ");
-        gfxPrint(pad(100, HS::clock_m.GetTempo()), clock_m.GetTempo());
-        gfxPrint(" BPM");
+        gfxPrint(9, 15, "=");
+        gfxGlyphsRight(weegfx::numerals_10, 39, 13, clock_m.GetTempo());
+        gfxPrint(40, 15, "BPM");
 
         DrawMetronome();
     }
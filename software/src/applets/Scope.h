@@ -18,6 +18,8 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include "../HSScopeCapture.h"
+
 #define SCOPE_CURRENT_SETTING_TIMEOUT 50001
 const uint8_t HEM_PPQN_VALUES[] = {1, 2, 4, 8, 16, 24};
 
@@ -32,6 +34,12 @@ public:
     XY_MODE,
   };
 
+  enum TriggerMode {
+    ROLL, // free-running, scrolling
+    NORMAL,
+    SINGLE,
+  };
+
     const char* applet_name() {
         return "Scope";
     }
@@ -45,6 +53,8 @@ public:
         last_scope_tick = 0;
         current_setting = 0;
         current_display = 0;
+        capture.Init();
+        ConfigureCapture();
     }
 
     void Controller() {
@@ -73,19 +83,24 @@ public:
                 ++sample_num %= 128;
 
                 for (int n = 0; n < 2; n++) {
-                  int sample = Proportion(In(n) + HEMISPHERE_MAX_INPUT_CV, 2*HEMISPHERE_MAX_INPUT_CV, 255);
-                  sample = constrain(sample, 0, 255);
-                  snapshot[n][sample_num] = (uint8_t)sample;
+                  snapshot[n][sample_num] = Sample(In(n));
                 }
             }
 
+            // Captures look at every tick, whatever the rate
+            if (trigger_mode != ROLL) {
+                capture.set_ticks_per_column(sample_ticks);
+                capture.Process(Sample(In(0)), Sample(In(1)));
+            }
+
             ForEachChannel(ch) Out(ch, In(ch));
         }
     }
 
     void DrawFullScreen() {
       int thing = (current_display == XY_MODE) ? -1 : ((current_display & 0x2) >> 1);
-      DrawInputFull(thing);
+      if (thing >= 0 && trigger_mode != ROLL) DrawCapture(thing, true);
+      else DrawInputFull(thing);
       DrawCurrentSetting();
     }
 
@@ -94,7 +109,8 @@ public:
             DrawInputSmall(-1);
         } else {
             DrawBPM();
-            DrawInputSmall((current_display & 2) == 2);
+            if (trigger_mode == ROLL) DrawInputSmall((current_display & 2) == 2);
+            else DrawCapture((current_display & 2) == 2, false);
             PrintInput();
         }
         
@@ -105,7 +121,9 @@ public:
     }
 
     void OnButtonPress() {
-        if (current_setting == 2 && !EditMode()) // FREEZE button
+        if (current_setting == 2 && !EditMode() && trigger_mode == SINGLE) // ARM button
+            capture.Arm();
+        else if (current_setting == 2 && !EditMode()) // FREEZE button
             freeze = !freeze;
         else if (OC::CORE::ticks - last_encoder_move < SCOPE_CURRENT_SETTING_TIMEOUT) // params visible? toggle edit
             CursorToggle();
@@ -115,29 +133,45 @@ public:
 
     void OnEncoderMove(int direction) {
         if (!EditMode()) { // switch setting
-            MoveCursor(current_setting, direction, 2);
+            MoveCursor(current_setting, direction, 6);
         } else { // edit
             if(current_setting == 0) {
                 if (sample_ticks < 32) sample_ticks += direction;
                 else sample_ticks += direction * 10;
-                sample_ticks = constrain(sample_ticks, 2, 64000);
+                sample_ticks = constrain(sample_ticks, 1, 64000);
             } else if(current_setting == 1) {
                 current_display = constrain(current_display + direction, 0, 4);
+            } else if(current_setting == 3) {
+                trigger_mode = constrain(trigger_mode + direction, 0, 2);
+                ConfigureCapture();
+                capture.Arm();
+            } else if(current_setting == 4) {
+                trigger_level = constrain(trigger_level + direction * 2, 0, 255);
+                ConfigureCapture();
+            } else if(current_setting == 5) {
+                trigger_slope = !trigger_slope;
+                ConfigureCapture();
+            } else if(current_setting == 6) {
+                pre_trigger = constrain(pre_trigger + direction * 10, 0, 90);
+                ConfigureCapture();
             }
         }
         last_encoder_move = OC::CORE::ticks;
     }
         
     uint64_t OnDataRequest() {
-        uint64_t data = 0;
-        // example: pack property_name at bit 0, with size of 8 bits
-        // Pack(data, PackLocation {0,8}, property_name); 
-        return data;
+        const HS::ScopeSettings settings = {trigger_mode, trigger_level, trigger_slope, pre_trigger};
+        return settings.Save();
     }
 
     void OnDataReceive(uint64_t data) {
-        // example: unpack value at bit 0 with size of 8 bits to property_name
-        // property_name = Unpack(data, PackLocation {0,8}); 
+        const HS::ScopeSettings settings = HS::ScopeSettings::Restore(data);
+        trigger_mode = constrain(settings.mode, 0, 2);
+        trigger_level = settings.level;
+        trigger_slope = settings.slope;
+        pre_trigger = constrain(settings.pre_trigger, 0, 90);
+        ConfigureCapture();
+        capture.Arm();
     }
 
 protected:
@@ -173,6 +207,25 @@ private:
     int last_encoder_move; // The last the the sample_ticks value was changed
     int last_scope_tick; // Used to auto-calculate sample countdown
 
+    // Triggered capture, from input 1, one column per sample_ticks
+    HS::ScopeCapture capture;
+    int trigger_mode = ROLL;
+    int trigger_level = HS::ScopeSettings::DEFAULT_LEVEL; // in the same 0..255 as the samples
+    bool trigger_slope = 0; // 0 = rising, 1 = falling
+    int pre_trigger = HS::ScopeSettings::DEFAULT_PRE_TRIGGER; // % of the display before the trigger
+
+    uint8_t Sample(int cv) {
+        int sample = Proportion(cv + HEMISPHERE_MAX_INPUT_CV, 2*HEMISPHERE_MAX_INPUT_CV, 255);
+        return (uint8_t)constrain(sample, 0, 255);
+    }
+
+    void ConfigureCapture() {
+        capture.set_mode(trigger_mode == SINGLE ? HS::ScopeCapture::SINGLE : HS::ScopeCapture::NORMAL);
+        capture.set_level(trigger_level);
+        capture.set_slope(trigger_slope ? HS::ScopeCapture::FALLING : HS::ScopeCapture::RISING);
+        capture.set_pre_trigger(pre_trigger * HS::ScopeCapture::COLUMNS / 100);
+    }
+
     void DrawBPM() {
         gfxPrint(9, 15, "BPM ");
         gfxPrint(bpm / 4);
@@ -195,9 +248,27 @@ private:
                     gfxPrint("+");
                     gfxPrint((current_display & 1) == 1 ? 2 : 1);
                 }
+            } else if(current_setting == 2 && trigger_mode == SINGLE) {
+                const char * const states[] = {"wait", "trig", "done"};
+                gfxPrint(1, 26, "Arm ");
+                gfxPrint(states[capture.state()]);
             } else if(current_setting == 2) {
                 gfxPrint(1, 26, "Freeze ");
                 gfxPrint(freeze ? "ON" : "OFF");
+            } else if(current_setting == 3) {
+                const char * const modes[] = {"Roll", "Normal", "Single"};
+                gfxPrint(1, 26, "Trig ");
+                gfxPrint(modes[trigger_mode]);
+            } else if(current_setting == 4) {
+                gfxPrint(1, 26, "Lvl ");
+                gfxPrintVoltage(Proportion(trigger_level, 255, 2*HEMISPHERE_MAX_INPUT_CV) - HEMISPHERE_MAX_INPUT_CV);
+            } else if(current_setting == 5) {
+                gfxPrint(1, 26, "Slope ");
+                gfxPrint(trigger_slope ? "Fall" : "Rise");
+            } else if(current_setting == 6) {
+                gfxPrint(1, 26, "Pre ");
+                gfxPrint(pre_trigger);
+                gfxPrint("%");
             }
 
             if (EditMode()) gfxInvert(1, 25, 31, 9);
@@ -230,6 +301,36 @@ private:
         gfxPixel(px, py);
       }
     }
+    // The last capture, as a line from min to max for each column, with the
+    // trigger point marked
+    void DrawCapture(const int input, const bool full) {
+      const int width = full ? 128 : 64;
+      const int height = full ? 63 : 28;
+      const int x0 = full ? 0 : gfx_offset;
+      const int per_px = HS::ScopeCapture::COLUMNS / width;
+      const uint8_t *lo = capture.min(input);
+      const uint8_t *hi = capture.max(input);
+      auto to_y = [height](int sample) {
+        int py = Proportion(sample, 255, height);
+        return constrain((height - py) + (63 - height)/2 + 10, 0, 63);
+      };
+
+      for (int x = 0; x < width; x++)
+      {
+        uint8_t mn = 255, mx = 0;
+        for (int c = x * per_px; c < (x + 1) * per_px; c++) {
+          if (lo[c] < mn) mn = lo[c];
+          if (hi[c] > mx) mx = hi[c];
+        }
+        const int top = to_y(mx);
+        graphics.drawVLine(x0 + x, top, to_y(mn) - top + 1);
+      }
+
+      const int tx = x0 + capture.trigger_column() / per_px;
+      graphics.drawVLinePattern(tx, 25, 38, 0x55);
+      graphics.drawHLine(x0, to_y(trigger_level), 3);
+    }
+
     void DrawInputFull(const int input) {
       const int width = 127;
       const int height = (input < 0) ? 54 : 63;
@@ -30,12 +30,17 @@
 // hardware only works with TR1 or TR2...
 
 #include "../src/drivers/FreqMeasure/OC_FreqMeasure.h"
+#include "../HSPitchDetector.h"
 
 #if defined(ARDUINO_TEENSY41)
 
 #define TUNER_ENABLED 1
 // TR2 on left, TR4 on right
 #define TUNER_PIN (hemisphere == 0 ? 1 : 22)
+// The audio inputs can be tuned too, at half the audio rate: 43Hz and up
+#define TUNER_AUDIO_RATE (AUDIO_SAMPLE_RATE_EXACT / 2.0f)
+typedef HS::PitchDetector<int16_t, 512, 512> TunerAudioDetector;
+DMAMEM TunerAudioDetector tuner_audio_detector[HS::APPLET_SLOTS];
 
 #elif defined(ARDUINO_TEENSY40)
 #define TUNER_ENABLED (hemisphere == OC::calibration_data.flipcontrols())
@@ -45,6 +50,9 @@
 
 static constexpr double HEM_TUNER_AaboveMidCtoC0 = 0.03716272234383494188492;
 
+// Analysis runs from View(), a slice at a time, so a long frame never holds up the ISR
+static constexpr int HEM_TUNER_LAGS_PER_VIEW = 64;
+
 class Tuner : public HemisphereApplet {
 public:
 
@@ -55,46 +63,36 @@ public:
 
     void Start() {
         A4_Hz = 440;
-        if (TUNER_ENABLED) {
-#if defined(ARDUINO_TEENSY41)
-            freq_measure.begin(TUNER_PIN);
-#else
-            freq_measure.begin();
-#endif
-        }
+        Listen();
         AllowRestart();
     }
     void Unload() {
-      if (TUNER_ENABLED) {
-        freq_measure.end();
-        OC::DigitalInputs::reInit();
-      }
+      StopListening();
     }
 
     void Controller() {
-        if (TUNER_ENABLED && freq_measure.available())
-        {
-            // average several readings together
-            freq_sum_ = freq_sum_ + freq_measure.read();
-            freq_count_ = freq_count_ + 1;
-
-            if (milliseconds_since_last_freq_ > 750) {
-                frequency_ = freq_measure.countToFrequency(freq_sum_ / freq_count_);
-                freq_sum_ = 0;
-                freq_count_ = 0;
-                milliseconds_since_last_freq_ = 0;
+        if (listening == TRIG_SOURCE) {
+            // Just keep the periods; they're analysed in View()
+            while (freq_measure.available()) {
+                periods[period_count % PERIOD_RING] = freq_measure.read();
+                period_count = period_count + 1;
             }
-        } else if (milliseconds_since_last_freq_ > 100000) {
-            frequency_ = 0.0f;
         }
+        if (milliseconds_since_last_freq_ > 100000) frequency_ = 0.0f;
     }
 
     void View() {
-        if (TUNER_ENABLED) DrawTuner();
+        if (TUNER_ENABLED) {
+            Analyse();
+            DrawTuner();
+        }
         else DrawWarning();
     }
 
     void OnButtonPress() {
+#if defined(ARDUINO_TEENSY41)
+        source = 1 - source; // trig, audio, and back to trig
+#endif
         Start();
     }
 
@@ -105,11 +103,16 @@ public:
     uint64_t OnDataRequest() {
         uint64_t data = 0;
         Pack(data, PackLocation {0,16}, A4_Hz);
+        Pack(data, PackLocation {16,1}, source);
         return data;
     }
 
     void OnDataReceive(uint64_t data) {
         A4_Hz = Unpack(data, PackLocation {0,16});
+#if defined(ARDUINO_TEENSY41)
+        source = Unpack(data, PackLocation {16,1});
+        if (listening >= 0 && listening != source) Listen();
+#endif
     }
 
 protected:
@@ -132,7 +135,11 @@ protected:
           help[HELP_DIGITAL2] = "Input";
         }
         help[HELP_EXTRA1] = "Enc: Adjust A4 Hz,";
+#if defined(ARDUINO_TEENSY41)
+        help[HELP_EXTRA2] = "Push: Trig/Audio in";
+#else
         help[HELP_EXTRA2] = "     Push to Reset";
+#endif
       } else {
         help[HELP_DIGITAL1] = "";
         help[HELP_DIGITAL2] = "";
@@ -143,14 +150,99 @@ protected:
     }
 
 private:
+    enum Source { TRIG_SOURCE, AUDIO_SOURCE };
+
+    // Periods from FreqMeasure. The detector looks for a repeating pattern in them, so an
+    // input that triggers more than once per cycle still reads at its fundamental.
+    static constexpr int PERIOD_WINDOW = 24;
+    static constexpr int PERIOD_MAX_LAG = 8; // triggers per cycle, plus one
+    typedef HS::PitchDetector<int32_t, PERIOD_WINDOW, PERIOD_MAX_LAG> PeriodDetector;
+    static constexpr int PERIOD_RING = 64; // slack for the ISR to add more while they're copied
+    static constexpr int PERIODS_PER_FRAME = 8; // new ones to wait for between analyses
+    static constexpr int32_t PERIOD_JITTER = 3; // counts a steady input's periods can stray by
+
     // Port from References
-    double freq_sum_;
-    uint32_t freq_count_;
     float frequency_ ;
     elapsedMillis milliseconds_since_last_freq_;
     int A4_Hz; // Tuning reference
     FreqMeasureClass freq_measure;
 
+    int source = TRIG_SOURCE;
+    int listening = -1; // the source that's running, if any
+    uint32_t periods[PERIOD_RING];
+    volatile uint32_t period_count = 0;
+    uint32_t analysed_count = 0; // period_count at the last analysis
+    PeriodDetector period_detector;
+
+    void Listen() {
+        StopListening();
+        if (!TUNER_ENABLED) return;
+        period_count = 0;
+        analysed_count = 0;
+        listening = source;
+#if defined(ARDUINO_TEENSY41)
+        if (source == AUDIO_SOURCE) {
+            tuner_audio_detector[hemisphere].Init();
+            OC::AudioDSP::TunerListen(hemisphere & 1);
+            return;
+        }
+        freq_measure.begin(TUNER_PIN);
+#else
+        freq_measure.begin();
+#endif
+    }
+
+    void StopListening() {
+        if (listening < 0) return;
+#if defined(ARDUINO_TEENSY41)
+        if (listening == AUDIO_SOURCE) OC::AudioDSP::TunerListen(-1);
+        else
+#endif
+        {
+            freq_measure.end();
+            OC::DigitalInputs::reInit();
+        }
+        listening = -1;
+    }
+
+    // Carry on with the current analysis, or start the next one when there's something new
+    void Analyse() {
+#if defined(ARDUINO_TEENSY41)
+        if (listening == AUDIO_SOURCE) {
+            TunerAudioDetector &detector = tuner_audio_detector[hemisphere];
+            if (!detector.busy()) {
+                if (!OC::AudioDSP::TunerSamples(detector.buffer(), TunerAudioDetector::BUFFER_SIZE))
+                    return;
+                detector.Start();
+            }
+            if (detector.Step(HEM_TUNER_LAGS_PER_VIEW) && detector.period() > 0.0f) {
+                frequency_ = TUNER_AUDIO_RATE / detector.period();
+                milliseconds_since_last_freq_ = 0;
+            }
+            return;
+        }
+#endif
+        if (listening != TRIG_SOURCE) return;
+        const uint32_t count = period_count;
+        if (count < PeriodDetector::BUFFER_SIZE || count - analysed_count < PERIODS_PER_FRAME) return;
+        analysed_count = count;
+
+        // The newest periods, oldest first
+        int32_t *x = period_detector.buffer();
+        for (int i = 0; i < PeriodDetector::BUFFER_SIZE; ++i)
+            x[i] = periods[(count - PeriodDetector::BUFFER_SIZE + i) % PERIOD_RING];
+        period_detector.Run(); // small enough to do in one go
+
+        // Average over whole cycles of k triggers
+        const int k = HS::PeriodsPerCycle(x, PeriodDetector::BUFFER_SIZE, period_detector.lag(), PERIOD_JITTER);
+        const int cycles = PeriodDetector::BUFFER_SIZE / k;
+        float sum = 0.0f;
+        for (int i = PeriodDetector::BUFFER_SIZE - cycles * k; i < PeriodDetector::BUFFER_SIZE; ++i)
+            sum += x[i];
+        frequency_ = freq_measure.countToFrequency(1) * cycles / sum;
+        milliseconds_since_last_freq_ = 0;
+    }
+
     void DrawTuner() {
         float frequency_ = get_frequency() ;
         float c0_freq_ = get_C0_freq() ;
@@ -193,16 +285,19 @@ private:
 
             }
 
-            // Draw frequency
+            // Draw frequency, dropping decimals as it grows so it stays clear of the source label
             const int f = int(floor(frequency_ * 100));
-            const int value = f / 100;
-            const int cents = f % 100;
-            gfxPrint(6 + pad(10000, value), 54, value);
-            gfxPrint(".");
-            if (cents < 10) gfxPrint("0");
-            gfxPrint(cents);
+            char freq_str[12];
+            if (f < 100000) snprintf(freq_str, sizeof(freq_str), "%d.%02d", f / 100, f % 100);
+            else if (f < 1000000) snprintf(freq_str, sizeof(freq_str), "%d.%d", f / 100, (f / 10) % 10);
+            else snprintf(freq_str, sizeof(freq_str), "%d", f / 100);
+            gfxGlyphsRight(weegfx::numerals_10, 63, 52, freq_str);
         }
 
+#if defined(ARDUINO_TEENSY41)
+        gfxPrint(1, 55, source == AUDIO_SOURCE ? "Aud" : "Trg");
+#endif
+
         gfxPrint(1, 15, "A4= ");
         gfxPrint(A4_Hz);
         gfxPrint(" Hz");
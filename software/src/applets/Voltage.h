@@ -54,6 +54,7 @@ public:
     void View() {
         DrawInterface();
     }
+    bool CachedView() { return true; }
 
     //void OnButtonPress() { }
 
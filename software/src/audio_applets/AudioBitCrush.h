@@ -0,0 +1,36 @@
+#pragma once
+
+#include "../AudioApplet.h"
+
+// Bit depth and sample rate reduction together, from clean at 0V down to
+// 4 bits and 1/16 of the sample rate at 6V.
+class AudioBitCrush : public AudioApplet {
+public:
+    const char* applet_name() {
+        return "Crush";
+    }
+
+    void Start() {
+        held_ = 0;
+        count_ = 0;
+    }
+
+    void ProcessBlock(const int16_t *in, int16_t *out, size_t n) {
+        int32_t depth = ModQ15();
+        const int bits = 16 - ((depth * 12 + 16384) >> 15);
+        const int hold = 1 + ((depth * 15 + 16384) >> 15);
+        const int16_t mask = static_cast<int16_t>(0xffff << (16 - bits));
+
+        for (size_t i = 0; i < n; ++i) {
+            if (++count_ >= hold) {
+                count_ = 0;
+                held_ = in[i] & mask;
+            }
+            out[i] = held_;
+        }
+    }
+
+private:
+    int16_t held_ = 0;
+    int count_ = 0;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../AudioApplet.h"
+
+// Gain follows the mapped CV, 0V closed to 6V open. The gain ramps across
+// each block instead of stepping, so a control-rate CV doesn't zipper.
+class AudioVCA : public AudioApplet {
+public:
+    const char* applet_name() {
+        return "VCA";
+    }
+
+    void Start() {
+        gain_ = 0;
+    }
+
+    void ProcessBlock(const int16_t *in, int16_t *out, size_t n) {
+        int32_t target = ModQ15() << 16;
+        int32_t step = (target - gain_) / static_cast<int32_t>(n);
+        int32_t gain = gain_;
+        for (size_t i = 0; i < n; ++i) {
+            gain += step;
+            out[i] = (in[i] * (gain >> 16)) >> 15;
+        }
+        gain_ = target;
+    }
+
+private:
+    int32_t gain_ = 0; // Q15 in the top half, for a finer ramp
+};
@@ -93,13 +93,10 @@ public:
     void set_midi_channel(byte midi_channel_) {mc = constrain(midi_channel_, 0, 16);}
     void SetDeferredNote(int midi_note_) {deferred_note = midi_note_;}
 
-    /* Sends data to an output based on the current output type. The I/O methods
-     * are public methods of the app, so make sure to send a type that supports
-     * Out, ClockOut, and GateOut (i.e. HSApplication, or HemisphereApplet)
+    /* What SendToDAC() puts out for a register, before transposing: a pitch for the Note types,
+     * a CV for Modulation and Expression, and the low bit for Trigger and Gate.
      */
-    template <class C>
-    void SendToDAC(C *app, uint16_t reg, int transpose = 0) {
-
+    int DACValue(uint16_t reg) {
         // Quantize a note based on how many bits
         if (ty <= EnigmaOutputType::NOTE7) {
             byte bits = ty + 3; // Number of bits
@@ -108,24 +105,36 @@ public:
             int note_shift = ty == EnigmaOutputType::NOTE7 ? 0 : 64; // Note types under 7-bit start at Middle C
             int note_number = (reg & mask) + note_shift;
             note_number = constrain(note_number, 0, 127);
-            app->Out(out, quantizer.Lookup(note_number) + transpose);
+            return quantizer.Lookup(note_number);
         }
 
         // Modulation based on low 8 bits
-        if (ty == EnigmaOutputType::MODULATION || ty == EnigmaOutputType::EXPRESSION) {
-            app->Out(out, (reg & 0x00ff) * 6);
-        }
+        if (ty == EnigmaOutputType::MODULATION || ty == EnigmaOutputType::EXPRESSION) return (reg & 0x00ff) * 6;
+
+        return reg & 0x0001;
+    }
+
+    /* Sends data to an output based on the current output type. The I/O methods
+     * are public methods of the app, so make sure to send a type that supports
+     * Out, ClockOut, and GateOut (i.e. HSApplication, or HemisphereApplet)
+     */
+    template <class C>
+    void SendToDAC(C *app, uint16_t reg, int transpose = 0) {
+        SendValueToDAC(app, DACValue(reg), transpose);
+    }
+
+    /* The same, with a value from DACValue() worked out earlier */
+    template <class C>
+    void SendValueToDAC(C *app, int value, int transpose = 0) {
+        if (ty <= EnigmaOutputType::NOTE7) app->Out(out, value + transpose);
+
+        if (ty == EnigmaOutputType::MODULATION || ty == EnigmaOutputType::EXPRESSION) app->Out(out, value);
 
         // Trigger sends a clock when low bit is high
-        bool clock = reg & 0x0001;
-        if (ty == EnigmaOutputType::TRIGGER && clock) {
-            app->ClockOut(out);
-        }
+        if (ty == EnigmaOutputType::TRIGGER && value) app->ClockOut(out);
 
         // Gate goes high or low based on the low bit, and stays there until changed
-        if (ty == EnigmaOutputType::GATE) {
-            app->GateOut(out, clock);
-        }
+        if (ty == EnigmaOutputType::GATE) app->GateOut(out, value);
     }
 
     /* Sends data vi MIDI based on the current output type. */
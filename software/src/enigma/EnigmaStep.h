@@ -49,7 +49,7 @@ public:
         tk = (track_ << 6) | (tk & 0x3f);
     }
     void set_tm(byte tm_) {
-        if (tm_ > 39) tm_ = 39;
+        if (tm_ > HS::TURING_MACHINE_COUNT - 1) tm_ = HS::TURING_MACHINE_COUNT - 1;
         if (tm_ == 0xff) tm_ = 0;
         tk = (tk & 0xc0) | tm_;
     }
@@ -39,7 +39,14 @@
 
 namespace HS {
 
-const byte TURING_MACHINE_COUNT = 40; // Five banks of eight
+// Banks of eight machines, A-1 to A-8 and on. More banks need room in the global settings
+// storage, and song steps keep the machine in 6 bits, so there can be up to eight.
+#ifndef ENIGMA_TM_BANKS
+#define ENIGMA_TM_BANKS 5
+#endif
+static_assert(ENIGMA_TM_BANKS > 0 && ENIGMA_TM_BANKS <= 8, "ENIGMA_TM_BANKS must be 1 to 8");
+
+const byte TURING_MACHINE_COUNT = ENIGMA_TM_BANKS * 8;
 
 struct TuringMachine {
     uint16_t reg; // 16-bit shift register containing data
@@ -51,6 +51,9 @@ void PolyLfo::Init() {
   attenuation_ = 58880;
   offset_ = 0 ;
   freq_div_b_ = freq_div_c_ = freq_div_d_ = POLYLFO_FREQ_MULT_NONE ;
+  b_xor_a_ = 0 ;
+  c_xor_a_ = 0 ;
+  d_xor_a_ = 0 ;
   b_am_by_a_ = 0 ;
   c_am_by_b_ = 0 ;
   d_am_by_c_ = 0 ;
@@ -58,10 +61,14 @@ void PolyLfo::Init() {
   sync_counter_ = 0 ;
   sync_ = false;
   period_ = 0 ;
+  sync_phase_increment_ = 0;
+  phase_increment_ch1_ = 0;
   std::fill(&value_[0], &value_[kNumChannels], 0);
   std::fill(&wt_value_[0], &wt_value_[kNumChannels], 0);
   std::fill(&phase_[0], &phase_[kNumChannels], 0);
-  last_phase_difference_ = 0;
+  std::fill(&level_[0], &level_[kNumChannels], 0);
+  std::fill(&dac_code_[0], &dac_code_[kNumChannels], 0);
+  phase_difference_ = 0;
   last_phase_difference_ = 0;
   pattern_predictor_.Init();
 }
@@ -131,7 +138,7 @@ uint32_t PolyLfo::FrequencyToPhaseIncrement(int32_t frequency, uint16_t frq_rng)
   return (a + ((b - a) * (index & 0x1f) >> 5)) << shifts;
 }
 
-void PolyLfo::Render(int32_t frequency, bool reset_phase, bool tempo_sync, uint8_t freq_mult) {
+void PolyLfo::AdvancePhases(int32_t frequency, bool reset_phase, bool tempo_sync, uint8_t freq_mult) {
     ++sync_counter_;
     if (tempo_sync && sync_) {
         if (sync_counter_ < kSyncCounterMaxTime) {
@@ -206,7 +213,11 @@ void PolyLfo::Render(int32_t frequency, bool reset_phase, bool tempo_sync, uint8
     }
     last_phase_difference_ = phase_difference_;
   }
-  
+}
+
+void PolyLfo::Render(int32_t frequency, bool reset_phase, bool tempo_sync, uint8_t freq_mult) {
+  AdvancePhases(frequency, reset_phase, tempo_sync, freq_mult);
+
   const uint8_t* sine = &wt_lfo_waveforms[17 * 257];
   
   uint16_t wavetable_index = shape_;
@@ -241,6 +252,86 @@ void PolyLfo::Render(int32_t frequency, bool reset_phase, bool tempo_sync, uint8
   }
 }
 
+inline void PolyLfo::RenderTick(const BlockParams &params) {
+  const uint8_t* sine = &wt_lfo_waveforms[17 * 257];
+  for (uint8_t i = 0; i < kNumChannels; ++i) {
+    uint32_t phase = phase_[i] + value_[params.coupling_src[i]] * params.coupling;
+    wt_value_[i] = Crossfade(params.wt_a[i], params.wt_a[i] + 257, phase, params.wt_balance[i]);
+    value_[i] = Interpolate824(sine, phase);
+    uint16_t dac_code;
+    uint8_t depth_xor = params.xor_depth[i];
+    if (depth_xor) {
+      dac_code = (wt_value_[i] + 32768) ^ (((wt_value_[0] + 32768) >> depth_xor) << depth_xor);
+    } else {
+      dac_code = wt_value_[i] + 32768;
+    }
+    if (i > 0)
+      dac_code = (dac_code * (65535 - (((65535 - dac_code_[i-1]) * params.am_depth[i]) >> 8))) >> 16;
+    dac_code_[i] = ((dac_code * attenuation_) >> 16) + offset_;
+  }
+}
+
+void PolyLfo::RenderBlock(int32_t frequency, bool reset_phase, bool tempo_sync, uint8_t freq_mult,
+                          uint16_t *const out[kNumChannels], size_t size) {
+  if (!size)
+    return;
+
+  BlockParams params;
+  uint16_t wavetable_index = shape_;
+  for (uint8_t i = 0; i < kNumChannels; ++i) {
+    params.wt_a[i] = &wt_lfo_waveforms[(wavetable_index >> 12) * 257];
+    params.wt_balance[i] = wavetable_index << 4;
+    wavetable_index += shape_spread_;
+    params.coupling_src[i] = coupling_ > 0 ? (i + 1) % kNumChannels : (i + kNumChannels - 1) % kNumChannels;
+  }
+  params.coupling = coupling_ > 0 ? coupling_ : -coupling_;
+  params.xor_depth[0] = 0; params.xor_depth[1] = b_xor_a_; params.xor_depth[2] = c_xor_a_; params.xor_depth[3] = d_xor_a_;
+  params.am_depth[0] = 0; params.am_depth[1] = b_am_by_a_; params.am_depth[2] = c_am_by_b_; params.am_depth[3] = d_am_by_c_;
+
+  // Events, and re-locking the spread phases, are handled by the regular
+  // per-tick update. A reset tick doesn't advance, so that takes one more.
+  size_t tick = 0;
+  size_t event_ticks = (reset_phase || phase_reset_flag_) ? 2 : 1;
+  while (tick < size && tick < event_ticks) {
+    AdvancePhases(frequency, reset_phase, tempo_sync, freq_mult);
+    reset_phase = tempo_sync = false;
+    RenderTick(params);
+    for (uint8_t i = 0; i < kNumChannels; ++i)
+      out[i][tick] = dac_code_[i];
+    ++tick;
+  }
+
+  if (tick < size) {
+    // From here on every channel just advances by a constant increment; with
+    // positive spread the locked channels follow channel 1, otherwise the
+    // spread is a constant per-tick offset.
+    const uint32_t increment_ch1 = phase_increment_ch1_;
+    const PolyLfoFreqMultipliers freq_divs[] = {POLYLFO_FREQ_MULT_NONE, freq_div_b_, freq_div_c_ , freq_div_d_};
+    uint32_t increments[kNumChannels];
+    increments[0] = increment_ch1;
+    for (uint8_t i = 1; i < kNumChannels; ++i) {
+      uint32_t increment = freq_divs[i] == POLYLFO_FREQ_MULT_NONE
+        ? increment_ch1
+        : multiply_u32xu32_rshift24(increment_ch1, PolyLfoFreqMultNumerators[freq_divs[i]]);
+      if (spread_ < 0)
+        increment -= i * (increment_ch1 >> 16) * spread_;
+      increments[i] = increment;
+    }
+
+    sync_counter_ += size - tick;
+    for (; tick < size; ++tick) {
+      for (uint8_t i = 0; i < kNumChannels; ++i)
+        phase_[i] += increments[i];
+      RenderTick(params);
+      for (uint8_t i = 0; i < kNumChannels; ++i)
+        out[i][tick] = dac_code_[i];
+    }
+  }
+
+  for (uint8_t i = 0; i < kNumChannels; ++i)
+    level_[i] = (wt_value_[i] + 32768) >> 8;
+}
+
 void PolyLfo::RenderPreview(uint16_t shape, uint16_t *buffer, size_t size) {
   uint16_t wavetable_index = shape;
   uint32_t phase = 0;
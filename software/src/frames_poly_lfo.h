@@ -134,6 +134,11 @@ class PolyLfo {
   
   void Init();
   void Render(int32_t frequency, bool reset_phase, bool tempo_sync, uint8_t freq_mult);
+  // Render size ticks into out[channel][0..size), equivalent to calling
+  // Render() size times with the same parameters; reset and sync events only
+  // apply to the first tick. Parameters are resolved once per block.
+  void RenderBlock(int32_t frequency, bool reset_phase, bool tempo_sync, uint8_t freq_mult,
+                   uint16_t *const out[kNumChannels], size_t size);
   void RenderPreview(uint16_t shape, uint16_t *buffer, size_t size);
 
   inline void set_freq_range(uint16_t freq_range) {
@@ -269,6 +274,19 @@ class PolyLfo {
 
 
  private:
+  // Per-block constants for the wavetable/XOR/AM stage
+  struct BlockParams {
+    const uint8_t *wt_a[kNumChannels];
+    uint16_t wt_balance[kNumChannels];
+    uint8_t coupling_src[kNumChannels];
+    int32_t coupling;
+    uint8_t xor_depth[kNumChannels];
+    uint8_t am_depth[kNumChannels];
+  };
+
+  void AdvancePhases(int32_t frequency, bool reset_phase, bool tempo_sync, uint8_t freq_mult);
+  inline void RenderTick(const BlockParams &params) __attribute__((always_inline));
+
   uint16_t freq_range_ ;
   uint16_t shape_;
   int16_t shape_spread_;
@@ -21,6 +21,8 @@
 #ifndef LOGICGATE_H
 #define LOGICGATE_H
 
+#include "../HSLogicNetlist.h"
+
 // 0-7 are inputs, 8-13 are neuron outputs, 14 is ON and 15 is OFF
 #define LG_MAX_SOURCE 15
 
@@ -73,13 +75,10 @@ const uint8_t NN_LOGIC_ICON[12][16] = {
 
 
 
+// The gates are only a description. They're compiled into an HS::LogicNetlist to run, and the
+// state lives there.
 class LogicGate {
 public:
-    // State attribute
-    bool state; // Current state of the gate
-    bool clocked = 0; // State of clock for flipflops
-    uint16_t source_state; // Source bitfield, for display purposes
-
     // General attributes
     int type;
     int source1;
@@ -92,40 +91,29 @@ public:
     int weight3;
     int threshold;
 
-    /* Set the state based on gate type and source valutes */
-    bool Calculate(uint16_t source_state_) {
-        source_state = source_state_ | (0x01 << 14); // Add the ON state
-        bool v1 = source_value(source1);
-        bool v2 = source_value(source2);
-        bool v3 = source_value(source3);
-
-        switch(type) {
-            case LogicGateType::NOT        : state = not_fn(v1); break;
-            case LogicGateType::AND        : state = and_fn(v1, v2); break;
-            case LogicGateType::OR         : state = or_fn(v1, v2); break;
-            case LogicGateType::XOR        : state = xor_fn(v1, v2); break;
-            case LogicGateType::NAND       : state = !and_fn(v1, v2); break;
-            case LogicGateType::NOR        : state = !or_fn(v1, v2); break;
-            case LogicGateType::XNOR       : state = !xor_fn(v1, v2); break;
-            case LogicGateType::D_FLIPFLOP : state = d_flipflop_fn(v1, v2); break;
-            case LogicGateType::T_FLIPFLOP : state = t_flipflop_fn(v1, v2); break;
-            case LogicGateType::LATCH      : state = latch_fn(v1, v2); break;
-            case LogicGateType::TL_NEURON  : state = tl_neuron_fn(v1, v2, v3); break;
-            default                        : state = 0;
+    /* For compiling: sources become bits of the netlist's state word */
+    template <int gates>
+    HS::LogicGateSpec Spec() const {
+        typedef HS::LogicNetlist<gates> Netlist;
+        const int sources[3] = {source1, source2, source3};
+        HS::LogicGateSpec spec;
+        spec.type = type;
+        for (int s = 0; s < 3; ++s) {
+            spec.source[s] = sources[s] == 14 ? Netlist::ON_BIT
+                           : (sources[s] == 15 ? Netlist::OFF_BIT : sources[s]);
         }
-
-        return state;
+        spec.weight[0] = weight1;
+        spec.weight[1] = weight2;
+        spec.weight[2] = weight3;
+        spec.threshold = threshold;
+        return spec;
     }
 
-    bool SourceValue(byte s) {
-        bool v = 0;
-        if (s == 0) v = source_value(source1);
-        if (s == 1) v = source_value(source2);
-        if (s == 2) v = source_value(source3);
-        return v;
+    /* Which source feeds input s (0-2) */
+    int Source(byte s) {
+        return s == 0 ? source1 : (s == 1 ? source2 : source3);
     }
 
-
     /* How many cursor positions does this LogicGate use? */
     byte NumParam() {
         byte max;
@@ -151,7 +139,6 @@ public:
     void UpdateValue(byte cursor, int direction) {
         if (cursor == 0) {
             type = constrain(type + direction, LogicGateType::NONE, LogicGateType::TL_NEURON);
-            state = 0; // Reset when changing type
         }
         if (cursor == 1 && type > LogicGateType::NONE) {
             source1 = constrain(source1 + direction, 0, LG_MAX_SOURCE);
@@ -219,44 +206,6 @@ public:
     }
 
 private:
-    bool source_value(uint16_t source) {
-        uint16_t v = source_state & (0x01 << source);
-        return static_cast<bool>(v);
-    }
-
-    //////// LOGIC GATE EVALUATION
-    bool not_fn(bool a) {return !a;}
-    bool and_fn(bool a, bool b) {return a & b;}
-    bool or_fn(bool a, bool b) {return a | b;}
-    bool xor_fn(bool a, bool b) {return a != b;}
-    bool d_flipflop_fn(bool D, bool clock) {
-        // Handle clocking
-        if (!clock && clocked) clocked = 0;
-        if (clock && clocked) clock = 0;
-        if (clock && !clocked) clocked = 1;
-
-        if (clock) state = D;
-        return state;
-    }
-    bool t_flipflop_fn(bool T, bool clock) {
-        // Handle clocking
-        if (!clock && clocked) clocked = 0;
-        if (clock && clocked) clock = 0;
-        if (clock && !clocked) clocked = 1;
-
-        if (clock && T) state = 1 - state;
-        return state;
-    }
-    bool latch_fn(bool reset, bool set) {
-        if (reset) state = 0;
-        if (set) state = 1;
-        return state;
-    }
-    bool tl_neuron_fn(bool d1, bool d2, bool d3) {
-        int v = (d1 * weight1) + (d2 * weight2) + (d3 * weight3);
-        return (v > threshold);
-    }
-
     void draw_line_from(byte source, byte n) {
         byte fx;
         byte fy;
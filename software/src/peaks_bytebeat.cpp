@@ -56,7 +56,7 @@ void ByteBeat::Init() {
   p2_ = 127;
   stepmode_ = false ;
   last_sample_ = 13 ;
-
+  program_ = nullptr;
 }
 
 uint16_t ByteBeat::ProcessSingleSample(uint8_t control) {
@@ -86,6 +86,13 @@ uint16_t ByteBeat::ProcessSingleSample(uint8_t control) {
   }
 
   if (!stepmode_ && (phase_ % bytepitch_ == 0)) ++t_; 
+
+  if (program_) {
+    sample = program_->Eval(t_, p0_, p1_, p2_, pitch_);
+    last_sample_ = sample;
+    return sample << 8;
+  }
+
 // These equations push the boundaries of precedence comprehension.
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wparentheses"
@@ -40,6 +40,7 @@
 #include "extern/stmlib_utils_dsp.h"
 
 #include "peaks_gate_processor.h"
+#include "peaks_bytebeat_vm.h"
 
 namespace peaks {
 
@@ -101,6 +102,11 @@ class ByteBeat {
     p2_ = parameter >> 8;
   }
 
+  // Use a compiled formula instead of the built-in equation, or NULL
+  inline void set_program(ByteBeatProgram *program) {
+    program_ = program;
+  }
+
   inline void set_loop_mode(bool loopmode) {
     loopmode_ = loopmode ;
   }
@@ -162,6 +168,7 @@ class ByteBeat {
 
   uint16_t equation_index_ ;
   uint16_t bytepitch_ ;
+  ByteBeatProgram *program_;
   
   DISALLOW_COPY_AND_ASSIGN(ByteBeat);
 };
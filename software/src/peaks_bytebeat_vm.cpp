@@ -0,0 +1,378 @@
+// Byte beat formula compiler.
+
+#include <string.h>
+#include "peaks_bytebeat_vm.h"
+
+namespace peaks {
+
+const char * const bytebeat_token_names[BYTEBEAT_TOKEN_LAST] = {
+  "", "t", "p0", "p1", "p2", "pitch",
+  "0", "1", "2", "3", "4", "5", "6", "7", "8", "9",
+  "+", "-", "*", "/", "%", "&", "|", "^", "~", "<<", ">>", "(", ")"
+};
+
+int TokenizeByteBeat(const char *formula, uint8_t *tokens, size_t max_tokens) {
+  size_t num_tokens = 0;
+  const char *c = formula;
+  while (*c) {
+    if (*c == ' ') {
+      ++c;
+      continue;
+    }
+    // Longest match, so "p0" isn't read as "p" and "pitch" isn't "p"
+    uint8_t token = BYTEBEAT_TOKEN_NONE;
+    size_t token_length = 0;
+    for (uint8_t t = BYTEBEAT_TOKEN_NONE + 1; t < BYTEBEAT_TOKEN_LAST; ++t) {
+      size_t length = strlen(bytebeat_token_names[t]);
+      if (length > token_length && !strncmp(c, bytebeat_token_names[t], length)) {
+        token = t;
+        token_length = length;
+      }
+    }
+    if (!token || num_tokens >= max_tokens)
+      return -1 - (c - formula);
+    tokens[num_tokens++] = token;
+    c += token_length;
+  }
+  return num_tokens;
+}
+
+// Recursive descent over the token string, one function per precedence
+// level. Operands are either a register or a constant; operations on two
+// constants are folded, constants only get a register when they meet a
+// variable. Temporaries are allocated like a stack from the bottom of the
+// register file, constants from the top.
+class ByteBeatCompiler {
+public:
+  ByteBeatCompiler(ByteBeatProgram &program, const uint8_t *tokens, size_t num_tokens)
+  : program_(program)
+  , tokens_(tokens)
+  , num_tokens_(num_tokens)
+  , pos_(0)
+  , next_temp_(ByteBeatProgram::REGISTER_FIRST_FREE)
+  , next_constant_(ByteBeatProgram::kNumRegisters)
+  , error_(false)
+  { }
+
+  bool Compile() {
+    Operand result = ParseBinary(0);
+    if (!error_ && pos_ != num_tokens_)
+      error_ = true;
+    if (!error_)
+      program_.result_ = Materialize(result);
+    if (!error_)
+      Append(BYTEBEAT_OP_END, 0, 0, 0);
+    return !error_;
+  }
+
+  size_t pos() const {
+    return pos_;
+  }
+
+private:
+  struct Operand {
+    bool constant;
+    uint8_t reg;
+    uint32_t value;
+  };
+
+  struct BinaryOperator {
+    uint8_t token;
+    uint8_t op;
+  };
+
+  // Lowest to highest precedence
+  static constexpr size_t kNumLevels = 6;
+  static const BinaryOperator binary_operators_[kNumLevels][4];
+
+  ByteBeatProgram &program_;
+  const uint8_t *tokens_;
+  size_t num_tokens_;
+  size_t pos_;
+  uint8_t next_temp_;
+  uint8_t next_constant_;
+  bool error_;
+
+  uint8_t peek() const {
+    return pos_ < num_tokens_ ? tokens_[pos_] : static_cast<uint8_t>(BYTEBEAT_TOKEN_NONE);
+  }
+
+  static Operand Constant(uint32_t value) {
+    return { true, 0, value };
+  }
+
+  static Operand Register(uint8_t reg) {
+    return { false, reg, 0 };
+  }
+
+  Operand Error() {
+    error_ = true;
+    return Constant(0);
+  }
+
+  uint8_t Materialize(const Operand &operand) {
+    if (!operand.constant)
+      return operand.reg;
+    if (!operand.value)
+      return ByteBeatProgram::REGISTER_ZERO;
+
+    for (uint8_t r = next_constant_; r < ByteBeatProgram::kNumRegisters; ++r) {
+      if (program_.regs_[r] == operand.value)
+        return r;
+    }
+    if (next_constant_ <= next_temp_) {
+      error_ = true;
+      return ByteBeatProgram::REGISTER_ZERO;
+    }
+    program_.regs_[--next_constant_] = operand.value;
+    return next_constant_;
+  }
+
+  void Release(uint8_t reg) {
+    if (reg >= ByteBeatProgram::REGISTER_FIRST_FREE && reg + 1 == next_temp_)
+      --next_temp_;
+  }
+
+  Operand Emit(uint8_t op, const Operand &a, const Operand &b) {
+    if (error_)
+      return Constant(0);
+    if (a.constant && b.constant)
+      return Constant(ByteBeatProgram::Apply(op, a.value, b.value));
+
+    uint8_t reg_a = Materialize(a);
+    uint8_t reg_b = Materialize(b);
+    // b was allocated after a, so release in reverse order
+    Release(reg_b);
+    Release(reg_a);
+
+    if (next_temp_ >= next_constant_)
+      return Error();
+    Append(op, next_temp_, reg_a, reg_b);
+    return Register(next_temp_++);
+  }
+
+  void Append(uint8_t op, uint8_t dst, uint8_t a, uint8_t b) {
+    // Always leave room for END
+    const size_t reserved = op != BYTEBEAT_OP_END ? 1 : 0;
+    if (program_.num_instructions_ + reserved >= ByteBeatProgram::kMaxInstructions) {
+      error_ = true;
+      return;
+    }
+    ByteBeatInstruction &instruction = program_.code_[program_.num_instructions_];
+    if (op != BYTEBEAT_OP_END && program_.num_instructions_) {
+      const uint8_t last = program_.code_[program_.num_instructions_ - 1].dst;
+      if (a == last)
+        op += BYTEBEAT_OP_ACC_A;
+      else if (b == last)
+        op += BYTEBEAT_OP_ACC_B;
+    }
+    instruction.op = op;
+    instruction.dst = dst;
+    instruction.a = a;
+    instruction.b = b;
+    if (op != BYTEBEAT_OP_END)
+      ++program_.num_instructions_;
+  }
+
+  Operand ParseBinary(size_t level) {
+    if (level >= kNumLevels)
+      return ParseUnary();
+
+    Operand lhs = ParseBinary(level + 1);
+    while (!error_) {
+      const uint8_t token = peek();
+      const BinaryOperator *binary_operator = binary_operators_[level];
+      while (binary_operator->token && binary_operator->token != token)
+        ++binary_operator;
+      if (!binary_operator->token)
+        break;
+      ++pos_;
+      Operand rhs = ParseBinary(level + 1);
+      lhs = Emit(binary_operator->op, lhs, rhs);
+    }
+    return lhs;
+  }
+
+  Operand ParseUnary() {
+    switch (peek()) {
+      case BYTEBEAT_TOKEN_SUB: ++pos_; return Emit(BYTEBEAT_OP_NEG, ParseUnary(), Constant(0));
+      case BYTEBEAT_TOKEN_NOT: ++pos_; return Emit(BYTEBEAT_OP_NOT, ParseUnary(), Constant(0));
+      case BYTEBEAT_TOKEN_ADD: ++pos_; return ParseUnary();
+      default: break;
+    }
+    return ParsePrimary();
+  }
+
+  Operand ParsePrimary() {
+    const uint8_t token = peek();
+    switch (token) {
+      case BYTEBEAT_TOKEN_T: ++pos_; return Register(ByteBeatProgram::REGISTER_T);
+      case BYTEBEAT_TOKEN_P0: ++pos_; return Register(ByteBeatProgram::REGISTER_P0);
+      case BYTEBEAT_TOKEN_P1: ++pos_; return Register(ByteBeatProgram::REGISTER_P1);
+      case BYTEBEAT_TOKEN_P2: ++pos_; return Register(ByteBeatProgram::REGISTER_P2);
+      case BYTEBEAT_TOKEN_PITCH: ++pos_; return Register(ByteBeatProgram::REGISTER_PITCH);
+      case BYTEBEAT_TOKEN_OPEN: {
+        ++pos_;
+        Operand operand = ParseBinary(0);
+        if (error_ || peek() != BYTEBEAT_TOKEN_CLOSE)
+          return Error();
+        ++pos_;
+        return operand;
+      }
+      default: break;
+    }
+
+    if (token >= BYTEBEAT_TOKEN_0 && token <= BYTEBEAT_TOKEN_9) {
+      uint32_t value = 0;
+      while (peek() >= BYTEBEAT_TOKEN_0 && peek() <= BYTEBEAT_TOKEN_9)
+        value = value * 10 + (tokens_[pos_++] - BYTEBEAT_TOKEN_0);
+      return Constant(value);
+    }
+    return Error();
+  }
+};
+
+const ByteBeatCompiler::BinaryOperator ByteBeatCompiler::binary_operators_[kNumLevels][4] = {
+  { { BYTEBEAT_TOKEN_OR, BYTEBEAT_OP_OR }, { 0, 0 } },
+  { { BYTEBEAT_TOKEN_XOR, BYTEBEAT_OP_XOR }, { 0, 0 } },
+  { { BYTEBEAT_TOKEN_AND, BYTEBEAT_OP_AND }, { 0, 0 } },
+  { { BYTEBEAT_TOKEN_SHL, BYTEBEAT_OP_SHL }, { BYTEBEAT_TOKEN_SHR, BYTEBEAT_OP_SHR }, { 0, 0 } },
+  { { BYTEBEAT_TOKEN_ADD, BYTEBEAT_OP_ADD }, { BYTEBEAT_TOKEN_SUB, BYTEBEAT_OP_SUB }, { 0, 0 } },
+  { { BYTEBEAT_TOKEN_MUL, BYTEBEAT_OP_MUL }, { BYTEBEAT_TOKEN_DIV, BYTEBEAT_OP_DIV }, { BYTEBEAT_TOKEN_MOD, BYTEBEAT_OP_MOD }, { 0, 0 } },
+};
+
+void ByteBeatProgram::Init() {
+  memset(code_, 0, sizeof(code_));
+  memset(regs_, 0, sizeof(regs_));
+  num_instructions_ = 0;
+  result_ = REGISTER_ZERO;
+  error_pos_ = -1;
+}
+
+bool ByteBeatProgram::Compile(const uint8_t *tokens, size_t num_tokens) {
+  Init();
+  ByteBeatCompiler compiler(*this, tokens, num_tokens);
+  if (compiler.Compile())
+    return true;
+
+  Init();
+  error_pos_ = compiler.pos();
+  return false;
+}
+
+bool ByteBeatProgram::Compile(const char *formula) {
+  uint8_t tokens[kMaxTokens];
+  int num_tokens = TokenizeByteBeat(formula, tokens, kMaxTokens);
+  if (num_tokens < 0) {
+    Init();
+    error_pos_ = -1 - num_tokens;
+    return false;
+  }
+  if (Compile(tokens, num_tokens))
+    return true;
+
+  // Map token index back to character position
+  const char *c = formula;
+  for (int t = 0; t < error_pos_ && *c; ++t) {
+    while (*c == ' ') ++c;
+    c += strlen(bytebeat_token_names[tokens[t]]);
+  }
+  while (*c == ' ') ++c;
+  error_pos_ = c - formula;
+  return false;
+}
+
+#ifdef BYTEBEAT_USER_FORMULAS
+
+ByteBeatUserFormula bytebeat_user_formulas[kNumUserFormulas];
+
+const char * const bytebeat_user_formula_names[kNumUserFormulas + 1] = {
+  "off", "usr1", "usr2", "usr3", "usr4"
+};
+
+static const char * const default_user_formulas[kNumUserFormulas] = {
+  "t*(t>>5|t>>8)",
+  "t*pitch*p0&t>>4|t*p2&t>>7",
+  "t*((t>>12|t>>8)&p0&t>>4)",
+  "(t>>p0%8|t*pitch)^t>>p2%16",
+};
+
+void InitByteBeatUserFormulas() {
+  for (size_t i = 0; i < kNumUserFormulas; ++i)
+    bytebeat_user_formulas[i].Init(default_user_formulas[i]);
+}
+
+void ByteBeatUserFormula::Init(const char *formula) {
+  memset(tokens_, BYTEBEAT_TOKEN_NONE, sizeof(tokens_));
+  TokenizeByteBeat(formula, tokens_, kMaxTokens);
+  programs_[0].Init();
+  programs_[1].Init();
+  active_ = 0;
+  Update();
+}
+
+size_t ByteBeatUserFormula::length() const {
+  size_t length = 0;
+  while (length < kMaxTokens && tokens_[length] != BYTEBEAT_TOKEN_NONE)
+    ++length;
+  return length;
+}
+
+bool ByteBeatUserFormula::set_token(size_t pos, uint8_t token) {
+  if (pos >= kMaxTokens || token >= BYTEBEAT_TOKEN_LAST)
+    return false;
+  tokens_[pos] = token;
+  return Update();
+}
+
+bool ByteBeatUserFormula::Insert(size_t pos) {
+  if (pos >= kMaxTokens || length() >= kMaxTokens)
+    return false;
+  memmove(tokens_ + pos + 1, tokens_ + pos, kMaxTokens - pos - 1);
+  if (tokens_[pos] == BYTEBEAT_TOKEN_NONE)
+    tokens_[pos] = BYTEBEAT_TOKEN_T;
+  return Update();
+}
+
+bool ByteBeatUserFormula::Erase(size_t pos) {
+  if (pos >= kMaxTokens)
+    return false;
+  memmove(tokens_ + pos, tokens_ + pos + 1, kMaxTokens - pos - 1);
+  tokens_[kMaxTokens - 1] = BYTEBEAT_TOKEN_NONE;
+  return Update();
+}
+
+bool ByteBeatUserFormula::Update() {
+  ByteBeatProgram &inactive = programs_[active_ ^ 1];
+  valid_ = inactive.Compile(tokens_, length());
+  if (valid_) {
+    active_ ^= 1;
+    error_pos_ = -1;
+  } else {
+    error_pos_ = inactive.error_pos();
+  }
+  return valid_;
+}
+
+size_t ByteBeatUserFormula::Save(void *storage) const {
+  memcpy(storage, tokens_, kMaxTokens);
+  return kMaxTokens;
+}
+
+size_t ByteBeatUserFormula::Restore(const void *storage) {
+  memcpy(tokens_, storage, kMaxTokens);
+  // Anything after a gap or an unknown token is dropped
+  bool end = false;
+  for (auto &token : tokens_) {
+    if (token == BYTEBEAT_TOKEN_NONE || token >= BYTEBEAT_TOKEN_LAST)
+      end = true;
+    if (end)
+      token = BYTEBEAT_TOKEN_NONE;
+  }
+  Update();
+  return kMaxTokens;
+}
+
+#endif // BYTEBEAT_USER_FORMULAS
+
+} // namespace peaks
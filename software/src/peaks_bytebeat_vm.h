@@ -0,0 +1,271 @@
+// User-defined byte beat equations.
+//
+// Formulas are infix expressions over t, p0, p1, p2 and pitch using C
+// operators and precedence: unary - ~, then * / %, + -, << >>, &, ^, |.
+// All arithmetic is unsigned 32-bit like t in the built-in equations; x / 0
+// is 0 and x % 0 is x (which is what the Cortex-M divider gives) and shifts of
+// 32 or more yield 0.
+//
+// A formula is compiled once into a short register program: t, the parameters
+// and any constants live in fixed registers, each operator writes a temporary,
+// so evaluating a sample is just one pass over the instructions with no stack.
+
+#ifndef PEAKS_BYTEBEAT_VM_H_
+#define PEAKS_BYTEBEAT_VM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "util/util_macros.h"
+
+// The formula bank is stored with the Viznutcracker settings, and needs EEPROM
+// space that T3.2 doesn't have.
+#if defined(__IMXRT1062__) && defined(ENABLE_APP_BYTEBEATGEN)
+#define BYTEBEAT_USER_FORMULAS
+#endif
+
+namespace peaks {
+
+enum ByteBeatToken {
+  BYTEBEAT_TOKEN_NONE, // empty slot, terminates a token string
+  BYTEBEAT_TOKEN_T,
+  BYTEBEAT_TOKEN_P0,
+  BYTEBEAT_TOKEN_P1,
+  BYTEBEAT_TOKEN_P2,
+  BYTEBEAT_TOKEN_PITCH,
+  BYTEBEAT_TOKEN_0, // 0 to 9 are consecutive, adjacent digits form one number
+  BYTEBEAT_TOKEN_9 = BYTEBEAT_TOKEN_0 + 9,
+  BYTEBEAT_TOKEN_ADD,
+  BYTEBEAT_TOKEN_SUB,
+  BYTEBEAT_TOKEN_MUL,
+  BYTEBEAT_TOKEN_DIV,
+  BYTEBEAT_TOKEN_MOD,
+  BYTEBEAT_TOKEN_AND,
+  BYTEBEAT_TOKEN_OR,
+  BYTEBEAT_TOKEN_XOR,
+  BYTEBEAT_TOKEN_NOT,
+  BYTEBEAT_TOKEN_SHL,
+  BYTEBEAT_TOKEN_SHR,
+  BYTEBEAT_TOKEN_OPEN,
+  BYTEBEAT_TOKEN_CLOSE,
+  BYTEBEAT_TOKEN_LAST
+};
+
+extern const char * const bytebeat_token_names[BYTEBEAT_TOKEN_LAST];
+
+// Split a formula into tokens; returns number of tokens or -1 - position of
+// the offending character.
+int TokenizeByteBeat(const char *formula, uint8_t *tokens, size_t max_tokens);
+
+// END is 0 so zeroed code terminates
+enum ByteBeatOpcode {
+  BYTEBEAT_OP_END,
+  BYTEBEAT_OP_ADD,
+  BYTEBEAT_OP_SUB,
+  BYTEBEAT_OP_MUL,
+  BYTEBEAT_OP_DIV,
+  BYTEBEAT_OP_MOD,
+  BYTEBEAT_OP_AND,
+  BYTEBEAT_OP_OR,
+  BYTEBEAT_OP_XOR,
+  BYTEBEAT_OP_SHL,
+  BYTEBEAT_OP_SHR,
+  BYTEBEAT_OP_NEG,
+  BYTEBEAT_OP_NOT,
+  BYTEBEAT_OP_LAST,
+  // Set by the compiler when an operand is the previous instruction's result
+  BYTEBEAT_OP_ACC_A = BYTEBEAT_OP_LAST,
+  BYTEBEAT_OP_ACC_B = 2 * BYTEBEAT_OP_LAST,
+};
+
+struct ByteBeatInstruction {
+  uint8_t op;
+  uint8_t dst;
+  uint8_t a;
+  uint8_t b;
+};
+
+class ByteBeatProgram {
+public:
+  static constexpr size_t kMaxInstructions = 32; // including END
+  static constexpr size_t kNumRegisters = 32;
+  static constexpr size_t kMaxTokens = 64;
+
+  // Zero comes first so a program that was never compiled returns 0
+  enum Register {
+    REGISTER_ZERO,
+    REGISTER_T,
+    REGISTER_P0,
+    REGISTER_P1,
+    REGISTER_P2,
+    REGISTER_PITCH,
+    REGISTER_FIRST_FREE
+  };
+
+  ByteBeatProgram() { }
+
+  // Empty program, evaluates to 0
+  void Init();
+
+  // On failure the program is left empty and error_pos() is the index of
+  // the token (or character, for text) where compilation stopped.
+  bool Compile(const char *formula);
+  bool Compile(const uint8_t *tokens, size_t num_tokens);
+
+  int error_pos() const {
+    return error_pos_;
+  }
+
+  size_t num_instructions() const {
+    return num_instructions_;
+  }
+
+  inline uint32_t Eval(uint32_t t, uint32_t p0, uint32_t p1, uint32_t p2, uint32_t pitch) {
+    uint32_t *const r = regs_;
+    r[REGISTER_T] = t;
+    r[REGISTER_P0] = p0;
+    r[REGISTER_P1] = p1;
+    r[REGISTER_P2] = p2;
+    r[REGISTER_PITCH] = pitch;
+
+    // Threaded dispatch: each handler jumps straight to the next one, which
+    // the branch predictor copes with much better than a single switch. The
+    // last result is also kept in a local so the common case of chaining it
+    // into the next operation doesn't wait for the store to r[].
+#define BYTEBEAT_LABELS(variant) \
+      &&done, &&op_add##variant, &&op_sub##variant, &&op_mul##variant, \
+      &&op_div##variant, &&op_mod##variant, &&op_and##variant, \
+      &&op_or##variant, &&op_xor##variant, &&op_shl##variant, \
+      &&op_shr##variant, &&op_neg##variant, &&op_not##variant
+    static void * const dispatch[BYTEBEAT_OP_LAST * 3] = {
+      BYTEBEAT_LABELS(), BYTEBEAT_LABELS(_acc_a), BYTEBEAT_LABELS(_acc_b)
+    };
+#undef BYTEBEAT_LABELS
+
+    const ByteBeatInstruction *ip = code_;
+    uint32_t acc = 0;
+
+#define BYTEBEAT_HANDLER(label, load_a, load_b, expr) \
+    label: { \
+      const uint32_t a = load_a; const uint32_t b = load_b; (void)b; \
+      acc = (expr); r[ip->dst] = acc; ++ip; goto *dispatch[ip->op]; \
+    }
+#define BYTEBEAT_OP(name, expr) \
+    BYTEBEAT_HANDLER(op_##name, r[ip->a], r[ip->b], expr) \
+    BYTEBEAT_HANDLER(op_##name##_acc_a, acc, r[ip->b], expr) \
+    BYTEBEAT_HANDLER(op_##name##_acc_b, r[ip->a], acc, expr)
+
+    goto *dispatch[ip->op];
+    BYTEBEAT_OP(add, a + b)
+    BYTEBEAT_OP(sub, a - b)
+    BYTEBEAT_OP(mul, a * b)
+    BYTEBEAT_OP(div, b ? a / b : 0)
+    BYTEBEAT_OP(mod, b ? a % b : a)
+    BYTEBEAT_OP(and, a & b)
+    BYTEBEAT_OP(or, a | b)
+    BYTEBEAT_OP(xor, a ^ b)
+    BYTEBEAT_OP(shl, b < 32 ? a << b : 0)
+    BYTEBEAT_OP(shr, b < 32 ? a >> b : 0)
+    BYTEBEAT_OP(neg, -a)
+    BYTEBEAT_OP(not, ~a)
+
+#undef BYTEBEAT_OP
+#undef BYTEBEAT_HANDLER
+
+done:
+    return r[result_];
+  }
+
+  static inline uint32_t Apply(uint8_t op, uint32_t a, uint32_t b) __attribute__((always_inline)) {
+    switch (op) {
+      case BYTEBEAT_OP_ADD: return a + b;
+      case BYTEBEAT_OP_SUB: return a - b;
+      case BYTEBEAT_OP_MUL: return a * b;
+      case BYTEBEAT_OP_DIV: return b ? a / b : 0;
+      case BYTEBEAT_OP_MOD: return b ? a % b : a;
+      case BYTEBEAT_OP_AND: return a & b;
+      case BYTEBEAT_OP_OR: return a | b;
+      case BYTEBEAT_OP_XOR: return a ^ b;
+      case BYTEBEAT_OP_SHL: return b < 32 ? a << b : 0;
+      case BYTEBEAT_OP_SHR: return b < 32 ? a >> b : 0;
+      case BYTEBEAT_OP_NEG: return -a;
+      case BYTEBEAT_OP_NOT: return ~a;
+      default: return 0;
+    }
+  }
+
+private:
+  ByteBeatInstruction code_[kMaxInstructions];
+  uint32_t regs_[kNumRegisters];
+  uint8_t num_instructions_;
+  uint8_t result_;
+  int16_t error_pos_;
+
+  friend class ByteBeatCompiler;
+
+  DISALLOW_COPY_AND_ASSIGN(ByteBeatProgram);
+};
+
+#ifdef BYTEBEAT_USER_FORMULAS
+
+// Editable formula stored as tokens in app settings. The program is double
+// buffered: edits are compiled into the inactive copy in the UI and only
+// swapped in once they compile, so the ISR never sees a partial program and
+// keeps playing the last valid formula while one is being typed.
+class ByteBeatUserFormula {
+public:
+  static constexpr size_t kMaxTokens = 24;
+
+  void Init(const char *formula);
+
+  uint8_t token(size_t pos) const {
+    return tokens_[pos];
+  }
+
+  size_t length() const;
+
+  // Returns true if the formula compiled (and is now active)
+  bool set_token(size_t pos, uint8_t token);
+  bool Insert(size_t pos);
+  bool Erase(size_t pos);
+
+  bool valid() const {
+    return valid_;
+  }
+
+  // Token where the last edit failed to compile, or -1
+  int error_pos() const {
+    return error_pos_;
+  }
+
+  ByteBeatProgram &program() {
+    return programs_[active_];
+  }
+
+  size_t Save(void *storage) const;
+  size_t Restore(const void *storage);
+
+  static constexpr size_t storageSize() {
+    return kMaxTokens;
+  }
+
+private:
+  uint8_t tokens_[kMaxTokens];
+  ByteBeatProgram programs_[2];
+  volatile uint8_t active_;
+  bool valid_;
+  int error_pos_;
+
+  bool Update();
+};
+
+static constexpr size_t kNumUserFormulas = 4;
+extern ByteBeatUserFormula bytebeat_user_formulas[kNumUserFormulas];
+extern const char * const bytebeat_user_formula_names[kNumUserFormulas + 1]; // "off" + slots
+
+void InitByteBeatUserFormulas();
+
+#endif // BYTEBEAT_USER_FORMULAS
+
+} // namespace peaks
+
+#endif // PEAKS_BYTEBEAT_VM_H_
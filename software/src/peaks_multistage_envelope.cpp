@@ -253,4 +253,166 @@ uint16_t MultistageEnvelope::RenderFastPreview(int16_t *values) const {
 }
 
 
+void MultistageEnvelopeBank::Bind(size_t channel, MultistageEnvelope *envelope) {
+  envelope_[channel] = envelope;
+  segment_[channel] = envelope->segment_;
+  start_value_[channel] = envelope->start_value_;
+  value_[channel] = envelope->value_;
+  phase_[channel] = envelope->phase_;
+  phase_increment_[channel] = envelope->phase_increment_;
+  loop_counter_[channel] = envelope->loop_counter_;
+  sampled_amplitude_[channel] = envelope->sampled_amplitude_;
+  output_[channel] = envelope->scaled_value_;
+  Configure(channel);
+}
+
+void MultistageEnvelopeBank::Configure(size_t channel) {
+  const MultistageEnvelope &env = *envelope_[channel];
+  const size_t num_segments = env.num_segments_;
+
+  num_segments_[channel] = num_segments;
+  sustain_point_[channel] = env.sustain_point_;
+  loop_start_[channel] = env.loop_start_;
+  loop_end_[channel] = env.loop_end_;
+  max_loops_[channel] = env.max_loops_;
+  attack_reset_behaviour_[channel] = env.attack_reset_behaviour_;
+  decay_release_reset_behaviour_[channel] = env.decay_release_reset_behaviour_;
+  honour_falling_gate_[channel] =
+      env.attack_falling_gate_behaviour_ == FALLING_GATE_BEHAVIOUR_HONOUR;
+  amplitude_[channel] = env.amplitude_;
+  amplitude_sampled_[channel] = env.amplitude_sampled_;
+
+  // Only the segments up to the end of the envelope are ever looked at
+  for (size_t segment = 0; segment <= num_segments; ++segment) {
+    level_[channel][segment] = env.level_[segment];
+    increment_[channel][segment] =
+        lut_env_increments[env.time_[segment] >> 8] >> env.time_multiplier_[segment];
+    shape_table_[channel][segment] =
+        lookup_table_table[LUT_ENV_LINEAR + env.shape_[segment]];
+  }
+  level_[channel][num_segments + 1] = env.level_[num_segments + 1];
+
+  // Same as MultistageEnvelope::reset() after a change of envelope type
+  if (segment_[channel] > num_segments_[channel]) {
+    segment_[channel] = 0;
+    phase_[channel] = 0;
+    value_[channel] = 0;
+  }
+
+  changed_ |= 1 << channel;
+}
+
+void MultistageEnvelopeBank::Process(const uint8_t *control, uint16_t *out) {
+  for (size_t channel = 0; channel < kNumChannels; ++channel) {
+    const uint8_t gate = control[channel];
+    const uint16_t num_segments = num_segments_[channel];
+    const uint16_t sustain_point = sustain_point_[channel];
+    const bool falling = (gate & CONTROL_GATE_FALLING) && sustain_point &&
+        honour_falling_gate_[channel];
+    int16_t segment = segment_[channel];
+    uint32_t phase = phase_[channel];
+
+    // A finished or sustaining envelope outputs the same value until a gate
+    // edge or a settings change moves it.
+    if (!phase_increment_[channel] && !(gate & CONTROL_GATE_RISING) && !falling &&
+        !(changed_ & (1 << channel))) {
+      if (segment == num_segments ||
+          (sustain_point && segment == sustain_point && (gate & CONTROL_GATE))) {
+        envelope_[channel]->state_mask_ = 0;
+        out[channel] = output_[channel];
+        continue;
+      }
+    }
+
+    uint8_t state_mask = 0;
+    if (gate & CONTROL_GATE_RISING) {
+      if (segment == num_segments) {
+        start_value_[channel] = level_[channel][0];
+        segment = 0;
+        phase = 0;
+        loop_counter_[channel] = 0;
+      } else {
+        EnvResetBehaviour reset_behaviour = segment == 0
+            ? attack_reset_behaviour_[channel]
+            : decay_release_reset_behaviour_[channel];
+        envelope_[channel]->reset_behaviour_ = reset_behaviour;
+        switch (reset_behaviour) {
+          case RESET_BEHAVIOUR_SEGMENT_PHASE:
+            segment = 0;
+            phase = 0;
+            start_value_[channel] = value_[channel];
+            break;
+          case RESET_BEHAVIOUR_SEGMENT_LEVEL_PHASE:
+            segment = 0;
+            phase = 0;
+            start_value_[channel] = level_[channel][0];
+            break;
+          case RESET_BEHAVIOUR_SEGMENT_LEVEL:
+            start_value_[channel] = level_[channel][0];
+            segment = 0;
+            break;
+          case RESET_BEHAVIOUR_PHASE:
+            start_value_[channel] = value_[channel];
+            phase = 0;
+            break;
+          default:
+            break;
+        }
+      }
+      if (segment == 0 && amplitude_sampled_[channel])
+        sampled_amplitude_[channel] = amplitude_[channel];
+    } else if (falling) {
+      start_value_[channel] = value_[channel];
+      segment = sustain_point;
+      phase = 0;
+    } else if (phase < phase_increment_[channel]) {
+      start_value_[channel] = level_[channel][segment + 1];
+      ++segment;
+      phase = 0;
+      if (segment == loop_end_[channel] && (gate & CONTROL_GATE)) {
+        ++loop_counter_[channel];
+        if (!max_loops_[channel] || loop_counter_[channel] < max_loops_[channel])
+          segment = loop_start_[channel];
+      }
+      if (segment == num_segments)
+        state_mask |= ENV_EOC;
+    }
+
+    const bool done = segment == num_segments;
+    const bool sustained = sustain_point && segment == sustain_point &&
+        (gate & CONTROL_GATE);
+    const uint32_t phase_increment =
+        sustained || done ? 0 : increment_[channel][segment];
+
+    int32_t a = start_value_[channel];
+    int32_t b = level_[channel][segment + 1];
+    uint16_t t = Interpolate824(shape_table_[channel][segment], phase);
+    int16_t value = a + ((b - a) * (t >> 1) >> 15);
+    uint16_t amplitude = amplitude_sampled_[channel]
+        ? sampled_amplitude_[channel]
+        : amplitude_[channel];
+
+    segment_[channel] = segment;
+    value_[channel] = value;
+    phase_[channel] = phase + phase_increment;
+    phase_increment_[channel] = phase_increment;
+    output_[channel] = out[channel] = static_cast<uint16_t>((value * amplitude) >> 16);
+    changed_ &= ~(1 << channel);
+    Store(channel, state_mask);
+  }
+}
+
+void MultistageEnvelopeBank::Store(size_t channel, uint8_t state_mask) {
+  MultistageEnvelope &env = *envelope_[channel];
+  env.segment_ = segment_[channel];
+  env.start_value_ = start_value_[channel];
+  env.value_ = value_[channel];
+  env.phase_ = phase_[channel];
+  env.phase_increment_ = phase_increment_[channel];
+  env.loop_counter_ = loop_counter_[channel];
+  env.sampled_amplitude_ = sampled_amplitude_[channel];
+  env.scaled_value_ = output_[channel];
+  env.state_mask_ = state_mask;
+}
+
 }  // namespace peaks
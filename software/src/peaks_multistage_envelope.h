@@ -74,6 +74,8 @@ const uint16_t kMaxNumSegments = 8;
 const uint32_t kPreviewWidth = 128;
 const uint32_t kFastPreviewWidth = 64;
 
+class MultistageEnvelopeBank;
+
 class MultistageEnvelope {
  public:
   MultistageEnvelope() { }
@@ -407,9 +409,69 @@ class MultistageEnvelope {
 
   uint8_t state_mask_;
 
+  friend class MultistageEnvelopeBank;
+
   DISALLOW_COPY_AND_ASSIGN(MultistageEnvelope);
 };
 
+// Runs several MultistageEnvelopes at once, sample for sample the same as
+// calling ProcessSingleSample() on each. The envelopes are still set up with
+// their own setters; Configure() picks the settings up and does the segment
+// increment and shape lookups once, so it only needs calling when they change.
+// Process() then steps all channels in one loop over arrays, and skips the
+// ones that are finished or sustaining with nothing to move them. The state is
+// copied back to the envelopes so the previews and get_state_mask() work.
+class MultistageEnvelopeBank {
+ public:
+  static const size_t kNumChannels = 4;
+
+  MultistageEnvelopeBank() : changed_(0) { }
+  ~MultistageEnvelopeBank() { }
+
+  // Takes over the current state of envelope, which has to be Init()ed
+  void Bind(size_t channel, MultistageEnvelope *envelope);
+
+  // Call after changing the bound envelope's settings, before Process()
+  void Configure(size_t channel);
+
+  void Process(const uint8_t *control, uint16_t *out);
+
+ private:
+  MultistageEnvelope *envelope_[kNumChannels];
+
+  // Settings
+  int16_t level_[kNumChannels][kMaxNumSegments];
+  uint32_t increment_[kNumChannels][kMaxNumSegments];
+  const uint16_t *shape_table_[kNumChannels][kMaxNumSegments];
+  uint16_t num_segments_[kNumChannels];
+  uint16_t sustain_point_[kNumChannels];
+  uint16_t loop_start_[kNumChannels];
+  uint16_t loop_end_[kNumChannels];
+  uint8_t max_loops_[kNumChannels];
+  EnvResetBehaviour attack_reset_behaviour_[kNumChannels];
+  EnvResetBehaviour decay_release_reset_behaviour_[kNumChannels];
+  bool honour_falling_gate_[kNumChannels];
+  uint16_t amplitude_[kNumChannels];
+  bool amplitude_sampled_[kNumChannels];
+
+  // State
+  int16_t segment_[kNumChannels];
+  int16_t start_value_[kNumChannels];
+  int16_t value_[kNumChannels];
+  uint32_t phase_[kNumChannels];
+  uint32_t phase_increment_[kNumChannels];
+  uint8_t loop_counter_[kNumChannels];
+  uint16_t sampled_amplitude_[kNumChannels];
+  uint16_t output_[kNumChannels];
+
+  // Channels whose settings changed since they were last processed
+  uint8_t changed_;
+
+  void Store(size_t channel, uint8_t state_mask);
+
+  DISALLOW_COPY_AND_ASSIGN(MultistageEnvelopeBank);
+};
+
 }  // namespace peaks
 
 #endif  // PEAKS_MODULATIONS_MULTISTAGE_ENVELOPE_H_
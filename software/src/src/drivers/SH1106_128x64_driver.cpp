@@ -32,6 +32,7 @@
 #include <SPI.h>
 #endif
 #include "../../util/util_SPIFIFO.h"
+#include "spi_arbiter.h"
 
 // NOTE: Don't disable DMA unless you absolutely know what you're doing. It will hurt you.
 #if defined(__MK20DX256__)
@@ -311,6 +312,7 @@ void SH1106_128x64_Driver::SendPage(uint_fast8_t index, uint_fast8_t subpage, co
   SH1106_data_start_seq[0] = 0x10 | (startCol >> 4);
   SH1106_data_start_seq[1] = 0x00 | (startCol & 0x0F);
   SH1106_data_start_seq[2] = 0xb0 | index;
+  SPIArbiter::DisplayTransferBegin();
   sendpage_state = 1;
   sendpage_src = (const uint32_t *)startData; // frame buffer is 32 bit aligned
   sendpage_count = kSubpageSize >> 2; // number of 32 bit words to write into FIFO
@@ -322,6 +324,11 @@ void SH1106_128x64_Driver::SendPage(uint_fast8_t index, uint_fast8_t subpage, co
   #endif
     // don't clear SPI status flags, already cleared before DAC data was loaded into FIFO
     LPSPI4_IER = LPSPI_IER_TCIE; // run spi_sendpage_isr() when DAC data complete
+    // If this subpage was chained after another one, the bus is idle and the
+    // flags were cleared, so there won't be a TC interrupt. FIFO is checked
+    // first so a DAC transfer finishing in between still shows up as TCF.
+    if (!(LPSPI4_FSR & 0x1F) && !(LPSPI4_SR & (LPSPI_SR_MBF | LPSPI_SR_TCF)))
+      NVIC_TRIGGER_IRQ(IRQ_LPSPI4);
   #if defined(ARDUINO_TEENSY41)
   }
   #endif
@@ -387,6 +394,8 @@ static void spi_sendpage_isr() {
     digitalWriteFast(OLED_CS, OLED_CS_INACTIVE);
     lpspi->IER = 0;
     sendpage_state = 0;
+    // may start the next subpage
+    SPIArbiter::DisplayTransferEnd();
   }
 }
 #endif // __IMXRT1062__
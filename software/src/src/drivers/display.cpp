@@ -27,12 +27,25 @@ weegfx::Graphics graphics;
 
 namespace display {
 
-FrameBuffer<SH1106_128x64_Driver::kFrameSize, 2> frame_buffer;
+FrameBuffer<SH1106_128x64_Driver::kFrameSize, kNumFrameBuffers> frame_buffer;
 PagedDisplayDriver<SH1106_128x64_Driver> driver;
+FramePacer frame_pacer;
+FrameStats frame_stats;
 
 void Init() {
   frame_buffer.Init();
   driver.Init();
+  memset(&frame_stats, 0, sizeof(frame_stats));
+  frame_pacer.Init(FRAME_RATE_60, micros());
+}
+
+void SetFrameRate(FrameRate frame_rate) {
+  frame_pacer.set_frame_rate(frame_rate);
+}
+
+void Fill() {
+  if (driver.frame_valid())
+    driver.Update();
 }
 
 void AdjustOffset(uint8_t offset) {
@@ -24,6 +24,7 @@
 #define DRIVERS_DISPLAY_H_
 
 #include "framebuffer.h"
+#include "frame_pacer.h"
 #include "page_display_driver.h"
 #include "SH1106_128x64_driver.h"
 #include "weegfx.h"
@@ -31,10 +32,26 @@
 
 namespace display {
 
-extern FrameBuffer<SH1106_128x64_Driver::kFrameSize, 2> frame_buffer;
+// Triple-buffered so loop() can render the next frame while one is being sent
+// and another is queued, i.e. GRAPHICS_BEGIN_FRAME doesn't have to wait.
+// Teensy 3.2 can't spare the RAM, and doesn't render fast enough to need it.
+#if defined(__IMXRT1062__)
+static constexpr size_t kNumFrameBuffers = 3;
+#else
+static constexpr size_t kNumFrameBuffers = 2;
+#endif
+
+extern FrameBuffer<SH1106_128x64_Driver::kFrameSize, kNumFrameBuffers> frame_buffer;
 extern PagedDisplayDriver<SH1106_128x64_Driver> driver;
+extern FramePacer frame_pacer;
+extern FrameStats frame_stats;
 
 void Init();
+void SetFrameRate(FrameRate frame_rate);
+
+// Send next subpage of current frame if there is one; used by the SPI arbiter
+// to fill the remaining bus time in a tick.
+void Fill();
 void AdjustOffset(uint8_t offset);
 void SetFlipMode(bool flip180);
 void SetContrast(uint8_t contrast);
@@ -50,8 +67,11 @@ static inline void Update() {
   if (driver.frame_valid()) {
     driver.Update();
   } else {
-    if (frame_buffer.readable())
+    if (frame_buffer.readable()) {
+      frame_stats.dropped += frame_buffer.drop_stale();
+      ++frame_stats.displayed;
       driver.Begin(frame_buffer.readable_frame());
+    }
   }
 }
 
@@ -0,0 +1,75 @@
+#ifndef DRIVERS_FRAME_PACER_H_
+#define DRIVERS_FRAME_PACER_H_
+
+#include <stdint.h>
+#include "../../util/util_macros.h"
+
+namespace display {
+
+enum FrameRate {
+  FRAME_RATE_60,
+  FRAME_RATE_30,
+  FRAME_RATE_15,
+  FRAME_RATE_LAST
+};
+
+// Counters are free-running and only for the debug menu, so wrap is fine.
+struct FrameStats {
+  uint32_t rendered;           // frames drawn by loop
+  uint32_t late;               // frame slots the loop missed entirely
+  volatile uint32_t displayed; // frames sent to the display (ISR)
+  volatile uint32_t dropped;   // frames replaced by newer one before sent (ISR)
+};
+
+// Decouples the redraw rate in loop() from the display ISR: the loop renders
+// at most one frame per period, and deadlines are absolute so the rate
+// doesn't drift with the time spent drawing. If the loop falls more than a
+// full period behind it re-syncs instead of rendering a burst of frames.
+class FramePacer {
+public:
+
+  FramePacer() { }
+
+  void Init(FrameRate frame_rate, uint32_t now_us) {
+    set_frame_rate(frame_rate);
+    next_frame_us_ = now_us;
+  }
+
+  void set_frame_rate(FrameRate frame_rate) {
+    frame_rate_ = frame_rate < FRAME_RATE_LAST ? frame_rate : FRAME_RATE_60;
+    period_us_ = 1000000UL / fps();
+  }
+
+  FrameRate frame_rate() const {
+    return frame_rate_;
+  }
+
+  uint32_t fps() const {
+    return 60U >> frame_rate_;
+  }
+
+  bool due(uint32_t now_us) const {
+    return static_cast<int32_t>(now_us - next_frame_us_) >= 0;
+  }
+
+  void Rendered(uint32_t now_us, FrameStats &stats) {
+    ++stats.rendered;
+    next_frame_us_ += period_us_;
+    int32_t behind = static_cast<int32_t>(now_us - next_frame_us_);
+    if (behind >= 0) {
+      stats.late += behind / period_us_ + 1;
+      next_frame_us_ = now_us + period_us_;
+    }
+  }
+
+private:
+  FrameRate frame_rate_;
+  uint32_t period_us_;
+  uint32_t next_frame_us_;
+
+  DISALLOW_COPY_AND_ASSIGN(FramePacer);
+};
+
+}; // namespace display
+
+#endif // DRIVERS_FRAME_PACER_H_
@@ -13,6 +13,10 @@
 // but allows a new frame to be written while the old one is being
 // transferred.
 // See https://gist.github.com/patrickdowling/0029f58fb20e63d7db9d
+//
+// With frames >= 3 the writer never has to wait for the reader: one frame can
+// be in transfer while others are queued, and the reader can skip queued
+// frames that are already stale (drop_stale).
 
 template <size_t frame_size, size_t frames>
 class FrameBuffer {
@@ -53,6 +57,18 @@ public:
     ++read_ptr_;
   }
 
+  // Skip all but the most recently written readable frame
+  // @return number of skipped frames
+  size_t drop_stale() {
+    size_t stale = readable();
+    if (stale > 1) {
+      --stale;
+      read_ptr_ += stale;
+      return stale;
+    }
+    return 0;
+  }
+
   void written() {
     if (capture_on_next_write) {
       capture_on_next_write = false;
@@ -36,14 +36,16 @@ public:
     uint_fast8_t page = current_page_index_;
     uint_fast8_t subpage = current_subpage_index_;
     if (page < display_driver::kNumPages) {
+      // Advance before sending, the next subpage may be chained from the
+      // transfer-complete ISR
       const uint8_t *data = current_page_data_;
-      display_driver::SendPage(page, subpage, data);
       current_subpage_index_ = subpage + 1;
       if (current_subpage_index_ >= display_driver::kNumSubpages) {
         current_subpage_index_ = 0;
         current_page_index_ += 1;
         current_page_data_ = data + display_driver::kPageSize;
       }
+      display_driver::SendPage(page, subpage, data);
     }
   }
 
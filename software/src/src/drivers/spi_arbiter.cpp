@@ -0,0 +1,72 @@
+#include "spi_arbiter.h"
+
+/*static*/ uint32_t SPIArbiter::tick_cycles_;
+/*static*/ uint32_t SPIArbiter::guard_cycles_;
+/*static*/ SPIArbiter::FillFn SPIArbiter::fill_fn_;
+
+/*static*/ volatile uint32_t SPIArbiter::tick_start_;
+/*static*/ volatile uint32_t SPIArbiter::dac_start_;
+/*static*/ volatile uint32_t SPIArbiter::transfer_start_;
+/*static*/ volatile uint32_t SPIArbiter::busy_cycles_;
+/*static*/ volatile bool SPIArbiter::in_tick_;
+/*static*/ volatile bool SPIArbiter::fill_pending_;
+/*static*/ volatile uint32_t SPIArbiter::chained_subpages_;
+
+/*static*/ debug::AveragedCycles SPIArbiter::dac_delay_;
+/*static*/ debug::AveragedCycles SPIArbiter::dac_cycles_;
+/*static*/ debug::AveragedCycles SPIArbiter::subpage_cycles_;
+/*static*/ debug::AveragedCycles SPIArbiter::occupancy_;
+
+/*static*/
+void SPIArbiter::Init(uint32_t tick_cycles, FillFn fill_fn) {
+  tick_cycles_ = tick_cycles;
+  // Leave some headroom for ISR entry and jitter in the tick itself
+  guard_cycles_ = tick_cycles / 8;
+  fill_fn_ = fill_fn;
+
+  tick_start_ = ARM_DWT_CYCCNT;
+  busy_cycles_ = 0;
+  in_tick_ = false;
+  fill_pending_ = false;
+  ResetStats();
+}
+
+/*static*/
+void SPIArbiter::ResetStats() {
+  dac_delay_.Reset();
+  dac_cycles_.Reset();
+  subpage_cycles_.Reset();
+  occupancy_.Reset();
+  chained_subpages_ = 0;
+}
+
+/*static*/
+void SPIArbiter::DisplayTransferEnd() {
+  uint32_t cycles = ARM_DWT_CYCCNT - transfer_start_;
+  subpage_cycles_.push(cycles);
+  busy_cycles_ += cycles;
+
+  if (!fill_fn_)
+    return;
+
+  // Don't re-enter the display driver while the core ISR is using it; the
+  // fill is picked up at the end of the tick instead.
+  if (in_tick_) {
+    fill_pending_ = true;
+  } else if (display_slot_available()) {
+    ++chained_subpages_;
+    fill_fn_();
+  }
+}
+
+/*static*/
+void SPIArbiter::EndTick() {
+  in_tick_ = false;
+  if (fill_pending_) {
+    fill_pending_ = false;
+    if (display_slot_available()) {
+      ++chained_subpages_;
+      fill_fn_();
+    }
+  }
+}
@@ -0,0 +1,97 @@
+#ifndef DRIVERS_SPI_ARBITER_H_
+#define DRIVERS_SPI_ARBITER_H_
+
+#include <Arduino.h>
+#include "../../util/util_profiling.h"
+
+// The DAC and display share the SPI bus, and there are two priority classes:
+//
+// 1. DAC writes always go out at the start of each core tick, right after the
+//    previous display transfer has been finalized. As long as no display
+//    transfer is still in flight, this point is fixed relative to the tick.
+// 2. Display subpages use the rest of the tick. One subpage is started after
+//    the DAC write; where the driver can detect completion in an ISR (T4.x),
+//    further subpages are chained as long as another one fits into the tick
+//    without delaying the next DAC write.
+//
+// The arbiter measures the time from tick start to the DAC write (which
+// should be constant), the duration of display transfers, and the resulting
+// bus occupancy per tick.
+//
+// Usage in CORE_timer_ISR:
+//   SPIArbiter::BeginTick(); display::Flush(); SPIArbiter::BeginDAC();
+//   DAC::Update(); SPIArbiter::EndDAC(); display::Update(); ... EndTick();
+class SPIArbiter {
+public:
+  typedef void (*FillFn)();
+
+  static void Init(uint32_t tick_cycles, FillFn fill_fn);
+
+  static inline void BeginTick() __attribute__((always_inline)) {
+    uint32_t now = ARM_DWT_CYCCNT;
+    occupancy_.push(busy_cycles_);
+    busy_cycles_ = 0;
+    tick_start_ = now;
+    in_tick_ = true;
+  }
+
+  static inline void BeginDAC() __attribute__((always_inline)) {
+    dac_start_ = ARM_DWT_CYCCNT;
+    dac_delay_.push(dac_start_ - tick_start_);
+  }
+
+  static inline void EndDAC() __attribute__((always_inline)) {
+    uint32_t cycles = ARM_DWT_CYCCNT - dac_start_;
+    dac_cycles_.push(cycles);
+    busy_cycles_ += cycles;
+  }
+
+  // Run deferred fill if a display transfer completed during the tick
+  static void EndTick();
+
+  // Called by display driver when a subpage transfer starts/has completed
+  static inline void DisplayTransferBegin() __attribute__((always_inline)) {
+    transfer_start_ = ARM_DWT_CYCCNT;
+  }
+  static void DisplayTransferEnd();
+
+  // @return true if another subpage fits before the next DAC write
+  static inline bool display_slot_available() {
+    uint32_t elapsed = ARM_DWT_CYCCNT - tick_start_;
+    return elapsed + subpage_cycles_.max_value() + guard_cycles_ < tick_cycles_;
+  }
+
+  static uint32_t tick_cycles() { return tick_cycles_; }
+  static const debug::AveragedCycles &dac_delay() { return dac_delay_; }
+  static const debug::AveragedCycles &dac_cycles() { return dac_cycles_; }
+  static const debug::AveragedCycles &subpage_cycles() { return subpage_cycles_; }
+  static const debug::AveragedCycles &occupancy() { return occupancy_; }
+  static uint32_t chained_subpages() { return chained_subpages_; }
+
+  // @return averaged bus occupancy per tick in percent
+  static uint32_t occupancy_percent() {
+    return (occupancy_.value() * 100) / tick_cycles_;
+  }
+
+  static void ResetStats();
+
+private:
+  static uint32_t tick_cycles_;
+  static uint32_t guard_cycles_;
+  static FillFn fill_fn_;
+
+  static volatile uint32_t tick_start_;
+  static volatile uint32_t dac_start_;
+  static volatile uint32_t transfer_start_;
+  static volatile uint32_t busy_cycles_;
+  static volatile bool in_tick_;
+  static volatile bool fill_pending_;
+  static volatile uint32_t chained_subpages_;
+
+  static debug::AveragedCycles dac_delay_;
+  static debug::AveragedCycles dac_cycles_;
+  static debug::AveragedCycles subpage_cycles_;
+  static debug::AveragedCycles occupancy_;
+};
+
+#endif // DRIVERS_SPI_ARBITER_H_
@@ -326,6 +326,37 @@ void Graphics::writeBitmap8(coord_t x, coord_t y, coord_t w, const uint8_t *data
   blit<PIXEL_OP_SRC>(get_frame_ptr(x, y), y, w, h, data);
 }
 
+void Graphics::readColumns(coord_t x, coord_t w, uint8_t *dst) const
+{
+  const uint8_t *src = frame_ + x;
+  for (coord_t page = 0; page < kHeight / 8; ++page) {
+    memcpy(dst, src, w);
+    dst += w;
+    src += kWidth;
+  }
+}
+
+void Graphics::writeColumns(coord_t x, coord_t w, const uint8_t *src)
+{
+  uint8_t *dst = frame_ + x;
+  for (coord_t page = 0; page < kHeight / 8; ++page) {
+    memcpy(dst, src, w);
+    dst += kWidth;
+    src += w;
+  }
+}
+
+void Graphics::orColumns(coord_t x, coord_t w, const uint8_t *src)
+{
+  uint8_t *dst = frame_ + x;
+  for (coord_t page = 0; page < kHeight / 8; ++page) {
+    for (coord_t i = 0; i < w; ++i)
+      dst[i] |= src[i];
+    dst += kWidth;
+    src += w;
+  }
+}
+
 // p = period. Draw a dotted line with a pixel every p
 void Graphics::drawLine(coord_t x0, coord_t y0, coord_t x1, coord_t y1, const uint8_t p) {
   uint8_t c = 0;
@@ -620,6 +651,64 @@ void Graphics::printf(const char *fmt, ...)
   print(print_buf);
 }
 
+coord_t Graphics::blit_glyph(const GlyphFont &font, char c, coord_t x, coord_t y)
+{
+  if (c < font.first || c > font.last) return 0;
+  const int index = c - font.first;
+  const coord_t advance = font.advances[index];
+  coord_t w = font.widths[index];
+  if (!w) return advance;
+
+  // Variant for the sub-page offset is just a different slice of the atlas
+  const uint8_t *src = font.data + font.offsets[index] + (y & 0x7) * w * font.pages;
+  const coord_t src_stride = w;
+  if (x + w > kWidth) w = kWidth - x;
+  if (x < 0) {
+    src -= x;
+    w += x;
+    x = 0;
+  }
+  if (w <= 0) return advance;
+
+  coord_t page = y >> 3;
+  for (uint_fast8_t p = 0; p < font.pages; ++p, ++page, src += src_stride) {
+    if (page < 0) continue;
+    if (page >= kHeight / 8) break;
+    draw_pixel_row<PIXEL_OP_OR>(frame_ + page * kWidth + x, w, src);
+  }
+  return advance;
+}
+
+coord_t Graphics::drawGlyphs(const GlyphFont &font, coord_t x, coord_t y, const char *s)
+{
+  while (*s) x += blit_glyph(font, *s++, x, y);
+  return x;
+}
+
+coord_t Graphics::drawGlyphs(const GlyphFont &font, coord_t x, coord_t y, int value)
+{
+  return drawGlyphs(font, x, y, itos<int, false>(value, print_buf, sizeof(print_buf)));
+}
+
+void Graphics::drawGlyphsRight(const GlyphFont &font, coord_t x, coord_t y, const char *s)
+{
+  drawGlyphs(font, x - glyphsWidth(font, s), y, s);
+}
+
+void Graphics::drawGlyphsRight(const GlyphFont &font, coord_t x, coord_t y, int value)
+{
+  drawGlyphsRight(font, x, y, itos<int, false>(value, print_buf, sizeof(print_buf)));
+}
+
+coord_t Graphics::glyphsWidth(const GlyphFont &font, const char *s)
+{
+  coord_t w = 0;
+  for (; *s; ++s) {
+    if (*s >= font.first && *s <= font.last) w += font.advances[*s - font.first];
+  }
+  return w;
+}
+
 void Graphics::drawStr(coord_t x, coord_t y, const char *s)
 {
   while (*s) {
@@ -44,6 +44,20 @@ enum PIXEL_OP {
 
 enum CLEAR_FRAME { CLEAR_FRAME_DISABLE, CLEAR_FRAME_ENABLE };
 
+// Proportional bitmap font stored as a glyph atlas. Each glyph is already
+// split into display pages, and stored once for each of the 8 vertical
+// offsets within a page, so drawing is just OR-ing bytes without shifts.
+// Layout of data: [glyph][shift 0..7][page 0..pages-1][column 0..width-1]
+struct GlyphFont {
+  uint8_t height;
+  uint8_t pages;             // pages spanned by each pre-shifted glyph
+  char first, last;          // character range
+  const uint8_t *widths;     // per char, 0 = not in font
+  const uint8_t *advances;   // per char
+  const uint16_t *offsets;   // per char, into data
+  const uint8_t *data;
+};
+
 // Quick & dirty graphics for 128x64 framebuffer with vertical pixels.
 // - Writes to provided framebuffer
 // - Makes some assumptions based on fixed size and pixel orientation
@@ -73,6 +87,13 @@ public:
   void drawBitmap8(coord_t x, coord_t y, coord_t w, const uint8_t *data);
   void writeBitmap8(coord_t x, coord_t y, coord_t w, const uint8_t *data);
 
+  // Copy full-height column span [x, x + w) to/from a buffer of w * kHeight / 8 bytes
+  // (page-major, same layout as the frame). No clipping.
+  void readColumns(coord_t x, coord_t w, uint8_t *dst) const;
+  void writeColumns(coord_t x, coord_t w, const uint8_t *src);
+  // As writeColumns, but OR-ed into what's already drawn
+  void orColumns(coord_t x, coord_t w, const uint8_t *src);
+
   // Beware: No clipping
   void drawCircle(coord_t center_x, coord_t center_y, coord_t r);
 
@@ -111,6 +132,15 @@ public:
   // Might be time-consuming
   void printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
 
+  // Glyph atlas fonts; these don't use or move the print pos.
+  // @return x position after last character
+  coord_t drawGlyphs(const GlyphFont &font, coord_t x, coord_t y, const char *str);
+  coord_t drawGlyphs(const GlyphFont &font, coord_t x, coord_t y, int value);
+  // Draw right-aligned, ending at x
+  void drawGlyphsRight(const GlyphFont &font, coord_t x, coord_t y, const char *str);
+  void drawGlyphsRight(const GlyphFont &font, coord_t x, coord_t y, int value);
+  static coord_t glyphsWidth(const GlyphFont &font, const char *str);
+
   inline void drawAlignedByte(coord_t x, coord_t y, uint8_t byte) __attribute__((always_inline));
 
 private:
@@ -124,6 +154,7 @@ private:
   // clang-format off
   template <PIXEL_OP pixel_op> void blit_char(char c, coord_t x, coord_t y);
   template <PIXEL_OP pixel_op> void print_impl(const char *s);
+  coord_t blit_glyph(const GlyphFont &font, char c, coord_t x, coord_t y);
   // clang-format on
 };
 
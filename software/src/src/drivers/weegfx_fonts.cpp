@@ -0,0 +1,321 @@
+// Automatically generated by res/weegfx_fonts.py, do not edit
+
+#include <stdint.h>
+#include "weegfx_fonts.h"
+
+namespace weegfx {
+
+static const uint8_t numerals_10_widths[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x02, 0x00,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x02,
+};
+static const uint8_t numerals_10_advances[] = {
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x05, 0x03, 0x00,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03,
+};
+static const uint16_t numerals_10_offsets[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 144, 240, 288,
+  288, 432, 576, 720, 864, 1008, 1152, 1296, 1440, 1584, 1728,
+};
+static const uint8_t numerals_10_data[] = {
+  0x30, 0x30, 0xfc, 0xfc, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x60, 0x60, 0xf8, 0xf8, 0x60, 0x60, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xe0, 0xe0, 0x80, 0x80, 0x01, 0x01, 0x07, 0x07,
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x03, 0x03,
+  0x0f, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00,
+  0x06, 0x06, 0x1f, 0x1f, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x0c, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x01, 0x01,
+  0xfe, 0xff, 0x01, 0x01, 0xff, 0xfe, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xfc, 0xfe, 0x02, 0x02, 0xfe, 0xfc, 0x03, 0x07, 0x04, 0x04, 0x07, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf8, 0xfc, 0x04, 0x04, 0xfc, 0xf8, 0x07, 0x0f, 0x08, 0x08, 0x0f, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0x08, 0x08, 0xf8, 0xf0, 0x0f, 0x1f, 0x10, 0x10,
+  0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0x10, 0x10, 0xf0, 0xe0, 0x1f, 0x3f,
+  0x20, 0x20, 0x3f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0x20, 0x20, 0xe0, 0xc0,
+  0x3f, 0x7f, 0x40, 0x40, 0x7f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x40, 0x40,
+  0xc0, 0x80, 0x7f, 0xff, 0x80, 0x80, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x80, 0x80, 0x80, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x04, 0x06, 0xff, 0xff, 0x00, 0x00, 0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x0c, 0xfe, 0xfe, 0x00, 0x00, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0xfc, 0xfc, 0x00, 0x00, 0x08, 0x08, 0x0f, 0x0f, 0x08, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0xf8, 0xf8, 0x00, 0x00, 0x10, 0x10, 0x1f, 0x1f,
+  0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0xf0, 0xf0, 0x00, 0x00, 0x20, 0x20,
+  0x3f, 0x3f, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xe0, 0x00, 0x00,
+  0x40, 0x40, 0x7f, 0x7f, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0,
+  0x00, 0x00, 0x81, 0x81, 0xff, 0xff, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x80, 0x00, 0x00, 0x02, 0x03, 0xff, 0xff, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x82, 0xc3, 0x61, 0x31, 0x1f, 0x0e, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x86, 0xc2, 0x62, 0x3e, 0x1c, 0x07, 0x07, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x84, 0xc4, 0x7c, 0x38, 0x0e, 0x0f, 0x09, 0x08, 0x08, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x08, 0x88, 0xf8, 0x70, 0x1c, 0x1e, 0x13, 0x11,
+  0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x10, 0x10, 0xf0, 0xe0, 0x38, 0x3c,
+  0x26, 0x23, 0x21, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x20, 0x20, 0xe0, 0xc0,
+  0x70, 0x78, 0x4c, 0x46, 0x43, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x40, 0x40,
+  0xc0, 0x80, 0xe0, 0xf0, 0x98, 0x8c, 0x87, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x80, 0x80, 0x80, 0x00, 0xc1, 0xe1, 0x30, 0x18, 0x0f, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x02, 0x03, 0x11, 0x11, 0xff, 0xee, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x06, 0x22, 0x22, 0xfe, 0xdc, 0x02, 0x06, 0x04, 0x04, 0x07, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x44, 0x44, 0xfc, 0xb8, 0x04, 0x0c, 0x08, 0x08, 0x0f, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x88, 0x88, 0xf8, 0x70, 0x08, 0x18, 0x10, 0x10,
+  0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x10, 0x10, 0xf0, 0xe0, 0x10, 0x30,
+  0x21, 0x21, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x20, 0x20, 0xe0, 0xc0,
+  0x20, 0x60, 0x42, 0x42, 0x7f, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x40, 0x40,
+  0xc0, 0x80, 0x40, 0xc0, 0x84, 0x84, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x80, 0x80, 0x80, 0x00, 0x81, 0x81, 0x08, 0x08, 0xff, 0xf7, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x38, 0x3c, 0x26, 0x23, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x70, 0x78, 0x4c, 0x46, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0x98, 0x8c, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0x30, 0x18, 0xf8, 0xf8, 0x01, 0x01, 0x01, 0x01,
+  0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x30, 0xf0, 0xf0, 0x03, 0x03,
+  0x02, 0x02, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x60, 0xe0, 0xe0,
+  0x07, 0x07, 0x04, 0x04, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0,
+  0xc0, 0xc0, 0x0e, 0x0f, 0x09, 0x08, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x80, 0x80, 0x1c, 0x1e, 0x13, 0x11, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x0f, 0x0f, 0x09, 0x09, 0xf9, 0xf1, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1e, 0x1e, 0x12, 0x12, 0xf2, 0xe2, 0x02, 0x06, 0x04, 0x04, 0x07, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x24, 0x24, 0xe4, 0xc4, 0x04, 0x0c, 0x08, 0x08, 0x0f, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x48, 0x48, 0xc8, 0x88, 0x08, 0x18, 0x10, 0x10,
+  0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x90, 0x90, 0x90, 0x10, 0x10, 0x30,
+  0x20, 0x20, 0x3f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x20, 0x20, 0x20, 0x20,
+  0x21, 0x61, 0x41, 0x41, 0x7f, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x40, 0x40,
+  0x40, 0x40, 0x43, 0xc3, 0x82, 0x82, 0xfe, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x87, 0x87, 0x04, 0x04, 0xfc, 0xf8, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0xfc, 0xfe, 0x13, 0x11, 0xf1, 0xe0, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf8, 0xfc, 0x26, 0x22, 0xe2, 0xc0, 0x03, 0x07, 0x04, 0x04, 0x07, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0x4c, 0x44, 0xc4, 0x80, 0x07, 0x0f, 0x08, 0x08, 0x0f, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0x98, 0x88, 0x88, 0x00, 0x0f, 0x1f, 0x10, 0x10,
+  0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0x30, 0x10, 0x10, 0x00, 0x1f, 0x3f,
+  0x21, 0x21, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x20, 0x20, 0x00,
+  0x3f, 0x7f, 0x42, 0x42, 0x7e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x40,
+  0x40, 0x00, 0x7f, 0xff, 0x84, 0x84, 0xfc, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x80, 0x80, 0x00, 0xfe, 0xff, 0x09, 0x08, 0xf8, 0xf0, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x81, 0xe1, 0x79, 0x1f, 0x07, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x02, 0xc2, 0xf2, 0x3e, 0x0e, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x84, 0xe4, 0x7c, 0x1c, 0x00, 0x0e, 0x0f, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0xc8, 0xf8, 0x38, 0x00, 0x1c, 0x1f, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x90, 0xf0, 0x70, 0x00, 0x38,
+  0x3e, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0xe0, 0xe0,
+  0x00, 0x70, 0x7c, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40,
+  0xc0, 0xc0, 0x00, 0xe0, 0xf8, 0x1e, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0xee, 0xff, 0x11, 0x11, 0xff, 0xee, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xdc, 0xfe, 0x22, 0x22, 0xfe, 0xdc, 0x03, 0x07, 0x04, 0x04, 0x07, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb8, 0xfc, 0x44, 0x44, 0xfc, 0xb8, 0x07, 0x0f, 0x08, 0x08, 0x0f, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xf8, 0x88, 0x88, 0xf8, 0x70, 0x0f, 0x1f, 0x10, 0x10,
+  0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0x10, 0x10, 0xf0, 0xe0, 0x1e, 0x3f,
+  0x21, 0x21, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0x20, 0x20, 0xe0, 0xc0,
+  0x3d, 0x7f, 0x42, 0x42, 0x7f, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x40, 0x40,
+  0xc0, 0x80, 0x7b, 0xff, 0x84, 0x84, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x80, 0x80, 0x80, 0x00, 0xf7, 0xff, 0x08, 0x08, 0xff, 0xf7, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x1e, 0x3f, 0x21, 0x21, 0xff, 0xfe, 0x00, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3c, 0x7e, 0x42, 0x42, 0xfe, 0xfc, 0x00, 0x04, 0x04, 0x06, 0x03, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x78, 0xfc, 0x84, 0x84, 0xfc, 0xf8, 0x00, 0x08, 0x08, 0x0c, 0x07, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0x08, 0x08, 0xf8, 0xf0, 0x00, 0x11, 0x11, 0x19,
+  0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0x10, 0x10, 0xf0, 0xe0, 0x01, 0x23,
+  0x22, 0x32, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0x20, 0x20, 0xe0, 0xc0,
+  0x03, 0x47, 0x44, 0x64, 0x3f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x40, 0x40,
+  0xc0, 0x80, 0x07, 0x8f, 0x88, 0xc8, 0x7f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x80, 0x80, 0x80, 0x00, 0x0f, 0x1f, 0x10, 0x90, 0xff, 0x7f, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x98, 0x98, 0x01, 0x01, 0x00, 0x00, 0x30, 0x30, 0x03, 0x03,
+  0x00, 0x00, 0x60, 0x60, 0x06, 0x06, 0x00, 0x00, 0xc0, 0xc0, 0x0c, 0x0c, 0x00, 0x00, 0x80, 0x80,
+  0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00,
+};
+
+const GlyphFont numerals_10 = {
+  10, 3, ' ', ':',
+  numerals_10_widths, numerals_10_advances, numerals_10_offsets, numerals_10_data
+};
+
+static const uint8_t numerals_14_widths[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x06, 0x02, 0x00,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x02,
+};
+static const uint8_t numerals_14_advances[] = {
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x08, 0x04, 0x00,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x04,
+};
+static const uint16_t numerals_14_offsets[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 192, 192, 336, 384,
+  384, 600, 816, 1032, 1248, 1464, 1680, 1896, 2112, 2328, 2544,
+};
+static const uint8_t numerals_14_data[] = {
+  0xc0, 0xc0, 0xc0, 0xf8, 0xf8, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xf0, 0xf0, 0x80, 0x80, 0x80,
+  0x01, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1f, 0x1f, 0x03, 0x03, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+  0x06, 0x06, 0x06, 0x3f, 0x3f, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x7f, 0x7f, 0x0c, 0x0c, 0x0c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0xfe, 0xfe, 0x30, 0x30, 0x30,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x60, 0x60, 0x60, 0xfc, 0xfc, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c,
+  0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+  0xfc, 0xfe, 0x03, 0x01, 0x01, 0x01, 0x03, 0xfe, 0xfc, 0x0f, 0x1f, 0x30, 0x20, 0x20, 0x20, 0x30,
+  0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xfc, 0x06, 0x02, 0x02,
+  0x02, 0x06, 0xfc, 0xf8, 0x1f, 0x3f, 0x60, 0x40, 0x40, 0x40, 0x60, 0x3f, 0x1f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0x0c, 0x04, 0x04, 0x04, 0x0c, 0xf8, 0xf0, 0x3f,
+  0x7f, 0xc0, 0x80, 0x80, 0x80, 0xc0, 0x7f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0xf0, 0x18, 0x08, 0x08, 0x08, 0x18, 0xf0, 0xe0, 0x7f, 0xff, 0x80, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0x7f, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0xc0, 0xe0, 0x30, 0x10,
+  0x10, 0x10, 0x30, 0xe0, 0xc0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01,
+  0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 0x80, 0xc0, 0x60, 0x20, 0x20, 0x20, 0x60, 0xc0, 0x80,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x03, 0x06, 0x04, 0x04, 0x04, 0x06,
+  0x03, 0x01, 0x00, 0x80, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0x80, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0x03, 0x07, 0x0c, 0x08, 0x08, 0x08, 0x0c, 0x07, 0x03, 0x00, 0x00, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfe, 0x07,
+  0x0f, 0x18, 0x10, 0x10, 0x10, 0x18, 0x0f, 0x07, 0x08, 0x0c, 0x06, 0xff, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x20, 0x3f, 0x3f, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x18, 0x0c, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x7f,
+  0x7f, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x30,
+  0x18, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x30, 0xf8, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x00, 0x80, 0xc0, 0x60, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x02, 0x00, 0x00,
+  0x80, 0xc0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x0f,
+  0x0f, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06,
+  0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1f, 0x1f, 0x10, 0x10, 0x10, 0x00,
+  0x04, 0x06, 0x03, 0x01, 0x81, 0xc1, 0x63, 0x3e, 0x1c, 0x38, 0x3c, 0x26, 0x23, 0x21, 0x20, 0x20,
+  0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x06, 0x02, 0x02,
+  0x82, 0xc6, 0x7c, 0x38, 0x70, 0x78, 0x4c, 0x46, 0x43, 0x41, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x0c, 0x04, 0x04, 0x04, 0x8c, 0xf8, 0x70, 0xe0,
+  0xf0, 0x98, 0x8c, 0x86, 0x83, 0x81, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0x30, 0x18, 0x08, 0x08, 0x08, 0x18, 0xf0, 0xe0, 0xc0, 0xe0, 0x30, 0x18, 0x0c, 0x06,
+  0x03, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x40, 0x60, 0x30, 0x10,
+  0x10, 0x10, 0x30, 0xe0, 0xc0, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x03, 0x03,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x80, 0xc0, 0x60, 0x20, 0x20, 0x20, 0x60, 0xc0, 0x80,
+  0x00, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x07, 0x03, 0x07, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x00, 0x80, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0x80, 0x00, 0x01, 0x01, 0x80, 0xc0, 0x60,
+  0x30, 0x18, 0x0f, 0x07, 0x0e, 0x0f, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x31, 0x1f, 0x0e, 0x1c,
+  0x1e, 0x13, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x06, 0x03, 0x41, 0x41, 0x41, 0xe3, 0xbe,
+  0x1c, 0x08, 0x18, 0x30, 0x20, 0x20, 0x20, 0x30, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x0c, 0x06, 0x82, 0x82, 0x82, 0xc6, 0x7c, 0x38, 0x10, 0x30, 0x60, 0x40,
+  0x40, 0x40, 0x61, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18,
+  0x0c, 0x04, 0x04, 0x04, 0x8c, 0xf8, 0x70, 0x20, 0x60, 0xc0, 0x81, 0x81, 0x81, 0xc3, 0x7e, 0x3c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x18, 0x08, 0x08, 0x08, 0x18,
+  0xf0, 0xe0, 0x40, 0xc0, 0x80, 0x02, 0x02, 0x02, 0x87, 0xfd, 0x78, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x00, 0x00, 0x40, 0x60, 0x30, 0x10, 0x10, 0x10, 0x30, 0xe0, 0xc0, 0x80, 0x80, 0x00,
+  0x04, 0x04, 0x04, 0x0e, 0xfb, 0xf1, 0x00, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 0x80,
+  0xc0, 0x60, 0x20, 0x20, 0x20, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x1c, 0xf7,
+  0xe3, 0x01, 0x03, 0x06, 0x04, 0x04, 0x04, 0x06, 0x03, 0x01, 0x00, 0x80, 0xc0, 0x40, 0x40, 0x40,
+  0xc0, 0x80, 0x00, 0x01, 0x01, 0x00, 0x10, 0x10, 0x10, 0x38, 0xef, 0xc7, 0x02, 0x06, 0x0c, 0x08,
+  0x08, 0x08, 0x0c, 0x07, 0x03, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x03,
+  0x01, 0x20, 0x20, 0x20, 0x71, 0xdf, 0x8e, 0x04, 0x0c, 0x18, 0x10, 0x10, 0x10, 0x18, 0x0f, 0x07,
+  0xc0, 0xe0, 0x30, 0x18, 0x0c, 0x06, 0xff, 0xff, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3f,
+  0x3f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x30, 0x18,
+  0x0c, 0xfe, 0xfe, 0x00, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x7f, 0x7f, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x30, 0x18, 0xfc, 0xfc, 0x00, 0x0f,
+  0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x30, 0xf8, 0xf8, 0x00, 0x1e, 0x1f, 0x19, 0x18, 0x18, 0x18,
+  0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xc0, 0x60, 0xf0, 0xf0, 0x00, 0x3c, 0x3e, 0x33, 0x31, 0x30, 0x30, 0xff, 0xff, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xe0, 0x00,
+  0x78, 0x7c, 0x66, 0x63, 0x61, 0x60, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0x00, 0xf0, 0xf8, 0xcc, 0xc6, 0xc3,
+  0xc1, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0xe0, 0xf0, 0x98, 0x8c, 0x86, 0x83, 0xff, 0xff, 0x80, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x1f, 0x01, 0x3f, 0x3f, 0x21, 0x11, 0x11, 0x11, 0x31, 0xe1,
+  0xc1, 0x08, 0x18, 0x30, 0x20, 0x20, 0x20, 0x30, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7e, 0x7e, 0x42, 0x22, 0x22, 0x22, 0x62, 0xc2, 0x82, 0x10, 0x30, 0x60, 0x40,
+  0x40, 0x40, 0x60, 0x3f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc,
+  0x84, 0x44, 0x44, 0x44, 0xc4, 0x84, 0x04, 0x20, 0x60, 0xc0, 0x80, 0x80, 0x80, 0xc0, 0x7f, 0x3f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0x08, 0x88, 0x88, 0x88, 0x88,
+  0x08, 0x08, 0x41, 0xc1, 0x81, 0x00, 0x00, 0x00, 0x81, 0xff, 0x7e, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x00, 0x00, 0xf0, 0xf0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x83, 0x83, 0x02,
+  0x01, 0x01, 0x01, 0x03, 0xfe, 0xfc, 0x00, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 0xe0,
+  0xe0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x07, 0x07, 0x04, 0x02, 0x02, 0x02, 0x06, 0xfc,
+  0xf8, 0x01, 0x03, 0x06, 0x04, 0x04, 0x04, 0x06, 0x03, 0x01, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x0f, 0x0f, 0x08, 0x04, 0x04, 0x04, 0x0c, 0xf8, 0xf0, 0x02, 0x06, 0x0c, 0x08,
+  0x08, 0x08, 0x0c, 0x07, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1f, 0x1f,
+  0x10, 0x08, 0x08, 0x08, 0x18, 0xf0, 0xe0, 0x04, 0x0c, 0x18, 0x10, 0x10, 0x10, 0x18, 0x0f, 0x07,
+  0xf8, 0xfc, 0x46, 0x23, 0x21, 0x21, 0x61, 0xc0, 0x80, 0x0f, 0x1f, 0x30, 0x20, 0x20, 0x20, 0x30,
+  0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0x8c, 0x46, 0x42,
+  0x42, 0xc2, 0x80, 0x00, 0x1f, 0x3f, 0x60, 0x40, 0x40, 0x40, 0x60, 0x3f, 0x1f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0x18, 0x8c, 0x84, 0x84, 0x84, 0x00, 0x00, 0x3f,
+  0x7f, 0xc1, 0x80, 0x80, 0x80, 0xc1, 0x7f, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc0, 0xe0, 0x30, 0x18, 0x08, 0x08, 0x08, 0x00, 0x00, 0x7f, 0xff, 0x82, 0x01, 0x01, 0x01,
+  0x83, 0xfe, 0x7c, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x30,
+  0x10, 0x10, 0x10, 0x00, 0x00, 0xff, 0xff, 0x04, 0x02, 0x02, 0x02, 0x06, 0xfc, 0xf8, 0x00, 0x01,
+  0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x20, 0x20, 0x20, 0x00, 0x00,
+  0xff, 0xff, 0x08, 0x04, 0x04, 0x04, 0x0c, 0xf8, 0xf0, 0x01, 0x03, 0x06, 0x04, 0x04, 0x04, 0x06,
+  0x03, 0x01, 0x00, 0x00, 0x80, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0xfe, 0xff, 0x11, 0x08, 0x08,
+  0x08, 0x18, 0xf0, 0xe0, 0x03, 0x07, 0x0c, 0x08, 0x08, 0x08, 0x0c, 0x07, 0x03, 0x00, 0x00, 0x00,
+  0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xfc, 0xfe, 0x23, 0x11, 0x10, 0x10, 0x30, 0xe0, 0xc0, 0x07,
+  0x0f, 0x18, 0x10, 0x10, 0x10, 0x18, 0x0f, 0x07, 0x01, 0x01, 0x01, 0x01, 0x81, 0xe1, 0x79, 0x1f,
+  0x07, 0x00, 0x00, 0x38, 0x3e, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0xc2, 0xf2, 0x3e, 0x0e, 0x00, 0x00, 0x70, 0x7c,
+  0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x84, 0xe4, 0x7c, 0x1c, 0x00, 0x00, 0xe0, 0xf8, 0x1e, 0x07, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xc8,
+  0xf8, 0x38, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0xf0, 0x70, 0x00, 0x00, 0x80,
+  0xe0, 0x78, 0x1e, 0x07, 0x01, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x80, 0xe0, 0x78, 0x1e, 0x07, 0x01, 0x00, 0x00, 0x0e, 0x0f,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0x00, 0x00, 0x1c, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0xbe, 0xe3, 0x41, 0x41, 0x41, 0xe3, 0xbe, 0x1c, 0x0f, 0x1f, 0x30, 0x20, 0x20, 0x20, 0x30,
+  0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x7c, 0xc6, 0x82, 0x82,
+  0x82, 0xc6, 0x7c, 0x38, 0x1e, 0x3f, 0x61, 0x40, 0x40, 0x40, 0x61, 0x3f, 0x1e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xf8, 0x8c, 0x04, 0x04, 0x04, 0x8c, 0xf8, 0x70, 0x3c,
+  0x7e, 0xc3, 0x81, 0x81, 0x81, 0xc3, 0x7e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0xf0, 0x18, 0x08, 0x08, 0x08, 0x18, 0xf0, 0xe0, 0x78, 0xfd, 0x87, 0x02, 0x02, 0x02,
+  0x87, 0xfd, 0x78, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0xc0, 0xe0, 0x30, 0x10,
+  0x10, 0x10, 0x30, 0xe0, 0xc0, 0xf1, 0xfb, 0x0e, 0x04, 0x04, 0x04, 0x0e, 0xfb, 0xf1, 0x00, 0x01,
+  0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 0x80, 0xc0, 0x60, 0x20, 0x20, 0x20, 0x60, 0xc0, 0x80,
+  0xe3, 0xf7, 0x1c, 0x08, 0x08, 0x08, 0x1c, 0xf7, 0xe3, 0x01, 0x03, 0x06, 0x04, 0x04, 0x04, 0x06,
+  0x03, 0x01, 0x00, 0x80, 0xc0, 0x40, 0x40, 0x40, 0xc0, 0x80, 0x00, 0xc7, 0xef, 0x38, 0x10, 0x10,
+  0x10, 0x38, 0xef, 0xc7, 0x03, 0x07, 0x0c, 0x08, 0x08, 0x08, 0x0c, 0x07, 0x03, 0x00, 0x00, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x8e, 0xdf, 0x71, 0x20, 0x20, 0x20, 0x71, 0xdf, 0x8e, 0x07,
+  0x0f, 0x18, 0x10, 0x10, 0x10, 0x18, 0x0f, 0x07, 0x7c, 0xfe, 0x83, 0x01, 0x01, 0x01, 0x83, 0xfe,
+  0xfc, 0x00, 0x00, 0x21, 0x21, 0x21, 0x31, 0x18, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf8, 0xfc, 0x06, 0x02, 0x02, 0x02, 0x06, 0xfc, 0xf8, 0x00, 0x01, 0x43, 0x42,
+  0x42, 0x62, 0x31, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8,
+  0x0c, 0x04, 0x04, 0x04, 0x0c, 0xf8, 0xf0, 0x01, 0x03, 0x86, 0x84, 0x84, 0xc4, 0x62, 0x3f, 0x1f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0x18, 0x08, 0x08, 0x08, 0x18,
+  0xf0, 0xe0, 0x03, 0x07, 0x0c, 0x08, 0x08, 0x88, 0xc4, 0x7f, 0x3f, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0x30, 0x10, 0x10, 0x10, 0x30, 0xe0, 0xc0, 0x07, 0x0f, 0x18,
+  0x10, 0x10, 0x10, 0x88, 0xff, 0x7f, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x80,
+  0xc0, 0x60, 0x20, 0x20, 0x20, 0x60, 0xc0, 0x80, 0x0f, 0x1f, 0x30, 0x20, 0x20, 0x20, 0x10, 0xff,
+  0xff, 0x00, 0x00, 0x04, 0x04, 0x04, 0x06, 0x03, 0x01, 0x00, 0x00, 0x80, 0xc0, 0x40, 0x40, 0x40,
+  0xc0, 0x80, 0x00, 0x1f, 0x3f, 0x60, 0x40, 0x40, 0x40, 0x20, 0xff, 0xff, 0x00, 0x00, 0x08, 0x08,
+  0x08, 0x0c, 0x06, 0x03, 0x01, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x3e, 0x7f,
+  0xc1, 0x80, 0x80, 0x80, 0x41, 0xff, 0xfe, 0x00, 0x00, 0x10, 0x10, 0x10, 0x18, 0x0c, 0x07, 0x03,
+  0x18, 0x18, 0x06, 0x06, 0x00, 0x00, 0x30, 0x30, 0x0c, 0x0c, 0x00, 0x00, 0x60, 0x60, 0x18, 0x18,
+  0x00, 0x00, 0xc0, 0xc0, 0x30, 0x30, 0x00, 0x00, 0x80, 0x80, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00,
+  0xc3, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x01, 0x01, 0x00, 0x00, 0x0c, 0x0c, 0x03, 0x03,
+};
+
+const GlyphFont numerals_14 = {
+  14, 3, ' ', ':',
+  numerals_14_widths, numerals_14_advances, numerals_14_offsets, numerals_14_data
+};
+
+}  // namespace weegfx
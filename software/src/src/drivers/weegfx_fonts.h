@@ -0,0 +1,17 @@
+#ifndef WEEGFX_FONTS_H_
+#define WEEGFX_FONTS_H_
+
+#include "weegfx.h"
+
+// Glyph atlas fonts for large numeric readouts, see weegfx::GlyphFont.
+// Only ' ', '+', '-', '.', ':' and digits are populated.
+// Data is generated by res/weegfx_fonts.py
+
+namespace weegfx {
+
+extern const GlyphFont numerals_10; // 10px high, 7px advance
+extern const GlyphFont numerals_14; // 14px high, 11px advance
+
+}  // namespace weegfx
+
+#endif  // WEEGFX_FONTS_H_
@@ -50,24 +50,112 @@ const int64_t a = 0.1 * (1 << 24);
 const int64_t b = 0.1 * (1 << 24);
 // const int64_t c = 13.0 * (1 << 24);
 
-void LorenzGenerator::Init(uint8_t index) {
-  if (index) {
-    Lx2_ = 0.1 * (1 << 24);
-    Ly2_ = 0;
-    Lz2_ = 0;
-    Rx2_ = 0.1 * (1 << 24);
-    Ry2_ = 0;
-    Rz2_ = 0;
-  } else {
-    Lx1_ = 0.1 * (1 << 24);
-    Ly1_ = 0;
-    Lz1_ = 0;
-    Rx1_ = 0.1 * (1 << 24);
-    Ry1_ = 0;
-    Rz1_ = 0;
+// Largest Lorenz step each integrator takes before Process() splits it into
+// sub-steps, in the same 8.24 units as lut_lorenz_rate. Euler is only stable up
+// to 0.01, which is the most freq_range 4 ever asks for, so it never sub-steps
+// below freq_range 5 and sounds as it always did.
+const int64_t kLorenzMaxStep[LORENZ_INTEGRATOR_LAST] = {
+  static_cast<int64_t>(0.01 * (1 << 24)),
+  static_cast<int64_t>(0.02 * (1 << 24)),
+  static_cast<int64_t>(0.04 * (1 << 24)),
+};
+
+// Derivatives of both lanes of an attractor pair, in 8.24
+struct Derivative {
+  int64_t x[2];
+  int64_t y[2];
+  int64_t z[2];
+};
+
+struct LorenzSystem {
+  const int64_t *rho;
+
+  inline void Derive(const LorenzAttractorPair &s, Derivative &d) const {
+    for (int i = 0; i < 2; ++i) {
+      d.x[i] = (sigma * (s.y[i] - s.x[i])) >> 24;
+      d.y[i] = (s.x[i] * (rho[i] - s.z[i]) >> 24) - s.y[i];
+      d.z[i] = (s.x[i] * int64_t(s.y[i]) >> 24) - (beta * s.z[i] >> 24);
+    }
+  }
+};
+
+struct RosslerSystem {
+  const int64_t *c;
+
+  inline void Derive(const LorenzAttractorPair &s, Derivative &d) const {
+    for (int i = 0; i < 2; ++i) {
+      d.x[i] = -int64_t(s.y[i]) - s.z[i];
+      d.y[i] = s.x[i] + ((a * s.y[i]) >> 24);
+      d.z[i] = b + ((s.z[i] * (s.x[i] - c[i])) >> 24);
+    }
+  }
+};
+
+// out = s + dt * d / divisor
+static inline void Advance(
+    const LorenzAttractorPair &s,
+    const int64_t dt[2],
+    const Derivative &d,
+    LorenzAttractorPair &out,
+    int64_t divisor = 1) {
+  for (int i = 0; i < 2; ++i) {
+    out.x[i] = s.x[i] + ((dt[i] * d.x[i] / divisor) >> 24);
+    out.y[i] = s.y[i] + ((dt[i] * d.y[i] / divisor) >> 24);
+    out.z[i] = s.z[i] + ((dt[i] * d.z[i] / divisor) >> 24);
   }
 }
 
+template <typename System>
+static inline void Integrate(
+    const System &system,
+    LorenzIntegrator integrator,
+    const int64_t dt[2],
+    LorenzAttractorPair &s) {
+  Derivative k1, k2;
+  LorenzAttractorPair stage;
+  const int64_t half_dt[2] = { dt[0] >> 1, dt[1] >> 1 };
+
+  switch (integrator) {
+    case LORENZ_INTEGRATOR_MIDPOINT:
+      system.Derive(s, k1);
+      Advance(s, half_dt, k1, stage);
+      system.Derive(stage, k2);
+      Advance(s, dt, k2, s);
+      break;
+    case LORENZ_INTEGRATOR_RK4: {
+      Derivative k3, k4;
+      system.Derive(s, k1);
+      Advance(s, half_dt, k1, stage);
+      system.Derive(stage, k2);
+      Advance(s, half_dt, k2, stage);
+      system.Derive(stage, k3);
+      Advance(s, dt, k3, stage);
+      system.Derive(stage, k4);
+      for (int i = 0; i < 2; ++i) {
+        k1.x[i] += 2 * (k2.x[i] + k3.x[i]) + k4.x[i];
+        k1.y[i] += 2 * (k2.y[i] + k3.y[i]) + k4.y[i];
+        k1.z[i] += 2 * (k2.z[i] + k3.z[i]) + k4.z[i];
+      }
+      Advance(s, dt, k1, s, 6);
+      break;
+    }
+    default:
+      system.Derive(s, k1);
+      Advance(s, dt, k1, s);
+      break;
+  }
+}
+
+void LorenzGenerator::Init(uint8_t index) {
+  index = index ? 1 : 0;
+  lorenz_.x[index] = 0.1 * (1 << 24);
+  lorenz_.y[index] = 0;
+  lorenz_.z[index] = 0;
+  rossler_.x[index] = 0.1 * (1 << 24);
+  rossler_.y[index] = 0;
+  rossler_.z[index] = 0;
+}
+
 void LorenzGenerator::Process(
     int32_t freq1,
     int32_t freq2,
@@ -81,56 +169,49 @@ void LorenzGenerator::Process(
   int32_t rate2 = (freq2 >> 8);
   if (rate2 < 0) rate2 = 0;
   if (rate2 > 255) rate2 = 255;
+  if (freq_range1 > kMaxFreqRange) freq_range1 = kMaxFreqRange;
+  if (freq_range2 > kMaxFreqRange) freq_range2 = kMaxFreqRange;
 
   if (reset1) Init(0) ;
   if (reset2) Init(1) ; 
 
-  // yes, yes, these should be functions...
-  // Lorenz 1
-  int64_t Ldt1 = static_cast<int64_t>(lut_lorenz_rate[rate1] >> (5 - freq_range1)); // was 5
-  int32_t Lx1 = Lx1_ + (Ldt1 * ((sigma * (Ly1_ - Lx1_)) >> 24) >> 24);
-  int32_t Ly1 = Ly1_ + (Ldt1 * ((Lx1_ * (rho1_ - Lz1_) >> 24) - Ly1_) >> 24);
-  int32_t Lz1 = Lz1_ + (Ldt1 * ((Lx1_ * int64_t(Ly1_) >> 24) - (beta * Lz1_ >> 24)) >> 24); 
-  Lx1_ = Lx1;
-  Ly1_ = Ly1;
-  Lz1_ = Lz1; 
-  int32_t Lz1_scaled = ((Lz1 * 3) >> 16);
-  int32_t Lx1_scaled = ((Lx1 * 3) >> 16) + 32769;
-  int32_t Ly1_scaled = ((Ly1 * 3) >> 16) + 32769;
-  // Rossler 1
-  int64_t Rdt1 = static_cast<int64_t>(lut_lorenz_rate[rate1] >> 0);
-  int32_t Rx1 = Rx1_ + ((Rdt1 * (-Ry1_ - Rz1_ )) >> 24);
-  int32_t Ry1 = Ry1_ + ((Rdt1 * (Rx1_ + ((a * Ry1_) >> 24))) >> 24);
-  int32_t Rz1 = Rz1_ + ((Rdt1 * (b + ((Rz1_ * (Rx1_ - c1_)) >> 24)))  >> 24);
-  Rx1_ = Rx1;
-  Ry1_ = Ry1;
-  Rz1_ = Rz1; 
-  int32_t Rz1_scaled = (Rz1 >> 14);
-  int32_t Rx1_scaled = (Rx1 >> 14) + 32769;
-  int32_t Ry1_scaled = (Ry1 >> 14) + 32769;
-
-  // Lorenz 2
-  int64_t Ldt2 = static_cast<int64_t>(lut_lorenz_rate[rate2] >> (5 - freq_range2)); // was 5
-  int32_t Lx2 = Lx2_ + (Ldt2 * ((sigma * (Ly2_ - Lx2_)) >> 24) >> 24);
-  int32_t Ly2 = Ly2_ + (Ldt2 * ((Lx2_ * (rho2_ - Lz2_) >> 24) - Ly2_) >> 24);
-  int32_t Lz2 = Lz2_ + (Ldt2 * ((Lx2_ * int64_t(Ly2_) >> 24) - (beta * Lz2_ >> 24)) >> 24); 
-  Lx2_ = Lx2;
-  Ly2_ = Ly2;
-  Lz2_ = Lz2; 
-  int32_t Lz2_scaled = ((Lz2 * 3) >> 16);
-  int32_t Lx2_scaled = ((Lx2 * 3) >> 16) + 32769;
-  int32_t Ly2_scaled = ((Ly2 * 3) >> 16) + 32769;
-  // Rossler 2
-  int64_t Rdt2 = static_cast<int64_t>(lut_lorenz_rate[rate2] >> 0);
-  int32_t Rx2 = Rx2_ + ((Rdt2 * (-Ry2_ - Rz2_ )) >> 24);
-  int32_t Ry2 = Ry2_ + ((Rdt2 * (Rx2_ + ((a * Ry2_) >> 24))) >> 24);
-  int32_t Rz2 = Rz2_ + ((Rdt2 * (b + ((Rz2_ * (Rx2_ - c2_)) >> 24)))  >> 24);
-  Rx2_ = Rx2;
-  Ry2_ = Ry2;
-  Rz2_ = Rz2; 
-  int32_t Rz2_scaled = (Rz2 >> 14);
-  int32_t Rx2_scaled = (Rx2 >> 14) + 32769;
-  int32_t Ry2_scaled = (Ry2 >> 14) + 32769;
+  // Lorenz, split into equal sub-steps when either lane's step is too large for
+  // the integrator. Both lanes take the same number so they stay in lockstep.
+  int64_t Ldt[2] = {
+    static_cast<int64_t>(lut_lorenz_rate[rate1] >> (kMaxFreqRange - freq_range1)),
+    static_cast<int64_t>(lut_lorenz_rate[rate2] >> (kMaxFreqRange - freq_range2))
+  };
+  int64_t max_step = kLorenzMaxStep[integrator_];
+  int64_t largest = Ldt[0] > Ldt[1] ? Ldt[0] : Ldt[1];
+  uint8_t shift = 0;
+  while ((largest >> shift) > max_step) ++shift;
+  Ldt[0] >>= shift;
+  Ldt[1] >>= shift;
+  LorenzSystem lorenz = { rho_ };
+  for (int step = 1 << shift; step; --step)
+    Integrate(lorenz, integrator_, Ldt, lorenz_);
+
+  // Rossler moves slowly enough to never need sub-steps
+  int64_t Rdt[2] = {
+    static_cast<int64_t>(lut_lorenz_rate[rate1]),
+    static_cast<int64_t>(lut_lorenz_rate[rate2])
+  };
+  RosslerSystem rossler = { c_ };
+  Integrate(rossler, integrator_, Rdt, rossler_);
+
+  int32_t Lz1_scaled = ((lorenz_.z[0] * 3) >> 16);
+  int32_t Lx1_scaled = ((lorenz_.x[0] * 3) >> 16) + 32769;
+  int32_t Ly1_scaled = ((lorenz_.y[0] * 3) >> 16) + 32769;
+  int32_t Rz1_scaled = (rossler_.z[0] >> 14);
+  int32_t Rx1_scaled = (rossler_.x[0] >> 14) + 32769;
+  int32_t Ry1_scaled = (rossler_.y[0] >> 14) + 32769;
+
+  int32_t Lz2_scaled = ((lorenz_.z[1] * 3) >> 16);
+  int32_t Lx2_scaled = ((lorenz_.x[1] * 3) >> 16) + 32769;
+  int32_t Ly2_scaled = ((lorenz_.y[1] * 3) >> 16) + 32769;
+  int32_t Rz2_scaled = (rossler_.z[1] >> 14);
+  int32_t Rx2_scaled = (rossler_.x[1] >> 14) + 32769;
+  int32_t Ry2_scaled = (rossler_.y[1] >> 14) + 32769;
 
   uint8_t out_channel ;
   
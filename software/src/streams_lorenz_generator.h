@@ -69,9 +69,26 @@ enum ELorenzOutputMap {
   LORENZ_OUTPUT_LAST,
 };
 
+enum LorenzIntegrator {
+  LORENZ_INTEGRATOR_EULER,
+  LORENZ_INTEGRATOR_MIDPOINT,
+  LORENZ_INTEGRATOR_RK4,
+  LORENZ_INTEGRATOR_LAST
+};
+
+// Largest freq_range; the Lorenz step is lut_lorenz_rate >> (kMaxFreqRange - freq_range)
+const uint8_t kMaxFreqRange = 5;
+
+// Lanes for 1 and 2 of each system, stepped together
+struct LorenzAttractorPair {
+  int32_t x[2];
+  int32_t y[2];
+  int32_t z[2];
+};
+
 class LorenzGenerator {
  public:
-  LorenzGenerator() { }
+  LorenzGenerator() : integrator_(LORENZ_INTEGRATOR_EULER) { }
   ~LorenzGenerator() { }
   
   void Init(uint8_t index);
@@ -82,19 +99,24 @@ class LorenzGenerator {
     index_ = index;
   }
 
+  // Euler is the original behaviour and the cheapest. Midpoint and RK4 cost
+  // about 2x and 4x per step but stay on the attractor at much larger steps;
+  // see oc_test_lorenz.cpp for a benchmark. Lorenz and LowerRenz only use RK4
+  // when built with LORENZ_RK4.
+  inline void set_integrator(LorenzIntegrator integrator) {
+    integrator_ = integrator;
+  }
+
+  inline LorenzIntegrator integrator() const {
+    return integrator_;
+  }
  
   inline void set_rho1(int16_t rho) {
-    // rho1_ = ((double)(rho) * (1 << 13)) + 24.0 * (1 << 24) ; // was 12
-    // c1_ = (double)(rho + (6 << 3)) * (1 << 13) ; // was 13
-    rho1_ = (rho * (1 << 13)) + 24.0 * (1 << 24) ; // was 12
-    c1_ = (rho + (6 << 3)) * (1 << 13) ; // was 13
+    set_rho(0, rho);
   }
 
   inline void set_rho2(int16_t rho) {
-    // rho2_ = ((double)(rho) * (1 << 13)) + 24.0 * (1 << 24) ; // was 12
-    // c2_ = (double)(rho + (6 << 3)) * (1 << 13) ; // was 13
-    rho2_ = (rho * (1 << 13)) + 24.0 * (1 << 24) ; // was 12
-    c2_ = (rho + (6 << 3)) * (1 << 13) ; // was 13
+    set_rho(1, rho);
   }
 
   inline void set_out_a(uint8_t out_a) {
@@ -118,14 +140,20 @@ class LorenzGenerator {
   }
 
  private:
-  int32_t Lx1_, Ly1_, Lz1_;
-  int32_t Rx1_, Ry1_, Rz1_;
-  int32_t Lx2_, Ly2_, Lz2_;
-  int32_t Rx2_, Ry2_, Rz2_;
+  LorenzAttractorPair lorenz_;
+  LorenzAttractorPair rossler_;
 
   uint8_t out_a_, out_b_, out_c_, out_d_ ;
 
-  int64_t sigma_, rho1_, rho2_, beta_, c1_,  c2_ ;
+  int64_t rho_[2], c_[2];
+  LorenzIntegrator integrator_;
+
+  inline void set_rho(int lane, int16_t rho) {
+    // rho_[lane] = ((double)(rho) * (1 << 13)) + 24.0 * (1 << 24) ; // was 12
+    // c_[lane] = (double)(rho + (6 << 3)) * (1 << 13) ; // was 13
+    rho_[lane] = (rho * (1 << 13)) + 24.0 * (1 << 24) ; // was 12
+    c_[lane] = (rho + (6 << 3)) * (1 << 13) ; // was 13
+  }
   
   // O+C
   uint16_t dac_code_[kNumChannels];
@@ -1,4 +1,5 @@
 #pragma once
+#include <stddef.h>
 #include <stdint.h>
 
 static constexpr int LUT_INCREMENTS_SIZE = 97;
@@ -278,3 +279,144 @@ void ProcessSample(uint16_t slope, uint16_t shape, int16_t fold, uint32_t phase,
     sample.bipolar = original + ((folded - original) * wf_balance >> 15);
   }
 }
+
+// Same result as ProcessSample, but everything that only depends on slope,
+// shape and fold is computed when those change rather than on every sample.
+// That removes the two slope divisions and the shape/fold setup from the
+// per-sample path; only the curve division inside WarpPhase remains since it
+// depends on the phase.
+class TidesLiteVoice {
+public:
+  void Init() {
+    slope_ = 0;
+    shape_ = 0;
+    fold_ = 0;
+    UpdateSlope(0);
+    UpdateShape(0);
+    UpdateFold(0);
+  }
+
+  void Configure(uint16_t slope, uint16_t shape, int16_t fold) {
+    if (slope != slope_) UpdateSlope(slope);
+    if (shape != shape_) UpdateShape(shape);
+    if (fold != fold_) UpdateFold(fold);
+  }
+
+  void Process(uint32_t phase, TidesLiteSample &sample) const {
+    uint32_t skewed_phase;
+    if (phase <= eoa_) {
+      skewed_phase = (phase >> kSlopeBits) * decay_factor_;
+      sample.flags = FLAG_EOR;
+    } else {
+      skewed_phase = ((phase - eoa_) >> kSlopeBits) * attack_factor_;
+      skewed_phase += 1UL << 31;
+      sample.flags = FLAG_EOA;
+    }
+
+    sample.unipolar = Shape(skewed_phase >> 16);
+    sample.bipolar = Shape(skewed_phase >> 15) >> 1;
+    if (skewed_phase >= (1UL << 31)) {
+      sample.bipolar = -sample.bipolar;
+    }
+
+    if (fold_ > 0) {
+      int32_t original = sample.unipolar;
+      int32_t folded = Interpolate824(wav_unipolar_fold, original * wf_gain_) << 1;
+      sample.unipolar = original + ((folded - original) * fold_ >> 15);
+
+      original = sample.bipolar;
+      folded = Interpolate824(wav_bipolar_fold, original * wf_gain_ + (1UL << 31));
+      sample.bipolar = original + ((folded - original) * fold_ >> 15);
+    }
+  }
+
+  // Evaluate n arbitrary phases with the current settings
+  void ProcessSamples(const uint32_t *phases, TidesLiteSample *samples, size_t n) const {
+    while (n--)
+      Process(*phases++, *samples++);
+  }
+
+  // Evaluate n evenly spaced phases, e.g. one cycle for a preview
+  void ProcessSamples(uint32_t phase, uint32_t phase_increment, TidesLiteSample *samples, size_t n) const {
+    while (n--) {
+      Process(phase, *samples++);
+      phase += phase_increment;
+    }
+  }
+
+private:
+  // WarpPhase with the curve-dependent terms precomputed
+  struct Curve {
+    bool flip;
+    uint32_t a;     // a / max_8 in WarpPhase
+    uint32_t gain;  // max_8 + a / max_8
+
+    void Init(uint16_t curve) {
+      int32_t c = (curve - 32767) >> 8;
+      flip = c < 0;
+      a = 128 * c * c / max_8;
+      gain = max_8 + a;
+    }
+
+    uint32_t Warp(uint16_t phase) const {
+      uint32_t p = flip ? max_16 - phase : phase;
+      uint16_t warped = gain * p / ((max_16 + a * p / max_8) / max_8);
+      return flip ? max_16 - warped : warped;
+    }
+  };
+
+  uint16_t slope_;
+  uint16_t shape_;
+  int16_t fold_;
+
+  uint32_t eoa_;
+  uint32_t decay_factor_;
+  uint32_t attack_factor_;
+  Curve attack_curve_;
+  Curve decay_curve_;
+  int32_t wf_gain_;
+
+  uint16_t Shape(uint16_t phase) const {
+    return phase < (1UL << 15)
+               ? attack_curve_.Warp(phase << 1)
+               : decay_curve_.Warp((0xffff - phase) << 1);
+  }
+
+  void UpdateSlope(uint16_t slope) {
+    slope_ = slope;
+    eoa_ = static_cast<uint32_t>(slope) << 16;
+    if (!slope) slope = 1;
+    decay_factor_ = (32768 << kSlopeBits) / slope;
+    attack_factor_ = (32768 << kSlopeBits) / (65536 - slope);
+  }
+
+  void UpdateShape(uint16_t shape) {
+    shape_ = shape;
+    // Same segments as ShapePhase(phase, shape)
+    uint32_t att, dec;
+    if (shape < 1 * 65536 / 4) {
+      shape *= 4;
+      att = 0;
+      dec = 65535 - shape;
+    } else if (shape < 2 * 65536 / 4) {
+      shape = (shape - 65536 / 4) * 4;
+      att = shape;
+      dec = shape;
+    } else if (shape < 3 * 65536 / 4) {
+      shape = (shape - 2 * 65536 / 4) * 4;
+      att = 65535;
+      dec = 65535 - shape;
+    } else {
+      shape = (shape - 3 * 65536 / 4) * 4;
+      att = 65535 - shape;
+      dec = shape;
+    }
+    attack_curve_.Init(att);
+    decay_curve_.Init(dec);
+  }
+
+  void UpdateFold(int16_t fold) {
+    fold_ = fold;
+    wf_gain_ = 2048 + (fold * (32767 - 1024) >> 14);
+  }
+};
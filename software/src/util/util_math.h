@@ -38,6 +38,8 @@
 #define MOD_8(n, div) \
   FAST_FP_MOD(n, div, 8)
 
+// Non-ARM versions are only for building and testing DSP code on a host.
+#if defined(__arm__)
 inline uint32_t USAT16(uint32_t value) __attribute__((always_inline));
 inline uint32_t USAT16(uint32_t value) {
   uint32_t result;
@@ -67,6 +69,23 @@ static inline uint32_t multiply_u32xu32_rshift(uint32_t a, uint32_t b, uint32_t
   asm volatile("umull %0, %1, %2, %3" : "=r" (lo), "=r" (hi) : "r" (a), "r" (b));
   return (lo >> shift) | (hi << (32 - shift));
 }
+#else
+inline uint32_t USAT16(int32_t value) {
+  return value < 0 ? 0 : value > 65535 ? 65535 : value;
+}
+
+inline uint32_t USAT16(uint32_t value) {
+  return USAT16(static_cast<int32_t>(value));
+}
+
+static inline uint32_t multiply_u32xu32_rshift24(uint32_t a, uint32_t b) {
+  return static_cast<uint32_t>((static_cast<uint64_t>(a) * b) >> 24);
+}
+
+static inline uint32_t multiply_u32xu32_rshift(uint32_t a, uint32_t b, uint32_t shift) {
+  return static_cast<uint32_t>((static_cast<uint64_t>(a) * b) >> shift);
+}
+#endif
 
 template <typename T, T smoothing>
 struct SmoothedValue {
@@ -90,6 +90,7 @@ public:
             memcpy(&segments[segment_count], &segment, sizeof(segments[segment_count]));
             total_time += segments[segment_count].time;
             segment_count++;
+            update_segment_tables();
         }
     }
 
@@ -100,6 +101,7 @@ public:
         memcpy(&segments[ix], &segment, sizeof(segments[ix]));
         total_time += segments[ix].time;
         if (ix == segment_count) segment_count++;
+        update_segment_tables();
     }
 
     HS::VOSegment GetSegment(byte ix) {
@@ -107,12 +109,18 @@ public:
         return segments[ix];
     }
 
-    void SetScale(uint16_t scale_) {scale = scale_;}
+    void SetScale(uint16_t scale_) {
+        if (scale_ != scale) {
+            scale = scale_;
+            update_levels();
+        }
+    }
 
     /* frequency is centihertz (e.g., 440 Hz is 44000) */
     void SetFrequency(uint32_t frequency_) {
         if (frequency_ != frequency) {
             frequency = frequency_;
+            cycle_ticks = frequency ? 16666667 / frequency : 0;
             rise = calculate_rise(segment_index);
         }
     }
@@ -130,7 +138,7 @@ public:
 
     void Reset() {
         segment_index = 0;
-        signal = scale_level(segments[segment_count - 1].level);
+        signal = scale_level(segment_count - 1);
         rise = calculate_rise(segment_index);
         sustained = 0;
         eoc = !cycle;
@@ -139,7 +147,7 @@ public:
     int32_t Next() {
     		// For non-cycling waveforms, send the level of the last step if eoc
     		if (eoc && cycle == 0) {
-    			vosignal_t nr_signal = scale_level(segments[segment_count - 1].level);
+    			vosignal_t nr_signal = scale_level(segment_count - 1);
     			return signal2int(nr_signal) + offset;
     		}
         if (!sustained) { // Observe sustain state
@@ -164,30 +172,28 @@ public:
     int32_t Phase(int degrees) {
     		degrees = degrees % 3600;
     		degrees = abs(degrees);
+    		if (segment_count == 0) return offset;
 
-    		// I need to find out which segment the specified phase occurs in
+    		// Find the first segment that ends after the specified phase. phase_peak is non-decreasing,
+    		// so this is a binary search; if no segment qualifies, the phase is treated as being in the
+    		// first segment.
     		byte time_index = Proportion(degrees, 3600, total_time);
-    		byte segment = 0;
-    		byte time = 0;
-    		for (byte ix = 0; ix < segment_count; ix++)
-    		{
-    			time += segments[ix].time;
-    			if (time > time_index) {
-    				segment = ix;
-    				break;
-    			}
+    		byte lo = 0;
+    		byte hi = segment_count;
+    		while (lo < hi) {
+    			byte mid = (lo + hi) >> 1;
+    			if (phase_peak[mid] > time_index) hi = mid;
+    			else lo = mid + 1;
     		}
-
-    		// Where does this segment start, and how many degrees does it span?
-    		int start_degree = Proportion(time - segments[segment].time, total_time, 3600);
-    		int segment_degrees = Proportion(segments[segment].time, total_time, 3600);
+    		int start_degree = lo < segment_count ? phase_start[lo] : phase_wrap_start;
+    		byte segment = lo < segment_count ? lo : 0;
 
     		// Start and end point of the total segment
-    		int start = signal2int(scale_level(segment == 0 ? segments[segment_count - 1].level : segments[segment - 1].level));
-    		int end = signal2int(scale_level(segments[segment].level));
+    		int start = levels[segment == 0 ? segment_count - 1 : segment - 1];
+    		int end = levels[segment];
 
     		// Determine the signal based on the levels and the position within the segment
-    		int signal = Proportion(degrees - start_degree, segment_degrees, end - start) + start;
+    		int signal = signal2int(phase_proportion(degrees - start_degree, segment) * (end - start)) + start;
 
         return signal + offset;
     }
@@ -200,15 +206,26 @@ private:
     vosignal_t target = 0; // Target scaled signal. When the target is reached, the Oscillator moves to the next segment.
     bool eoc = 1; // The most recent tick's next() read was the end of a cycle
     byte segment_index = 0; // Which segment the Oscillator is currently traversing
-    vosignal_t rise; // The amount (per tick) the signal must rise to reach the target
-    uint32_t frequency; // In centihertz
-    uint16_t scale; // The maximum (and minimum negative) output for this Oscillator
-    uint32_t countdown; // Ticks left for a segment with a rise of 0
+    vosignal_t rise = 0; // The amount (per tick) the signal must rise to reach the target
+    uint32_t frequency = 0; // In centihertz
+    uint16_t scale = 0; // The maximum (and minimum negative) output for this Oscillator
+    uint32_t countdown = 0; // Ticks left for a segment with a rise of 0
     bool cycle = 1; // Waveform will cycle
     int32_t offset = 0; // Amount added to each voltage output (e.g., to make it unipolar)
     bool sustain = 0; // Waveform stops when it reaches the end of the penultimate stage
     bool sustained = 0; // Current state of sustain. Only active when sustain = 1
 
+    // Tables derived from the segments, scale and frequency, so that Next() and Phase() don't have to
+    // divide. They are rebuilt by the setters.
+    int32_t levels[12] = {}; // Scaled level of each segment (scale_level() >> 10)
+    int32_t tick_share[12] = {}; // Each segment's share of the cycle, (time << 10) / total_time
+    int32_t cycle_ticks = 0; // 16666667 / frequency
+    byte phase_peak[12] = {}; // Highest running time (kept in a byte) up to each segment
+    int16_t phase_start[12] = {}; // Degree at which each segment starts
+    int16_t phase_wrap_start = 0; // Start degree used when the phase falls past every segment
+    uint16_t phase_degrees[12] = {}; // Degrees spanned by each segment
+    uint32_t phase_inverse[12] = {}; // 2^32 / phase_degrees, see phase_proportion()
+
     /*
      * The Oscillator can only oscillate if the following conditions are true:
      *     (1) The frequency must be greater than 0
@@ -231,15 +248,59 @@ private:
         return scaled;
     }
 
+    /* Proportion() for the table setup, which may see a total time of 0 while a waveform is being built */
+    int32_t SafeProportion(int numerator, int denominator, int max_value) {
+        return denominator ? Proportion(numerator, denominator, max_value) : 0;
+    }
+
+    /* Scaled signal value of a segment's level */
+    vosignal_t scale_level(byte ix) {
+        return int2signal(levels[ix]);
+    }
+
     /*
-     * Provide a signal value based on a segment level. The segment level is internally
-     * 0-255, and this is converted to a bipolar value by subtracting 128.
+     * The segment level is internally 0-255, and this is converted to a bipolar value by subtracting
+     * 128, then scaled.
      */
-    vosignal_t scale_level(byte level) {
-        int b_level = constrain(level, 0, 255) - 128;
-        int scaled = Proportion(b_level, 127, scale);
-        vosignal_t scaled_level = int2signal(scaled);
-        return scaled_level;
+    void update_levels() {
+        for (byte ix = 0; ix < segment_count; ix++)
+        {
+            int b_level = constrain(segments[ix].level, 0, 255) - 128;
+            levels[ix] = Proportion(b_level, 127, scale);
+        }
+    }
+
+    void update_segment_tables() {
+        update_levels();
+
+        // The running time is kept in a byte, so for waveforms longer than 255 it wraps around. Keeping
+        // the highest value seen so far makes the table searchable either way.
+        byte time = 0;
+        byte peak = 0;
+        for (byte ix = 0; ix < segment_count; ix++)
+        {
+            time += segments[ix].time;
+            if (time > peak) peak = time;
+            phase_peak[ix] = peak;
+            phase_start[ix] = SafeProportion(time - segments[ix].time, total_time, 3600);
+            phase_degrees[ix] = SafeProportion(segments[ix].time, total_time, 3600);
+            phase_inverse[ix] = phase_degrees[ix] > 1 ? 0x100000000ULL / phase_degrees[ix] : 0xffffffff;
+            tick_share[ix] = SafeProportion(segments[ix].time, total_time, 1024);
+        }
+        if (segment_count) phase_wrap_start = SafeProportion(time - segments[0].time, total_time, 3600);
+    }
+
+    /*
+     * int2signal(degrees) / phase_degrees[ix], rounded toward zero. The reciprocal estimate is at
+     * most one short for the range of degrees Phase() can produce, so one correction makes it exact.
+     */
+    vosignal_t phase_proportion(int degrees, byte ix) {
+        uint32_t d = phase_degrees[ix];
+        if (d == 0) return 0;
+        uint32_t x = int2signal(static_cast<uint32_t>(abs(degrees)));
+        uint32_t q = (static_cast<uint64_t>(x) * phase_inverse[ix]) >> 32;
+        if ((q + 1) * d <= x) q++;
+        return degrees < 0 ? -static_cast<vosignal_t>(q) : static_cast<vosignal_t>(q);
     }
 
     void advance_segment() {
@@ -256,21 +317,16 @@ private:
 
     vosignal_t calculate_rise(byte ix) {
         // Determine the target level for this segment
-        byte level = segments[ix].level;
-        int time = static_cast<uint32_t>(segments[ix].time);
-        target = scale_level(level);
+        target = scale_level(ix);
+
+        // How many ticks should the current segment last? cycle_ticks is 10 times the number of ticks
+        // a complete cycle should last.
+        int32_t segment_ticks = signal2int(tick_share[ix] * cycle_ticks);
 
         // Determine the starting level of this segment to get the total segment rise
         if (ix > 0) ix--;
         else ix = segment_count - 1;
-        level = segments[ix].level;
-        vosignal_t starting = scale_level(level);
-
-        // How many ticks should a complete cycle last? cycle_ticks is 10 times that number.
-        int32_t cycle_ticks = 16666667 / frequency;
-
-        // How many ticks should the current segment last?
-        int32_t segment_ticks = Proportion(time, total_time, cycle_ticks);
+        vosignal_t starting = scale_level(ix);
 
         // The total difference between the target and the current signal, divided by how many ticks
         // it should take to get there, is the rise. The / 10 is to cancel the extra precision
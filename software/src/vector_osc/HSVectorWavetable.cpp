@@ -0,0 +1,136 @@
+#include <math.h>
+#include "HSVectorWavetable.h"
+
+namespace HS {
+
+// Full scale for a segment level of 0 or 255. This leaves room for the Gibbs overshoot at jumps,
+// and for the fundamental of a full-scale square, which is 4/pi of it.
+static const float kWavetableAmplitude = 25000.0f;
+
+void VectorWavetableBuilder::Init() {
+    for (size_t i = 0; i < kTableSize / 2; i++)
+    {
+        float angle = 2.0f * static_cast<float>(M_PI) * i / kTableSize;
+        cos_[i] = cosf(angle);
+        sin_[i] = sinf(angle);
+    }
+    count_ = 0;
+    step_ = VectorWavetable::kNumLevels + 1;
+}
+
+void VectorWavetableBuilder::Start(const WavetableSegment *segments, size_t count) {
+    if (count > WAVETABLE_MAX_SEGMENTS) count = WAVETABLE_MAX_SEGMENTS;
+    memcpy(segments_, segments, count * sizeof(segments_[0]));
+    count_ = count;
+    step_ = 0;
+}
+
+int VectorWavetableBuilder::Step() {
+    if (!busy()) return -1;
+
+    if (step_ == 0) {
+        // Draw the waveform and keep its spectrum
+        Draw();
+        FFT(-1.0f);
+        for (size_t k = 0; k < kNumBins; k++)
+        {
+            spectrum_re_[k] = re_[k];
+            spectrum_im_[k] = im_[k];
+        }
+        ++step_;
+        return -1;
+    }
+
+    // Resynthesize with the harmonics that fit this level. DC is left out, since this is audio.
+    int level = step_ - 1;
+    size_t harmonics = level ? (kTableSize / 2) >> level : kTableSize / 2 - 1;
+    memset(re_, 0, sizeof(re_));
+    memset(im_, 0, sizeof(im_));
+    for (size_t k = 1; k <= harmonics; k++)
+    {
+        re_[k] = spectrum_re_[k];
+        im_[k] = spectrum_im_[k];
+        re_[kTableSize - k] = spectrum_re_[k];
+        im_[kTableSize - k] = -spectrum_im_[k];
+    }
+    FFT(1.0f);
+
+    // A level that still won't fit is turned down rather than clipped, since clipping would put
+    // back the harmonics that were just taken out
+    float scale = kWavetableAmplitude / kTableSize;
+    float peak = 0.0f;
+    for (size_t i = 0; i < kTableSize; i++) peak = fmaxf(peak, fabsf(re_[i]));
+    if (peak * scale > 32767.0f) scale = 32767.0f / peak;
+    for (size_t i = 0; i < kTableSize; i++)
+        level_data_[i] = static_cast<int16_t>(lrintf(re_[i] * scale));
+    level_data_[kTableSize] = level_data_[0];
+
+    ++step_;
+    return level;
+}
+
+/*
+ * Sample the segments into re_ the way VectorOscillator plays them: each segment moves in a straight
+ * line from the previous segment's level to its own, and segments with a time of 0 are jumps.
+ */
+void VectorWavetableBuilder::Draw() {
+    memset(im_, 0, sizeof(im_));
+
+    int total_time = 0;
+    for (size_t s = 0; s < count_; s++) total_time += segments_[s].time;
+    if (count_ < 2 || total_time == 0) {
+        memset(re_, 0, sizeof(re_));
+        return;
+    }
+
+    size_t s = 0;
+    int segment_start = 0; // Time at which segment s starts
+    for (size_t i = 0; i < kTableSize; i++)
+    {
+        float t = static_cast<float>(i) * total_time / kTableSize;
+        while (s < count_ - 1 && t >= segment_start + segments_[s].time) segment_start += segments_[s++].time;
+
+        float from = segments_[s ? s - 1 : count_ - 1].level - 128;
+        float to = segments_[s].level - 128;
+        float position = segments_[s].time ? (t - segment_start) / segments_[s].time : 1.0f;
+        re_[i] = (from + (to - from) * position) / 127.0f;
+    }
+}
+
+/* In-place radix-2 FFT of re_ + i * im_. direction is -1 for forward and 1 for inverse (unscaled). */
+void VectorWavetableBuilder::FFT(float direction) {
+    for (size_t i = 1, j = 0; i < kTableSize; i++)
+    {
+        size_t bit = kTableSize >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) {
+            float tmp = re_[i]; re_[i] = re_[j]; re_[j] = tmp;
+            tmp = im_[i]; im_[i] = im_[j]; im_[j] = tmp;
+        }
+    }
+
+    for (size_t length = 2; length <= kTableSize; length <<= 1)
+    {
+        size_t half = length >> 1;
+        size_t stride = kTableSize / length;
+        for (size_t i = 0; i < kTableSize; i += length)
+        {
+            for (size_t k = 0; k < half; k++)
+            {
+                float wr = cos_[k * stride];
+                float wi = direction * sin_[k * stride];
+                float *ar = &re_[i + k], *ai = &im_[i + k];
+                float *br = &re_[i + k + half], *bi = &im_[i + k + half];
+                float tr = *br * wr - *bi * wi;
+                float ti = *br * wi + *bi * wr;
+                *br = *ar - tr;
+                *bi = *ai - ti;
+                *ar += tr;
+                *ai += ti;
+            }
+        }
+    }
+}
+
+} // namespace HS
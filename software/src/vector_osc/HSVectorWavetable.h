@@ -0,0 +1,135 @@
+/*
+ * Vector waveforms as band-limited wavetables, for playing them at audio rate.
+ *
+ * Stepping through the segments like VectorOscillator does is fine for modulation, but the corners
+ * alias badly once the frequency goes up. Instead, the waveform is drawn into a table, and its
+ * spectrum is used to make one table per octave (a mip-map), each with only the harmonics that fit
+ * below Nyquist for that octave. Playback is then an interpolated table lookup.
+ */
+
+#ifndef HS_VECTOR_WAVETABLE_H
+#define HS_VECTOR_WAVETABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace HS {
+
+/* Same layout as VOSegment: target level 0-255 (128 is zero) and relative time */
+struct WavetableSegment {
+    uint8_t level;
+    uint8_t time;
+};
+
+const size_t WAVETABLE_MAX_SEGMENTS = 12;
+
+/*
+ * Copy the segments of a waveform, numbered as in WaveformManager (library waveforms start at 32).
+ * Returns the number of segments, or 0 if there's no such waveform. Defined in WaveformManager.h,
+ * since that's the only place the waveform memory can be seen from.
+ */
+size_t GetWavetableSegments(uint8_t waveform_number, WavetableSegment *segments);
+
+class VectorWavetable {
+public:
+    static constexpr int kTableBits = 10;
+    static constexpr size_t kTableSize = 1 << kTableBits;
+
+    /*
+     * Level n has harmonics up to 512 >> n (511 for level 0), so it's free of aliasing for phase
+     * increments below 2^(22 + n). The last level is a sine.
+     */
+    static constexpr int kNumLevels = kTableBits;
+
+    void Init() {
+        ready_ = false;
+    }
+
+    /* All levels have been generated at least once */
+    bool ready() const {
+        return ready_;
+    }
+
+    void set_ready() {
+        ready_ = true;
+    }
+
+    /* Replace one level with kTableSize + 1 samples (the last being a copy of the first) */
+    void SetLevel(int level, const int16_t *data) {
+        memcpy(tables_[level], data, sizeof(tables_[level]));
+    }
+
+    static int LevelForIncrement(uint32_t increment) {
+        int level = 10 - __builtin_clz(increment | 1);
+        if (level < 0) level = 0;
+        if (level > kNumLevels - 1) level = kNumLevels - 1;
+        return level;
+    }
+
+    /* Render size samples at a fixed increment, advancing phase */
+    void Render(uint32_t &phase, uint32_t increment, int16_t *out, size_t size) const {
+        const int16_t *table = tables_[LevelForIncrement(increment)];
+        uint32_t p = phase;
+        while (size--) {
+            const int16_t *t = table + (p >> (32 - kTableBits));
+            int32_t frac = (p >> (32 - kTableBits - 15)) & 0x7fff;
+            *out++ = t[0] + (((t[1] - t[0]) * frac) >> 15);
+            p += increment;
+        }
+        phase = p;
+    }
+
+private:
+    int16_t tables_[kNumLevels][kTableSize + 1];
+    bool ready_;
+};
+
+/*
+ * Generates the levels of a VectorWavetable. The work is split into steps of one FFT each, so
+ * that it can be done a bit at a time from loop() while the previous tables keep playing.
+ */
+class VectorWavetableBuilder {
+public:
+    void Init();
+
+    /* Begin generating tables for a new waveform; a build in progress is abandoned */
+    void Start(const WavetableSegment *segments, size_t count);
+
+    bool busy() const {
+        return step_ <= VectorWavetable::kNumLevels;
+    }
+
+    /*
+     * Do the next step. Returns the level that is now available from data(), or -1 if this step
+     * didn't finish one (or there's nothing to do).
+     */
+    int Step();
+
+    const int16_t *data() const {
+        return level_data_;
+    }
+
+private:
+    static constexpr size_t kTableSize = VectorWavetable::kTableSize;
+    static constexpr size_t kNumBins = kTableSize / 2 + 1;
+
+    WavetableSegment segments_[WAVETABLE_MAX_SEGMENTS];
+    size_t count_;
+    int step_;
+
+    float re_[kTableSize];
+    float im_[kTableSize];
+    float spectrum_re_[kNumBins];
+    float spectrum_im_[kNumBins];
+    float cos_[kTableSize / 2];
+    float sin_[kTableSize / 2];
+    int16_t level_data_[kTableSize + 1];
+
+    void Draw();
+    void FFT(float direction);
+};
+
+} // namespace HS
+
+#endif // HS_VECTOR_WAVETABLE_H
@@ -22,6 +22,9 @@
 #define WAVEFORM_MANAGER_H
 
 #include "waveform_library.h"
+#if defined(__IMXRT1062__) && defined(ARDUINO_TEENSY41)
+#include "HSVectorWavetable.h"
+#endif
 
 class WaveformManager {
 public:
@@ -215,4 +218,31 @@ public:
     }
 };
 
+#if defined(__IMXRT1062__) && defined(ARDUINO_TEENSY41)
+/* For the audio-rate vector oscillators in AudioSetup.cpp */
+size_t HS::GetWavetableSegments(uint8_t waveform_number, HS::WavetableSegment *segments) {
+    VOSegment *waveforms = HS::user_waveforms;
+    size_t size = HS::VO_SEGMENT_COUNT;
+    if (waveform_number >= 32) { // Library waveforms start at 32
+        waveform_number -= 32;
+        waveforms = HS::library_waveforms;
+        size = ARRAY_SIZE(HS::library_waveforms);
+    }
+
+    byte count = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        if (waveforms[i].IsTOC() && count++ == waveform_number) {
+            size_t n = 0;
+            while (n < waveforms[i].Segments() && n < HS::WAVETABLE_MAX_SEGMENTS && i + n + 1 < size) {
+                segments[n] = HS::WavetableSegment {waveforms[i + n + 1].level, waveforms[i + n + 1].time};
+                n++;
+            }
+            return n;
+        }
+    }
+    return 0;
+}
+#endif
+
 #endif // WAVEFORM_MANAGER_H
@@ -0,0 +1,129 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "AudioApplet.h"
+#include "audio_applets/AudioBitCrush.h"
+#include "audio_applets/AudioVCA.h"
+
+static const size_t kSampleRate = 44100;
+static const size_t kBlockSize = 128; // AUDIO_BLOCK_SAMPLES
+
+// Renders an applet the way AudioAppletSlot runs it, one block at a time, with
+// the mapped CV taken from cv(block) at the start of each block.
+template <typename CV>
+static std::vector<int16_t> Render(AudioApplet &applet, const std::vector<int16_t> &in, CV cv) {
+  std::vector<int16_t> out(in.size());
+  applet.Start();
+  for (size_t n = 0, block = 0; n < in.size(); n += kBlockSize, ++block) {
+    int values[AudioApplet::MAX_CV_CHANNELS] = {0};
+    values[8] = cv(block);
+    applet.SetCV(values, AudioApplet::MAX_CV_CHANNELS, 8);
+    applet.ProcessBlock(&in[n], &out[n], std::min(kBlockSize, in.size() - n));
+  }
+  return out;
+}
+
+static std::vector<int16_t> Sine(float freq, size_t length, float amplitude = 30000.0f) {
+  std::vector<int16_t> signal(length);
+  for (size_t n = 0; n < length; ++n)
+    signal[n] = static_cast<int16_t>(amplitude * sinf(2.0f * float(M_PI) * freq * n / kSampleRate));
+  return signal;
+}
+
+static void Put32(FILE *f, uint32_t v) { fwrite(&v, 4, 1, f); } // host is little-endian
+static void Put16(FILE *f, uint16_t v) { fwrite(&v, 2, 1, f); }
+
+// 16-bit mono WAV, for listening to what an applet does
+static bool WriteWav(const std::string &path, const std::vector<int16_t> &samples) {
+  FILE *f = fopen(path.c_str(), "wb");
+  if (!f) return false;
+  const uint32_t data_size = samples.size() * 2;
+  fwrite("RIFF", 1, 4, f); Put32(f, 36 + data_size); fwrite("WAVE", 1, 4, f);
+  fwrite("fmt ", 1, 4, f); Put32(f, 16); Put16(f, 1); Put16(f, 1);
+  Put32(f, kSampleRate); Put32(f, kSampleRate * 2); Put16(f, 2); Put16(f, 16);
+  fwrite("data", 1, 4, f); Put32(f, data_size);
+  fwrite(samples.data(), 2, samples.size(), f);
+  return fclose(f) == 0;
+}
+
+// CV sweeping from 0 to 6V over the length of the render
+static int Sweep(size_t block, size_t blocks) {
+  return AudioApplet::CV_FULL_SCALE * block / blocks;
+}
+
+TEST(AudioApplets, RenderWav) {
+  AudioVCA vca;
+  AudioBitCrush crush;
+  AudioApplet *applets[] = { &vca, &crush };
+  const auto in = Sine(220.0f, kSampleRate * 2);
+  const size_t blocks = in.size() / kBlockSize;
+
+  for (AudioApplet *applet : applets) {
+    auto out = Render(*applet, in, [blocks](size_t b) { return Sweep(b, blocks); });
+    std::string path = ::testing::TempDir() + "audio_applet_" + applet->applet_name() + ".wav";
+    ASSERT_TRUE(WriteWav(path, out)) << path;
+    FILE *f = fopen(path.c_str(), "rb");
+    ASSERT_NE(nullptr, f);
+    fseek(f, 0, SEEK_END);
+    EXPECT_EQ(44 + in.size() * 2, size_t(ftell(f)));
+    fclose(f);
+    remove(path.c_str());
+  }
+}
+
+TEST(AudioApplets, VCA) {
+  AudioVCA vca;
+  const auto in = Sine(440.0f, kSampleRate / 4);
+
+  auto closed = Render(vca, in, [](size_t) { return 0; });
+  for (auto s : closed) ASSERT_EQ(0, s);
+
+  // Fully open is unity, short of the last LSB, after the first block's ramp
+  auto open = Render(vca, in, [](size_t) { return AudioApplet::CV_FULL_SCALE; });
+  for (size_t n = kBlockSize; n < in.size(); ++n) ASSERT_NEAR(in[n], open[n], 1) << n;
+
+  // A step in CV turns into a ramp over one block, not a jump
+  const std::vector<int16_t> dc(kBlockSize * 8, 32767);
+  auto stepped = Render(vca, dc, [](size_t b) { return b < 4 ? 0 : AudioApplet::CV_FULL_SCALE; });
+  for (size_t n = 1; n < stepped.size(); ++n)
+    ASSERT_LE(std::abs(stepped[n] - stepped[n - 1]), 32767 / int(kBlockSize) + 2) << n;
+  EXPECT_GT(stepped.back(), 32700);
+}
+
+TEST(AudioApplets, BitCrush) {
+  AudioBitCrush crush;
+  const auto in = Sine(440.0f, kSampleRate / 4);
+
+  auto clean = Render(crush, in, [](size_t) { return 0; });
+  EXPECT_EQ(in, clean);
+
+  auto crushed = Render(crush, in, [](size_t) { return AudioApplet::CV_FULL_SCALE; });
+  size_t changes = 0;
+  for (size_t n = 0; n < crushed.size(); ++n) {
+    ASSERT_EQ(0, crushed[n] & 0x0fff) << n; // 4 bits
+    if (n && crushed[n] != crushed[n - 1]) ++changes;
+  }
+  EXPECT_LE(changes, crushed.size() / 16);
+}
+
+// Blocks per second on the host, for comparing applets
+TEST(AudioAppletsBenchmark, BlocksPerSecond) {
+  AudioVCA vca;
+  AudioBitCrush crush;
+  AudioApplet *applets[] = { &vca, &crush };
+  const auto in = Sine(220.0f, kSampleRate * 20);
+  const size_t blocks = in.size() / kBlockSize;
+
+  for (AudioApplet *applet : applets) {
+    auto start = std::chrono::steady_clock::now();
+    auto out = Render(*applet, in, [blocks](size_t b) { return Sweep(b, blocks); });
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double seconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() * 1e-9;
+    uint32_t checksum = 0;
+    for (auto s : out) checksum += s;
+    printf("%-6s %.0f blocks per second (checksum %u)\n", applet->applet_name(), blocks / seconds, checksum);
+  }
+}
@@ -0,0 +1,147 @@
+#include <chrono>
+#include <cstdio>
+#include "gtest/gtest.h"
+#include "peaks_bytebeat.h"
+#include "peaks_bytebeat_vm.h"
+
+static uint32_t Eval(const char *formula, uint32_t t, uint32_t p0 = 0, uint32_t p1 = 0, uint32_t p2 = 0, uint32_t pitch = 0) {
+  peaks::ByteBeatProgram program;
+  EXPECT_TRUE(program.Compile(formula)) << formula << " error at " << program.error_pos();
+  return program.Eval(t, p0, p1, p2, pitch);
+}
+
+TEST(ByteBeatCompiler, Precedence) {
+  EXPECT_EQ(7U, Eval("1+2*3", 0));
+  EXPECT_EQ(9U, Eval("(1+2)*3", 0));
+  EXPECT_EQ(1U << 5, Eval("1<<2+3", 0));
+  EXPECT_EQ((5U & 3U) | 8U, Eval("5&3|8", 0));
+  EXPECT_EQ(6U ^ (3U & 5U), Eval("6^3&5", 0));
+  EXPECT_EQ(7U - 2U - 1U, Eval("7-2-1", 0));
+  EXPECT_EQ(~5U + 1U, Eval("-5", 0));
+  EXPECT_EQ(~5U, Eval("~t", 5));
+  EXPECT_EQ(100U * 3U % 7U, Eval("t * p0 % p1", 100, 3, 7));
+  EXPECT_EQ(12345U, Eval("12345", 0));
+  EXPECT_EQ(0U, Eval("0", 42));
+  EXPECT_EQ(42U, Eval("t", 42));
+  EXPECT_EQ(3U * 200U, Eval("p2*pitch", 0, 0, 0, 3, 200));
+}
+
+TEST(ByteBeatCompiler, Semantics) {
+  EXPECT_EQ(0U, Eval("t/0", 42));
+  EXPECT_EQ(42U, Eval("t%p0", 42, 0));
+  EXPECT_EQ(0U, Eval("t<<32", 1));
+  EXPECT_EQ(0U, Eval("t>>p0", 0xffffffff, 40));
+  EXPECT_EQ(0xfffffffeU, Eval("t-2", 0));
+}
+
+TEST(ByteBeatCompiler, ConstantFolding) {
+  peaks::ByteBeatProgram program;
+  ASSERT_TRUE(program.Compile("(1+2)*(3<<4)-7"));
+  EXPECT_EQ(0U, program.num_instructions());
+  EXPECT_EQ(137U, program.Eval(0, 0, 0, 0, 0));
+
+  ASSERT_TRUE(program.Compile("t*(256>>2)"));
+  EXPECT_EQ(1U, program.num_instructions());
+}
+
+TEST(ByteBeatCompiler, Errors) {
+  peaks::ByteBeatProgram program;
+  EXPECT_FALSE(program.Compile("t*"));
+  EXPECT_EQ(2, program.error_pos());
+  EXPECT_FALSE(program.Compile("(t+1"));
+  EXPECT_EQ(4, program.error_pos());
+  EXPECT_FALSE(program.Compile("t $ 2"));
+  EXPECT_EQ(2, program.error_pos());
+  EXPECT_FALSE(program.Compile("t p0"));
+  EXPECT_EQ(2, program.error_pos());
+  EXPECT_FALSE(program.Compile(""));
+  // Failed programs evaluate to 0
+  EXPECT_EQ(0U, program.Eval(1, 2, 3, 4, 5));
+}
+
+TEST(ByteBeatCompiler, Limits) {
+  peaks::ByteBeatProgram program;
+  // Deep nesting runs out of temporaries rather than overflowing
+  std::string formula = "t";
+  for (int i = 0; i < 40; ++i)
+    formula = "t+(" + formula + ")";
+  EXPECT_FALSE(program.Compile(formula.c_str()));
+  EXPECT_EQ(0U, program.Eval(1, 2, 3, 4, 5));
+}
+
+// The built-in equations that only use unsigned arithmetic on t, written as
+// formulas.
+struct BuiltinEquation {
+  int index;
+  const char *formula;
+};
+
+static const BuiltinEquation kBuiltinEquations[] = {
+  { 0, "(t*pitch*3&t>>10|t*pitch*p0&t>>10|t*10&(t>>8)*p1&p2)&255" },
+  { 1, "(t*pitch*p0&t>>4|t*p2&t>>7|t*p1&t>>10)&255" },
+  { 5, "(t*pitch%p0>>2&p1)*(t>>(p2>>5))" },
+  { 12, "t*pitch>>7&t>>7|t>>8" },
+};
+
+static void Configure(peaks::ByteBeat &bytebeat, int equation) {
+  int32_t parameters[12] = {
+    equation << 12, 40000, 117 << 8, 201 << 8, 89 << 8,
+    0, 0, 0, 255, 255, 255, 3 << 8 };
+  bytebeat.Configure(parameters, false, false);
+}
+
+class ByteBeatEquationTest : public ::testing::TestWithParam<BuiltinEquation> { };
+
+TEST_P(ByteBeatEquationTest, MatchesBuiltin) {
+  peaks::ByteBeat native, vm;
+  peaks::ByteBeatProgram program;
+  ASSERT_TRUE(program.Compile(GetParam().formula));
+
+  native.Init();
+  vm.Init();
+  Configure(native, GetParam().index);
+  Configure(vm, GetParam().index);
+  vm.set_program(&program);
+
+  for (int i = 0; i < 200000; ++i) {
+    uint8_t control = (i % 50000) == 0 ? peaks::CONTROL_GATE_RISING : 0;
+    ASSERT_EQ(native.ProcessSingleSample(control), vm.ProcessSingleSample(control)) << "sample " << i;
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(Equations, ByteBeatEquationTest, ::testing::ValuesIn(kBuiltinEquations));
+
+TEST(ByteBeatBenchmark, VM) {
+  static const int kSamples = 1 << 22;
+
+  for (const auto &equation : kBuiltinEquations) {
+    peaks::ByteBeat bytebeat;
+    peaks::ByteBeatProgram program;
+    ASSERT_TRUE(program.Compile(equation.formula));
+
+    bytebeat.Init();
+    Configure(bytebeat, equation.index);
+    uint32_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kSamples; ++i)
+      checksum += bytebeat.ProcessSingleSample(0);
+    auto native_time = std::chrono::steady_clock::now() - start;
+
+    bytebeat.Init();
+    Configure(bytebeat, equation.index);
+    bytebeat.set_program(&program);
+    uint32_t vm_checksum = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kSamples; ++i)
+      vm_checksum += bytebeat.ProcessSingleSample(0);
+    auto vm_time = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(checksum, vm_checksum);
+    printf("Equation %2d: native %lld us, VM %lld us (%zu instructions) for %d samples\n",
+           equation.index,
+           (long long)std::chrono::duration_cast<std::chrono::microseconds>(native_time).count(),
+           (long long)std::chrono::duration_cast<std::chrono::microseconds>(vm_time).count(),
+           program.num_instructions(),
+           kSamples);
+  }
+}
@@ -0,0 +1,103 @@
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "HSCVTape.h"
+
+static std::vector<int16_t> RecordAll(HS::CVTape &tape, const std::vector<int16_t> &samples) {
+  std::vector<int16_t> recorded;
+  tape.StartRecording();
+  for (int16_t s : samples) {
+    if (!tape.Record(s)) break;
+    recorded.push_back(s);
+  }
+  tape.StopRecording();
+  return recorded;
+}
+
+// A gesture: wandering, held, and jumping between extremes
+static std::vector<int16_t> Gesture(size_t length) {
+  std::mt19937 rng(0xc7);
+  std::vector<int16_t> samples;
+  int32_t value = 0;
+  while (samples.size() < length) {
+    switch (rng() % 4) {
+    case 0: // hold
+      for (int i = rng() % 100; i > 0; --i) samples.push_back(value);
+      break;
+    case 1: // slow drift
+    case 2:
+      for (int i = rng() % 200; i > 0; --i) {
+        value += int32_t(rng() % 61) - 30;
+        value = value < -32768 ? -32768 : (value > 32767 ? 32767 : value);
+        samples.push_back(value);
+      }
+      break;
+    default: // jump
+      value = (rng() & 1) ? int32_t(rng() % 65536) - 32768 : ((rng() & 1) ? 32767 : -32768);
+      samples.push_back(value);
+    }
+  }
+  samples.resize(length);
+  return samples;
+}
+
+TEST(CVTape, RoundTrip) {
+  std::vector<uint8_t> mem(64 * 1024);
+  HS::CVTape tape;
+  tape.Init(mem.data(), mem.size());
+
+  const auto samples = Gesture(40000);
+  ASSERT_EQ(samples, RecordAll(tape, samples));
+  EXPECT_EQ(samples.size(), tape.length());
+  EXPECT_LT(tape.used(), samples.size()); // compressed
+  EXPECT_EQ(tape.capacity() - tape.used(), tape.remaining());
+
+  // Twice round, to check the loop back to the start
+  for (int pass = 0; pass < 2; ++pass)
+    for (size_t n = 0; n < samples.size(); ++n)
+      ASSERT_EQ(samples[n], tape.Next()) << "pass " << pass << " sample " << n;
+}
+
+TEST(CVTape, EveryCode) {
+  std::vector<uint8_t> mem(1024);
+  HS::CVTape tape;
+  tape.Init(mem.data(), mem.size());
+
+  const std::vector<int16_t> samples = {
+    0, 0, 63, -1, -65, 8126, -66, 32767, -32768, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, -8192, 0
+  };
+  ASSERT_EQ(samples, RecordAll(tape, samples));
+  for (size_t n = 0; n < samples.size(); ++n) ASSERT_EQ(samples[n], tape.Next()) << n;
+}
+
+// Filling up stops the recording, with what was recorded intact, and without writing past the end
+TEST(CVTape, Full) {
+  std::vector<uint8_t> mem(1000 + 16, 0xaa);
+  HS::CVTape tape;
+  tape.Init(mem.data(), 1000);
+
+  std::vector<int16_t> samples;
+  for (int i = 0; i < 1000; ++i) samples.push_back((i & 1) ? 32767 : -32768); // 3 bytes each
+  auto recorded = RecordAll(tape, samples);
+  EXPECT_FALSE(tape.recording());
+  EXPECT_LT(recorded.size(), samples.size());
+  EXPECT_GE(tape.used() + HS::CVTape::WORST_CASE_BYTES, tape.capacity());
+  EXPECT_LE(tape.used(), tape.capacity());
+  for (size_t n = 1000; n < mem.size(); ++n) ASSERT_EQ(0xaa, mem[n]);
+  for (size_t n = 0; n < recorded.size(); ++n) ASSERT_EQ(recorded[n], tape.Next()) << n;
+
+  EXPECT_FALSE(tape.Record(0));
+}
+
+TEST(CVTape, Empty) {
+  uint8_t mem[16];
+  HS::CVTape tape;
+  tape.Init(mem, sizeof(mem));
+  EXPECT_EQ(0, tape.Next());
+  tape.StartRecording();
+  EXPECT_EQ(0, tape.Next()); // nothing to play while recording
+  tape.StopRecording();
+  EXPECT_EQ(0u, tape.length());
+  EXPECT_EQ(0, tape.Next());
+}
@@ -0,0 +1,208 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include "gtest/gtest.h"
+#include "peaks_multistage_envelope.h"
+
+static const size_t kNumChannels = peaks::MultistageEnvelopeBank::kNumChannels;
+
+// Enough of EnvelopeGenerator::Configure() to set up an envelope the way
+// APP_ENVGEN does.
+struct EnvelopeParams {
+  int type;
+  uint16_t seg[4];
+  uint16_t amplitude;
+  bool amplitude_sampled;
+  peaks::EnvResetBehaviour attack_reset, decay_release_reset;
+  peaks::EnvFallingGateBehaviour falling_gate;
+  peaks::EnvelopeShape attack_shape, decay_shape, release_shape;
+  uint16_t attack_mult, decay_mult, release_mult;
+  uint16_t max_loops;
+
+  void Randomize(std::mt19937 &rng) {
+    type = rng() % 11;
+    for (auto &s : seg) s = rng() % 4 ? rng() % 65536 : rng() % 2048;
+    amplitude = rng() % 3 ? 65535 : rng() % 65536;
+    amplitude_sampled = rng() % 2;
+    attack_reset = static_cast<peaks::EnvResetBehaviour>(rng() % peaks::RESET_BEHAVIOUR_LAST);
+    decay_release_reset = static_cast<peaks::EnvResetBehaviour>(rng() % peaks::RESET_BEHAVIOUR_LAST);
+    falling_gate = static_cast<peaks::EnvFallingGateBehaviour>(rng() % peaks::FALLING_GATE_BEHAVIOUR_LAST);
+    attack_shape = static_cast<peaks::EnvelopeShape>(rng() % peaks::ENV_SHAPE_LAST);
+    decay_shape = static_cast<peaks::EnvelopeShape>(rng() % peaks::ENV_SHAPE_LAST);
+    release_shape = static_cast<peaks::EnvelopeShape>(rng() % peaks::ENV_SHAPE_LAST);
+    attack_mult = rng() % 4;
+    decay_mult = rng() % 4;
+    release_mult = rng() % 4;
+    max_loops = rng() % 3 ? 0 : rng() % 65536;
+  }
+
+  // Small change, like a CV moving a segment time or the amplitude
+  void Nudge(std::mt19937 &rng) {
+    seg[rng() % 4] += rng() % 512;
+    if (rng() % 4 == 0) amplitude -= rng() % 256;
+  }
+
+  void Apply(peaks::MultistageEnvelope &env, int &last_type) const {
+    env.set_attack_shape(attack_shape);
+    env.set_decay_shape(decay_shape);
+    env.set_release_shape(release_shape);
+    env.set_attack_time_multiplier(attack_mult);
+    env.set_decay_time_multiplier(decay_mult);
+    env.set_release_time_multiplier(release_mult);
+    switch (type) {
+      case 0: env.set_ad(seg[0], seg[1], 0, 0); break;
+      case 1: env.set_adsr(seg[0], seg[1], seg[2] >> 1, seg[3]); break;
+      case 2: env.set_adr(seg[0], seg[1], seg[2] >> 1, seg[3], 0, 0); break;
+      case 3: env.set_ar(seg[0], seg[1]); break;
+      case 4: env.set_adsar(seg[0], seg[1], seg[2] >> 1, seg[3]); break;
+      case 5: env.set_adar(seg[0], seg[1], seg[2] >> 1, seg[3], 0, 0); break;
+      case 6: env.set_ad(seg[0], seg[1], 0, 2); break;
+      case 7: env.set_adr(seg[0], seg[1], seg[2] >> 1, seg[3], 0, 3); break;
+      case 8: env.set_adr(seg[0], seg[1], seg[2] >> 1, seg[3], 0, 2); break;
+      case 9: env.set_adar(seg[0], seg[1], seg[2] >> 1, seg[3], 0, 4); break;
+      default: env.set_adar(seg[0], seg[1], seg[2] >> 1, seg[3], 1, 3); break;
+    }
+    env.set_amplitude(amplitude, amplitude_sampled);
+    if (type != last_type) {
+      last_type = type;
+      env.reset();
+    }
+    env.set_attack_reset_behaviour(attack_reset);
+    env.set_attack_falling_gate_behaviour(falling_gate);
+    env.set_decay_release_reset_behaviour(decay_release_reset);
+    env.set_max_loops(max_loops);
+  }
+};
+
+// Gate with random length and spacing, as peaks control flags
+struct GateSource {
+  bool high = false;
+  int ticks_left = 0;
+
+  uint8_t Next(std::mt19937 &rng, int max_ticks) {
+    uint8_t control = 0;
+    if (ticks_left-- <= 0) {
+      high = !high;
+      ticks_left = 1 + rng() % max_ticks;
+      control |= high ? peaks::CONTROL_GATE_RISING : peaks::CONTROL_GATE_FALLING;
+    }
+    if (high) control |= peaks::CONTROL_GATE;
+    return control;
+  }
+};
+
+struct EnvelopeSet {
+  peaks::MultistageEnvelope env[kNumChannels];
+  int last_type[kNumChannels];
+
+  // On the module the envelopes are globals, so settings never set are 0
+  void Init() {
+    memset(static_cast<void *>(env), 0, sizeof(env));
+    for (size_t c = 0; c < kNumChannels; ++c) {
+      env[c].Init();
+      last_type[c] = -1;
+    }
+  }
+};
+
+TEST(MultistageEnvelopeBank, MatchesProcessSingleSample) {
+  std::mt19937 rng(0xe57e);
+  for (int run = 0; run < 60; ++run) {
+    EnvelopeSet reference, batched;
+    peaks::MultistageEnvelopeBank bank;
+    reference.Init();
+    batched.Init();
+    for (size_t c = 0; c < kNumChannels; ++c)
+      bank.Bind(c, &batched.env[c]);
+
+    EnvelopeParams params[kNumChannels];
+    GateSource gates[kNumChannels];
+    for (auto &p : params) p.Randomize(rng);
+    const int max_gate = run % 3 ? 2000 : 20;
+
+    // The reference is set up every tick, the bank only when something changes
+    for (int tick = 0; tick < 30000; ++tick) {
+      uint8_t control[kNumChannels];
+      uint16_t out[kNumChannels];
+      for (size_t c = 0; c < kNumChannels; ++c) {
+        bool changed = tick == 0;
+        if (rng() % 5000 == 0) {
+          params[c].Randomize(rng);
+          changed = true;
+        } else if (rng() % 300 == 0) {
+          params[c].Nudge(rng);
+          changed = true;
+        }
+        control[c] = gates[c].Next(rng, max_gate);
+        params[c].Apply(reference.env[c], reference.last_type[c]);
+        if (changed) {
+          params[c].Apply(batched.env[c], batched.last_type[c]);
+          bank.Configure(c);
+        }
+      }
+      bank.Process(control, out);
+      for (size_t c = 0; c < kNumChannels; ++c) {
+        ASSERT_EQ(reference.env[c].ProcessSingleSample(control[c]), out[c])
+          << "run " << run << " tick " << tick << " channel " << c;
+        ASSERT_EQ(reference.env[c].get_state_mask(), batched.env[c].get_state_mask())
+          << "run " << run << " tick " << tick << " channel " << c;
+      }
+    }
+  }
+}
+
+// The four channels of APP_ENVGEN with fixed settings, set up every tick for
+// ProcessSingleSample() as the ISR used to, and once for the bank. Most of the
+// time most envelopes are finished or sustaining.
+TEST(MultistageEnvelopeBankBenchmark, QuadEnvelope) {
+  static const int kTicks = 2000000;
+  std::mt19937 rng(0xbe4c);
+  EnvelopeParams params[kNumChannels];
+  for (auto &p : params) {
+    p.Randomize(rng);
+    p.type = 1;
+  }
+
+  // Same gates for both
+  static uint8_t controls[kTicks][kNumChannels];
+  GateSource gates[kNumChannels];
+  for (int tick = 0; tick < kTicks; ++tick)
+    for (size_t c = 0; c < kNumChannels; ++c)
+      controls[tick][c] = gates[c].Next(rng, 20000);
+
+  EnvelopeSet reference;
+  reference.Init();
+  uint32_t checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int tick = 0; tick < kTicks; ++tick) {
+    for (size_t c = 0; c < kNumChannels; ++c) {
+      params[c].Apply(reference.env[c], reference.last_type[c]);
+      checksum += reference.env[c].ProcessSingleSample(controls[tick][c]);
+    }
+  }
+  auto single_time = std::chrono::steady_clock::now() - start;
+
+  EnvelopeSet batched;
+  peaks::MultistageEnvelopeBank bank;
+  batched.Init();
+  for (size_t c = 0; c < kNumChannels; ++c)
+    bank.Bind(c, &batched.env[c]);
+  uint32_t bank_checksum = 0;
+  for (size_t c = 0; c < kNumChannels; ++c) {
+    params[c].Apply(batched.env[c], batched.last_type[c]);
+    bank.Configure(c);
+  }
+  start = std::chrono::steady_clock::now();
+  for (int tick = 0; tick < kTicks; ++tick) {
+    uint16_t out[kNumChannels];
+    bank.Process(controls[tick], out);
+    for (size_t c = 0; c < kNumChannels; ++c) bank_checksum += out[c];
+  }
+  auto bank_time = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(checksum, bank_checksum);
+  printf("ProcessSingleSample: %.1f ns per tick, MultistageEnvelopeBank: %.1f ns per tick\n",
+         std::chrono::duration_cast<std::chrono::nanoseconds>(single_time).count() / double(kTicks),
+         std::chrono::duration_cast<std::chrono::nanoseconds>(bank_time).count() / double(kTicks));
+}
@@ -0,0 +1,124 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include "gtest/gtest.h"
+#include "HSEnvelopeDetector.h"
+
+typedef HS::EnvelopeDetector<128> Detector;
+
+// First sample at which the envelope has reached target, or -1
+template <typename F>
+static int SamplesUntil(Detector &detector, int32_t input, int limit, F reached) {
+  for (int n = 1; n <= limit; ++n)
+    if (reached(detector.Process(input))) return n;
+  return -1;
+}
+
+TEST(EnvelopeDetector, Sqrt) {
+  std::mt19937 rng(0x5a7);
+  for (int i = 0; i < 100000; ++i) {
+    uint32_t n = (i < 1000) ? i : rng();
+    const int32_t root = int32_t(std::floor(std::sqrt(double(n))));
+    EXPECT_EQ(root, Detector::Sqrt(n)) << n;
+    EXPECT_EQ(root, Detector::SqrtNear(n, rng() % 70000)) << n;
+  }
+  EXPECT_EQ(65535, Detector::Sqrt(0xffffffff));
+  EXPECT_EQ(65535, Detector::SqrtNear(0xffffffff, 1));
+}
+
+// Attack and release reach 1 - 1/e of a step in their time constants
+TEST(EnvelopeDetector, PeakResponseTimes) {
+  static const float kAttack = 100.0f, kRelease = 1000.0f;
+  Detector detector;
+  detector.Init();
+  detector.set_mode(Detector::PEAK);
+  detector.set_attack(kAttack);
+  detector.set_release(kRelease);
+
+  int attack = SamplesUntil(detector, 10000, 10000, [](int32_t v) { return v >= 6321; });
+  EXPECT_NEAR(kAttack, attack, kAttack * 0.02f);
+  SamplesUntil(detector, 10000, 10000, [](int32_t v) { return v >= 10000 - 1; });
+
+  int release = SamplesUntil(detector, 0, 100000, [](int32_t v) { return v <= 3679; });
+  EXPECT_NEAR(kRelease, release, kRelease * 0.02f);
+  printf("Peak: attack %d samples for %g, release %d for %g\n", attack, kAttack, release, kRelease);
+}
+
+TEST(EnvelopeDetector, PeakHold) {
+  Detector detector;
+  detector.Init();
+  detector.set_attack(0.0f);
+  detector.set_release(10.0f);
+  detector.set_hold(500);
+  EXPECT_EQ(8000, detector.Process(-8000)); // instant attack, either polarity
+  for (int n = 0; n < 500; ++n) ASSERT_EQ(8000, detector.Process(0)) << n;
+  EXPECT_LT(detector.Process(0), 8000);
+}
+
+TEST(EnvelopeDetector, RMS) {
+  Detector detector;
+  detector.Init();
+  detector.set_mode(Detector::RMS);
+  detector.set_attack(0.0f);
+  detector.set_release(0.0f);
+
+  // DC fills the window in window_size samples
+  for (int n = 0; n < 64; ++n) detector.Process(1000);
+  EXPECT_NEAR(707, detector.value(), 1); // half the window
+  for (int n = 0; n < 64; ++n) detector.Process(1000);
+  EXPECT_EQ(1000, detector.value());
+
+  // A sine's RMS is its amplitude / sqrt(2), once the window holds whole cycles
+  for (int n = 0; n < 128 * 4; ++n) detector.Process(int32_t(20000 * sin(2 * M_PI * n / 32)));
+  EXPECT_NEAR(20000 / sqrt(2.0), detector.value(), 20000 * 0.005);
+
+  // and it doesn't ripple with the cycle, unlike a peak follower
+  int lo = 32767, hi = 0;
+  for (int n = 0; n < 128; ++n) {
+    int v = detector.Process(int32_t(20000 * sin(2 * M_PI * n / 32)));
+    lo = std::min(lo, v);
+    hi = std::max(hi, v);
+  }
+  EXPECT_LE(hi - lo, 2);
+}
+
+// RMS with smoothing reaches its level in about the attack time plus the window
+TEST(EnvelopeDetector, RMSResponseTime) {
+  Detector detector;
+  detector.Init();
+  detector.set_mode(Detector::RMS);
+  detector.set_attack(200.0f);
+  detector.set_release(2000.0f);
+  int attack = SamplesUntil(detector, 10000, 10000, [](int32_t v) { return v >= 6321; });
+  EXPECT_GT(attack, 200);
+  EXPECT_LT(attack, 200 + 128);
+  SamplesUntil(detector, 10000, 20000, [](int32_t v) { return v >= 9999; });
+  int release = SamplesUntil(detector, 0, 100000, [](int32_t v) { return v <= 3679; });
+  EXPECT_GT(release, 2000);
+  EXPECT_LT(release, 2000 + 128);
+  printf("RMS: attack %d samples for 200 + window, release %d for 2000 + window\n", attack, release);
+}
+
+// Time per sample, on the host
+TEST(EnvelopeDetectorBenchmark, CostPerSample) {
+  static const int kSamples = 10000000;
+  std::vector<int16_t> input(4096);
+  std::mt19937 rng(0xbe);
+  for (auto &s : input) s = int16_t(rng());
+
+  for (int mode = 0; mode < 2; ++mode) {
+    Detector detector;
+    detector.Init();
+    detector.set_mode(mode ? Detector::RMS : Detector::PEAK);
+    detector.set_attack(50.0f);
+    detector.set_release(2000.0f);
+
+    int64_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < kSamples; ++n) checksum += detector.Process(input[n & 4095]);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / double(kSamples);
+    printf("%-4s %.2f ns per sample (checksum %lld)\n", mode ? "RMS" : "Peak", ns, (long long)checksum);
+  }
+}
@@ -0,0 +1,155 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include "gtest/gtest.h"
+#include "HSLifeBoard.h"
+
+// GameOfLife::ProcessGameBoard() from before HS::LifeBoard: a 64x40 toroid in
+// two 32-bit halves per row, one cell at a time.
+class ReferenceLife {
+public:
+  uint64_t board[80];
+  int global_density;
+  int local_density;
+
+  void Clear() { memset(board, 0, sizeof(board)); }
+
+  void AddToBoard(int x, int y) {
+    int i = y * 2;
+    if (x > 31) {
+      i += 1;
+      x -= 32;
+    }
+    board[i] |= uint64_t(1) << x;
+  }
+
+  bool ValueAtCell(int x, int y) const {
+    if (x > 63) x -= 64;
+    if (x < 0) x += 64;
+    if (y > 39) y -= 40;
+    if (y < 0) y += 40;
+    int i = y * 2;
+    if (x > 31) {
+      i += 1;
+      x -= 32;
+    }
+    return (board[i] >> x) & 0x01;
+  }
+
+  int CountLiveNeighborsAt(int x, int y) const {
+    int count = 0;
+    for (int nx = -1; nx < 2; nx++)
+      for (int ny = -1; ny < 2; ny++)
+        if (!(nx == 0 && ny == 0)) count += ValueAtCell(x + nx, y + ny);
+    return count;
+  }
+
+  void ProcessGameBoard(int tx, int ty) {
+    uint64_t next_gen[80] = {0};
+    global_density = 0;
+    local_density = 0;
+    for (int y = 0; y < 40; y++) {
+      for (int x = 0; x < 64; x++) {
+        bool live = ValueAtCell(x, y);
+        int ln = CountLiveNeighborsAt(x, y);
+        if (((ln == 2 || ln == 3) && live) || (ln == 3 && !live)) {
+          int i = y * 2 + (x > 31);
+          next_gen[i] |= uint64_t(1) << (x & 31);
+          global_density++;
+          if (abs(tx - x) < 8 && abs(ty - y) < 8) local_density++;
+        }
+      }
+    }
+    memcpy(board, next_gen, sizeof(next_gen));
+  }
+};
+
+static void Randomize(std::mt19937 &rng, ReferenceLife &reference, HS::LifeBoard &board, int percent) {
+  for (int y = 0; y < 40; y++)
+    for (int x = 0; x < 64; x++)
+      if (int(rng() % 100) < percent) {
+        reference.AddToBoard(x, y);
+        board.Set(x, y);
+      }
+}
+
+TEST(LifeBoard, MatchesCellByCell) {
+  std::mt19937 rng(0x11fe);
+  for (int run = 0; run < 20; ++run) {
+    ReferenceLife reference;
+    HS::LifeBoard board;
+    reference.Clear();
+    board.Init(40, true);
+    Randomize(rng, reference, board, 10 + run * 2);
+
+    for (int gen = 0; gen < 200; ++gen) {
+      int tx = rng() % 64, ty = rng() % 40;
+      reference.ProcessGameBoard(tx, ty);
+      ASSERT_EQ(reference.global_density, board.Step()) << "run " << run << " gen " << gen;
+      ASSERT_EQ(reference.local_density, board.CountIn(tx - 7, ty - 7, tx + 7, ty + 7))
+        << "run " << run << " gen " << gen;
+      for (int y = 0; y < 40; y++)
+        for (int x = 0; x < 64; x++)
+          ASSERT_EQ(reference.ValueAtCell(x, y), board.Get(x, y))
+            << "run " << run << " gen " << gen << " at " << x << "," << y;
+      if (gen % 50 == 49) Randomize(rng, reference, board, 5); // the Draw gate
+    }
+  }
+}
+
+// A glider crossing an edge wraps on a toroid, and dies against a flat edge
+TEST(LifeBoard, Edges) {
+  for (int toroid = 0; toroid < 2; ++toroid) {
+    HS::LifeBoard board;
+    board.Init(80, toroid);
+    // Heading towards +x, +y
+    board.Set(61, 76);
+    board.Set(62, 77);
+    board.Set(60, 78);
+    board.Set(61, 78);
+    board.Set(62, 78);
+    int live = 5;
+    for (int gen = 0; gen < 40; ++gen) live = board.Step();
+    if (toroid)
+      EXPECT_EQ(5, live);
+    else
+      EXPECT_NE(5, live);
+  }
+}
+
+// Generations per second at the applet's usual density
+TEST(LifeBoardBenchmark, GenerationsPerSecond) {
+  static const int kGenerations = 2000;
+  std::mt19937 rng(0xbe4c);
+  ReferenceLife reference;
+  HS::LifeBoard board;
+  reference.Clear();
+  board.Init(40, true);
+  Randomize(rng, reference, board, 30);
+
+  auto start = std::chrono::steady_clock::now();
+  int reference_live = 0;
+  for (int gen = 0; gen < kGenerations; ++gen) {
+    reference.ProcessGameBoard(32, 20);
+    reference_live += reference.global_density;
+  }
+  auto reference_time = std::chrono::steady_clock::now() - start;
+
+  static const int kBoardGenerations = kGenerations * 100;
+  int live = 0;
+  start = std::chrono::steady_clock::now();
+  for (int gen = 0; gen < kBoardGenerations; ++gen) {
+    live += board.Step();
+    if (gen + 1 == kGenerations) {
+      EXPECT_EQ(reference_live, live);
+    }
+  }
+  auto board_time = std::chrono::steady_clock::now() - start;
+
+  auto per_second = [](int generations, std::chrono::steady_clock::duration elapsed) {
+    return generations / (std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() * 1e-9);
+  };
+  printf("Cell by cell: %.0f generations per second, LifeBoard: %.0f generations per second\n",
+         per_second(kGenerations, reference_time), per_second(kBoardGenerations, board_time));
+}
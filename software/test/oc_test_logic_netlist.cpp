@@ -0,0 +1,202 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include "gtest/gtest.h"
+#include "HSLogicNetlist.h"
+
+typedef HS::LogicGateSpec Spec;
+
+// The Neural Network app's LogicGate::Calculate(), gate by gate, on a state word laid out
+// like the netlist's
+struct ReferenceGate {
+  Spec spec;
+  bool state = 0;
+  bool clocked = 0;
+
+  bool Calculate(uint64_t source_state) {
+    const bool v1 = (source_state >> spec.source[0]) & 1;
+    const bool v2 = (source_state >> spec.source[1]) & 1;
+    const bool v3 = (source_state >> spec.source[2]) & 1;
+    switch (spec.type) {
+      case Spec::NOT: state = !v1; break;
+      case Spec::AND: state = v1 & v2; break;
+      case Spec::OR: state = v1 | v2; break;
+      case Spec::XOR: state = v1 != v2; break;
+      case Spec::NAND: state = !(v1 & v2); break;
+      case Spec::NOR: state = !(v1 | v2); break;
+      case Spec::XNOR: state = !(v1 != v2); break;
+      case Spec::D_FLIPFLOP: if (Edge(v2)) state = v1; break;
+      case Spec::T_FLIPFLOP: if (Edge(v2) && v1) state = !state; break;
+      case Spec::LATCH:
+        if (v1) state = 0;
+        if (v2) state = 1;
+        break;
+      case Spec::TL_NEURON:
+        state = (v1 * spec.weight[0] + v2 * spec.weight[1] + v3 * spec.weight[2]) > spec.threshold;
+        break;
+      default: state = 0;
+    }
+    return state;
+  }
+
+  bool Edge(bool clock) {
+    const bool edge = clock && !clocked;
+    clocked = clock;
+    return edge;
+  }
+};
+
+template <int gates>
+struct ReferenceNetwork {
+  static constexpr int GATE_BIT = HS::LogicNetlist<gates>::GATE_BIT;
+  ReferenceGate gate[gates];
+  uint64_t source_state = 0;
+
+  uint64_t Tick(uint8_t inputs) {
+    uint64_t s = (source_state & ~uint64_t(0xff)) | inputs | (uint64_t(1) << HS::LogicNetlist<gates>::ON_BIT);
+    for (int g = 0; g < gates; ++g) {
+      const bool set = gate[g].Calculate(s);
+      s = (s & ~(uint64_t(1) << (GATE_BIT + g))) | (uint64_t(set) << (GATE_BIT + g));
+    }
+    return source_state = s;
+  }
+};
+
+// Any gate type, reading inputs, any gate (before or after it), ON or OFF
+template <int gates>
+static void RandomSpecs(Spec *spec, std::mt19937 &rng) {
+  typedef HS::LogicNetlist<gates> Netlist;
+  for (int g = 0; g < gates; ++g) {
+    spec[g].type = rng() % Spec::TYPE_COUNT;
+    for (int s = 0; s < 3; ++s) {
+      const int pick = rng() % (Netlist::INPUTS + gates + 2);
+      spec[g].source[s] = pick < Netlist::INPUTS + gates ? pick
+                        : (pick == Netlist::INPUTS + gates ? Netlist::ON_BIT : Netlist::OFF_BIT);
+      spec[g].weight[s] = int(rng() % 19) - 9;
+    }
+    spec[g].threshold = int(rng() % 55) - 27;
+  }
+}
+
+template <int gates>
+static void CompareWithReference(uint32_t seed) {
+  std::mt19937 rng(seed);
+  Spec spec[gates];
+  RandomSpecs<gates>(spec, rng);
+
+  HS::LogicNetlist<gates> netlist;
+  netlist.Compile(spec);
+  ReferenceNetwork<gates> reference;
+  for (int g = 0; g < gates; ++g) reference.gate[g].spec = spec[g];
+
+  // Inputs that change only sometimes, so clocks have edges and levels
+  uint8_t inputs = 0;
+  for (int tick = 0; tick < 2000; ++tick) {
+    if (rng() % 4 == 0) inputs ^= 1 << (rng() % 8);
+    const uint64_t expected = reference.Tick(inputs);
+    const uint64_t actual = netlist.Tick(inputs);
+    ASSERT_EQ(expected, actual) << "seed " << seed << " tick " << tick;
+  }
+}
+
+TEST(LogicNetlist, MatchesLogicGate) {
+  for (uint32_t seed = 1; seed <= 50; ++seed) {
+    CompareWithReference<6>(seed);
+    CompareWithReference<32>(seed);
+  }
+}
+
+TEST(LogicNetlist, EveryTypeAndTable) {
+  // A few known rows, a | b << 1 | c << 2 | q << 3 | edge << 4
+  Spec spec = {};
+  spec.type = Spec::AND;
+  EXPECT_EQ(0x88888888u, spec.TruthTable());
+  spec.type = Spec::NOT;
+  EXPECT_EQ(0x55555555u, spec.TruthTable());
+  spec.type = Spec::D_FLIPFLOP;
+  EXPECT_EQ(0xaaaaff00u, spec.TruthTable());
+  spec.type = Spec::NONE;
+  EXPECT_EQ(0u, spec.TruthTable());
+}
+
+// Evaluated in order, a flip-flop reading a later one sees last tick's value: a shift register
+TEST(LogicNetlist, ShiftRegister) {
+  typedef HS::LogicNetlist<6> Netlist;
+  Spec spec[6] = {};
+  for (int g = 0; g < 4; ++g) {
+    spec[g].type = Spec::D_FLIPFLOP;
+    spec[g].source[0] = g < 3 ? Netlist::GATE_BIT + g + 1 : 0; // data from the next one, or Dig1
+    spec[g].source[1] = 1; // clock on Dig2
+  }
+  Netlist netlist;
+  netlist.Compile(spec);
+
+  const int data[] = {1, 0, 1, 1, 0, 0};
+  int shifted = 0;
+  for (int step = 0; step < 6; ++step) {
+    netlist.Tick(data[step]);
+    netlist.Tick(data[step] | 2); // clock
+    shifted = (shifted >> 1) | (data[step] << 3);
+    for (int g = 0; g < 4; ++g) EXPECT_EQ((shifted >> g) & 1, netlist.gate(g)) << step;
+  }
+}
+
+// Changing a gate's type starts it from 0, and empty gates aren't evaluated
+TEST(LogicNetlist, Recompile) {
+  typedef HS::LogicNetlist<6> Netlist;
+  Spec spec[6] = {};
+  spec[0].type = Spec::LATCH;
+  spec[0].source[0] = Netlist::OFF_BIT;
+  spec[0].source[1] = 0;
+  Netlist netlist;
+  netlist.Compile(spec);
+  EXPECT_EQ(1, netlist.ops());
+  netlist.Tick(1);
+  netlist.Tick(0);
+  EXPECT_TRUE(netlist.gate(0));
+
+  spec[0].type = Spec::D_FLIPFLOP;
+  netlist.Compile(spec, 1u << 0);
+  netlist.Tick(0);
+  EXPECT_FALSE(netlist.gate(0));
+
+  spec[0].type = Spec::NONE;
+  spec[1].type = Spec::NOT;
+  spec[1].source[0] = Netlist::OFF_BIT;
+  netlist.Compile(spec);
+  netlist.Tick(0);
+  EXPECT_EQ(1, netlist.ops());
+  EXPECT_FALSE(netlist.gate(0));
+  EXPECT_TRUE(netlist.gate(1));
+}
+
+template <typename Network>
+static double TimePerTick(Network &network, const char *name, int gates) {
+  static const int kTicks = 1 << 20;
+  uint64_t sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kTicks; ++i) sink += network.Tick(uint8_t(i * 37 >> 4));
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  const double ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / double(kTicks);
+  printf("%-10s %2d gates: %.1f ns per tick (%llu)\n", name, gates, ns, (unsigned long long)(sink & 1));
+  return ns;
+}
+
+template <int gates>
+static void Benchmark() {
+  std::mt19937 rng(0xbe);
+  Spec spec[gates];
+  RandomSpecs<gates>(spec, rng);
+  HS::LogicNetlist<gates> netlist;
+  netlist.Compile(spec);
+  ReferenceNetwork<gates> reference;
+  for (int g = 0; g < gates; ++g) reference.gate[g].spec = spec[g];
+  TimePerTick(reference, "LogicGate", gates);
+  TimePerTick(netlist, "Netlist", gates);
+}
+
+TEST(LogicNetlistBenchmark, CostPerTick) {
+  Benchmark<6>();
+  Benchmark<16>();
+  Benchmark<32>();
+}
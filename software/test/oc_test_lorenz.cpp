@@ -0,0 +1,211 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include "gtest/gtest.h"
+#include "streams_lorenz_generator.h"
+#include "streams_resources.h"
+
+// The forward Euler Process() from before the integrators were added, reduced
+// to the state and the scaled outputs.
+class ReferenceLorenz {
+public:
+  int32_t scaled[12];
+
+  void Init(uint8_t index) {
+    if (index) {
+      Lx2_ = 0.1 * (1 << 24); Ly2_ = 0; Lz2_ = 0;
+      Rx2_ = 0.1 * (1 << 24); Ry2_ = 0; Rz2_ = 0;
+    } else {
+      Lx1_ = 0.1 * (1 << 24); Ly1_ = 0; Lz1_ = 0;
+      Rx1_ = 0.1 * (1 << 24); Ry1_ = 0; Rz1_ = 0;
+    }
+  }
+
+  void set_rho1(int16_t rho) {
+    rho1_ = (rho * (1 << 13)) + 24.0 * (1 << 24);
+    c1_ = (rho + (6 << 3)) * (1 << 13);
+  }
+
+  void set_rho2(int16_t rho) {
+    rho2_ = (rho * (1 << 13)) + 24.0 * (1 << 24);
+    c2_ = (rho + (6 << 3)) * (1 << 13);
+  }
+
+  void Process(int32_t freq1, int32_t freq2, bool reset1, bool reset2, uint8_t freq_range1, uint8_t freq_range2) {
+    const int64_t sigma = 10.0 * (1 << 24);
+    const int64_t beta = 8.0 / 3.0 * (1 << 24);
+    const int64_t a = 0.1 * (1 << 24);
+    const int64_t b = 0.1 * (1 << 24);
+
+    int32_t rate1 = (freq1 >> 8);
+    if (rate1 < 0) rate1 = 0;
+    if (rate1 > 255) rate1 = 255;
+    int32_t rate2 = (freq2 >> 8);
+    if (rate2 < 0) rate2 = 0;
+    if (rate2 > 255) rate2 = 255;
+
+    if (reset1) Init(0);
+    if (reset2) Init(1);
+
+    int64_t Ldt1 = static_cast<int64_t>(streams::lut_lorenz_rate[rate1] >> (5 - freq_range1));
+    int32_t Lx1 = Lx1_ + (Ldt1 * ((sigma * (Ly1_ - Lx1_)) >> 24) >> 24);
+    int32_t Ly1 = Ly1_ + (Ldt1 * ((Lx1_ * (rho1_ - Lz1_) >> 24) - Ly1_) >> 24);
+    int32_t Lz1 = Lz1_ + (Ldt1 * ((Lx1_ * int64_t(Ly1_) >> 24) - (beta * Lz1_ >> 24)) >> 24);
+    Lx1_ = Lx1; Ly1_ = Ly1; Lz1_ = Lz1;
+    int64_t Rdt1 = static_cast<int64_t>(streams::lut_lorenz_rate[rate1]);
+    int32_t Rx1 = Rx1_ + ((Rdt1 * (-Ry1_ - Rz1_)) >> 24);
+    int32_t Ry1 = Ry1_ + ((Rdt1 * (Rx1_ + ((a * Ry1_) >> 24))) >> 24);
+    int32_t Rz1 = Rz1_ + ((Rdt1 * (b + ((Rz1_ * (Rx1_ - c1_)) >> 24))) >> 24);
+    Rx1_ = Rx1; Ry1_ = Ry1; Rz1_ = Rz1;
+
+    int64_t Ldt2 = static_cast<int64_t>(streams::lut_lorenz_rate[rate2] >> (5 - freq_range2));
+    int32_t Lx2 = Lx2_ + (Ldt2 * ((sigma * (Ly2_ - Lx2_)) >> 24) >> 24);
+    int32_t Ly2 = Ly2_ + (Ldt2 * ((Lx2_ * (rho2_ - Lz2_) >> 24) - Ly2_) >> 24);
+    int32_t Lz2 = Lz2_ + (Ldt2 * ((Lx2_ * int64_t(Ly2_) >> 24) - (beta * Lz2_ >> 24)) >> 24);
+    Lx2_ = Lx2; Ly2_ = Ly2; Lz2_ = Lz2;
+    int64_t Rdt2 = static_cast<int64_t>(streams::lut_lorenz_rate[rate2]);
+    int32_t Rx2 = Rx2_ + ((Rdt2 * (-Ry2_ - Rz2_)) >> 24);
+    int32_t Ry2 = Ry2_ + ((Rdt2 * (Rx2_ + ((a * Ry2_) >> 24))) >> 24);
+    int32_t Rz2 = Rz2_ + ((Rdt2 * (b + ((Rz2_ * (Rx2_ - c2_)) >> 24))) >> 24);
+    Rx2_ = Rx2; Ry2_ = Ry2; Rz2_ = Rz2;
+
+    // Same order as LorenzOutput
+    scaled[streams::LORENZ_OUTPUT_X1] = ((Lx1 * 3) >> 16) + 32769;
+    scaled[streams::LORENZ_OUTPUT_Y1] = ((Ly1 * 3) >> 16) + 32769;
+    scaled[streams::LORENZ_OUTPUT_Z1] = ((Lz1 * 3) >> 16);
+    scaled[streams::LORENZ_OUTPUT_X2] = ((Lx2 * 3) >> 16) + 32769;
+    scaled[streams::LORENZ_OUTPUT_Y2] = ((Ly2 * 3) >> 16) + 32769;
+    scaled[streams::LORENZ_OUTPUT_Z2] = ((Lz2 * 3) >> 16);
+    scaled[streams::ROSSLER_OUTPUT_X1] = (Rx1 >> 14) + 32769;
+    scaled[streams::ROSSLER_OUTPUT_Y1] = (Ry1 >> 14) + 32769;
+    scaled[streams::ROSSLER_OUTPUT_Z1] = (Rz1 >> 14);
+    scaled[streams::ROSSLER_OUTPUT_X2] = (Rx2 >> 14) + 32769;
+    scaled[streams::ROSSLER_OUTPUT_Y2] = (Ry2 >> 14) + 32769;
+    scaled[streams::ROSSLER_OUTPUT_Z2] = (Rz2 >> 14);
+  }
+
+private:
+  int32_t Lx1_, Ly1_, Lz1_, Rx1_, Ry1_, Rz1_;
+  int32_t Lx2_, Ly2_, Lz2_, Rx2_, Ry2_, Rz2_;
+  int64_t rho1_, rho2_, c1_, c2_;
+};
+
+// Three generators showing the twelve plain outputs between them
+struct LorenzBank {
+  streams::LorenzGenerator generator[3];
+
+  void Init(streams::LorenzIntegrator integrator, int16_t rho1, int16_t rho2) {
+    for (int g = 0; g < 3; ++g) {
+      generator[g].Init(0);
+      generator[g].Init(1);
+      generator[g].set_integrator(integrator);
+      generator[g].set_rho1(rho1);
+      generator[g].set_rho2(rho2);
+      generator[g].set_out_a(g * 4);
+      generator[g].set_out_b(g * 4 + 1);
+      generator[g].set_out_c(g * 4 + 2);
+      generator[g].set_out_d(g * 4 + 3);
+    }
+  }
+
+  void Process(int32_t freq1, int32_t freq2, bool reset1, bool reset2, uint8_t range1, uint8_t range2) {
+    for (int g = 0; g < 3; ++g)
+      generator[g].Process(freq1, freq2, reset1, reset2, range1, range2);
+  }
+
+  uint16_t output(int o) const {
+    return generator[o / 4].dac_code(o % 4);
+  }
+};
+
+TEST(LorenzGenerator, EulerMatchesReference) {
+  std::mt19937 rng(0x10e2);
+  for (int run = 0; run < 40; ++run) {
+    int16_t rho1 = (4 << 8) + rng() % (124 << 8), rho2 = (4 << 8) + rng() % (124 << 8);
+    LorenzBank bank;
+    ReferenceLorenz reference;
+    bank.Init(streams::LORENZ_INTEGRATOR_EULER, rho1, rho2);
+    reference.Init(0);
+    reference.Init(1);
+    reference.set_rho1(rho1);
+    reference.set_rho2(rho2);
+
+    uint8_t range1 = run % 5, range2 = (run / 5) % 5;
+    int32_t freq1 = rng() % 65536, freq2 = rng() % 65536;
+    for (int tick = 0; tick < 20000; ++tick) {
+      if (tick % 1000 == 500) {
+        freq1 = rng() % 65536;
+        freq2 = rng() % 65536;
+      }
+      bool reset1 = tick % 7919 == 7000;
+      bool reset2 = tick % 6007 == 5000;
+      bank.Process(freq1, freq2, reset1, reset2, range1, range2);
+      reference.Process(freq1, freq2, reset1, reset2, range1, range2);
+      for (int o = 0; o < 12; ++o)
+        ASSERT_EQ(static_cast<uint16_t>(reference.scaled[o]), bank.output(o))
+          << "run " << run << " tick " << tick << " output " << o;
+    }
+  }
+}
+
+// At the top rate of freq_range 5 every integrator has to keep the Lorenz
+// outputs moving around the attractor, rather than collapsing onto a fixed
+// point or running off.
+TEST(LorenzGenerator, StableAtTopRange) {
+  for (int i = 0; i < streams::LORENZ_INTEGRATOR_LAST; ++i) {
+    LorenzBank bank;
+    bank.Init(static_cast<streams::LorenzIntegrator>(i), 127 << 8, 4 << 8);
+    uint16_t lo[6], hi[6];
+    for (int o = 0; o < 6; ++o) { lo[o] = 0xffff; hi[o] = 0; }
+
+    for (int tick = 0; tick < 100000; ++tick) {
+      bank.Process(65535, 65535, false, false, 5, 5);
+      if (tick < 90000) continue;
+      for (int o = 0; o < 6; ++o) {
+        uint16_t v = bank.output(o);
+        if (v < lo[o]) lo[o] = v;
+        if (v > hi[o]) hi[o] = v;
+      }
+    }
+    for (int o = 0; o < 6; ++o) {
+      EXPECT_GT(hi[o] - lo[o], 4000) << "integrator " << i << " output " << o;
+      if (o % 3 != 2) {
+        // x and y swing around 32769 by roughly +/- 20 * 3 * 256
+        EXPECT_GT(lo[o], 32769 - 60 * 3 * 256) << "integrator " << i << " output " << o;
+        EXPECT_LT(hi[o], 32769 + 60 * 3 * 256) << "integrator " << i << " output " << o;
+      }
+    }
+  }
+}
+
+// Host time per Process() call for each integrator, at the rate LowerRenz and
+// APP_LORENZ default to and at the top of freq_range 5 where sub-steps kick in.
+TEST(LorenzGeneratorBenchmark, PerIntegrator) {
+  static const char * const names[] = { "Euler", "Midpoint", "RK4" };
+  static const int kTicks = 1000000;
+  static const uint8_t kRanges[] = { 2, 5 };
+  for (uint8_t range : kRanges) {
+    for (int i = 0; i < streams::LORENZ_INTEGRATOR_LAST; ++i) {
+      streams::LorenzGenerator lorenz;
+      lorenz.Init(0);
+      lorenz.Init(1);
+      lorenz.set_integrator(static_cast<streams::LorenzIntegrator>(i));
+      lorenz.set_rho1(63 << 8);
+      lorenz.set_rho2(63 << 8);
+      lorenz.set_out_a(streams::LORENZ_OUTPUT_X1);
+      lorenz.set_out_b(streams::LORENZ_OUTPUT_Y2);
+      lorenz.set_out_c(streams::ROSSLER_OUTPUT_X1);
+      lorenz.set_out_d(streams::ROSSLER_OUTPUT_Z2);
+
+      uint32_t checksum = 0;
+      auto start = std::chrono::steady_clock::now();
+      for (int tick = 0; tick < kTicks; ++tick) {
+        lorenz.Process(65535, 60000, false, false, range, range);
+        checksum += lorenz.dac_code(tick & 3);
+      }
+      auto elapsed = std::chrono::steady_clock::now() - start;
+      printf("%-8s range %d: %.1f ns per Process (checksum %u)\n", names[i], range,
+             std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / double(kTicks), checksum);
+    }
+  }
+}
@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "HSPitchDetector.h"
+
+// What the Tuner runs on the audio input: 44.1kHz decimated by 2
+static const float kSampleRate = 22050.0f;
+typedef HS::PitchDetector<int16_t, 512, 512> AudioDetector;
+
+static float Cents(float measured, float actual) {
+  return 1200.0f * log2f(measured / actual);
+}
+
+// The codec's input filter band-limits whatever comes in, so the test waveforms are built from
+// their harmonics below Nyquist. Amplitude of harmonic h, 1-based.
+typedef std::function<float(int)> Spectrum;
+
+static const struct {
+  const char *name;
+  Spectrum spectrum;
+} kWaveforms[] = {
+  { "sine", [](int h) { return h == 1 ? 1.0f : 0.0f; } },
+  { "saw", [](int h) { return 0.6f / h; } },
+  { "square", [](int h) { return (h & 1) ? 0.8f / h : 0.0f; } },
+  { "pulse", [](int h) { return 0.6f * sinf(float(M_PI) * h * 0.1f) / h; } }, // 10% duty
+  // more second harmonic than fundamental, the classic octave error
+  { "octave", [](int h) { return h == 1 ? 0.3f : (h == 2 ? 0.7f : 0.0f); } },
+};
+
+static void Render(AudioDetector &detector, const Spectrum &spectrum, float freq, float noise, std::mt19937 &rng) {
+  std::normal_distribution<float> gauss(0.0f, noise);
+  const float phase = (rng() % 1000) / 1000.0f;
+  const int harmonics = int(0.45f * kSampleRate / freq);
+  for (int n = 0; n < AudioDetector::BUFFER_SIZE; ++n) {
+    float v = 0.0f;
+    for (int h = 1; h <= harmonics; ++h)
+      v += spectrum(h) * sinf(2.0f * float(M_PI) * h * (phase + freq * n / kSampleRate));
+    if (noise > 0.0f) v += gauss(rng);
+    v *= 12000.0f;
+    detector.buffer()[n] = int16_t(std::max(-32767.0f, std::min(32767.0f, v)));
+  }
+}
+
+TEST(PitchDetector, CentAccuracy) {
+  static const float kFrequencies[] = { 55.0f, 82.41f, 110.0f, 196.0f, 261.63f, 440.0f, 659.26f, 880.0f, 1318.5f };
+  static AudioDetector detector;
+  std::mt19937 rng(0x440);
+  for (const auto &w : kWaveforms) {
+    float worst = 0.0f;
+    for (float freq : kFrequencies) {
+      Render(detector, w.spectrum, freq, 0.0f, rng);
+      float period = detector.Run();
+      ASSERT_GT(period, 0.0f) << w.name << " " << freq;
+      float cents = Cents(kSampleRate / period, freq);
+      // Parabolic interpolation gets coarse once a cycle is only a few dozen samples long
+      const float tolerance = (kSampleRate / freq > 20.0f) ? 3.0f : 8.0f;
+      EXPECT_LT(fabsf(cents), tolerance) << w.name << " " << freq << "Hz read as " << kSampleRate / period;
+      worst = std::max(worst, fabsf(cents));
+    }
+    printf("%-7s worst %.2f cents\n", w.name, worst);
+  }
+}
+
+TEST(PitchDetector, Noise) {
+  static AudioDetector detector;
+  std::mt19937 rng(0x1e);
+  for (float freq : { 110.0f, 440.0f }) {
+    Render(detector, kWaveforms[1].spectrum, freq, 0.1f, rng);
+    float period = detector.Run();
+    ASSERT_GT(period, 0.0f);
+    EXPECT_LT(fabsf(Cents(kSampleRate / period, freq)), 10.0f) << freq;
+  }
+
+  // Just noise, or silence, has no pitch
+  Render(detector, [](int) { return 0.0f; }, 100.0f, 0.5f, rng);
+  EXPECT_EQ(0.0f, detector.Run());
+  Render(detector, [](int) { return 0.0f; }, 100.0f, 0.0f, rng);
+  EXPECT_EQ(0.0f, detector.Run());
+}
+
+// Stepping a few lags at a time comes to the same answer as running it in one go
+TEST(PitchDetector, Incremental) {
+  static AudioDetector detector;
+  std::mt19937 rng(0x5);
+  Render(detector, kWaveforms[1].spectrum, 98.0f, 0.0f, rng);
+  const float whole = detector.Run();
+  detector.Start();
+  int steps = 0;
+  while (!detector.Step(16)) ++steps;
+  EXPECT_EQ(whole, detector.period());
+  EXPECT_GT(steps, 10);
+}
+
+// FreqMeasure periods from a waveform that triggers twice per cycle
+TEST(PitchDetector, PeriodSequence) {
+  HS::PitchDetector<int32_t, 24, 8> detector;
+  std::mt19937 rng(0x7);
+  for (int n = 0; n < 32; ++n) detector.buffer()[n] = ((n & 1) ? 70000 : 30000) + int(rng() % 200) - 100;
+  detector.Run();
+  EXPECT_EQ(2, detector.lag());
+
+  // A clean single trigger per cycle has no pattern to find, so no lag
+  for (int n = 0; n < 32; ++n) detector.buffer()[n] = 100000 + int(rng() % 200) - 100;
+  detector.Run();
+  EXPECT_EQ(0, detector.lag());
+}
+
+// Whole counts between the edges of a steady oscillator, as FreqMeasure gives them
+static void CountPeriods(int32_t *x, int n, double period) {
+  for (int i = 0; i < n; ++i) x[i] = int32_t(floor((i + 1) * period) - floor(i * period));
+}
+
+// The Tuner's average over whole cycles of however many triggers there are per cycle
+static double CyclePeriod(const int32_t *x, int n, int lag) {
+  const int k = HS::PeriodsPerCycle(x, n, lag, 3);
+  const int cycles = n / k;
+  double sum = 0.0;
+  for (int i = n - cycles * k; i < n; ++i) sum += x[i];
+  return sum / cycles;
+}
+
+// A period between two counts makes a pattern of counts, which isn't more triggers per cycle
+TEST(PitchDetector, FractionalPeriods) {
+  HS::PitchDetector<int32_t, 24, 8> detector;
+  for (double period : { 340909.5, 340909.333, 340909.25, 340909.2, 340909.125, 1000.5, 100.333 }) {
+    CountPeriods(detector.buffer(), 32, period);
+    detector.Run();
+    EXPECT_NEAR(period, CyclePeriod(detector.buffer(), 32, detector.lag()), 1.0) << period;
+  }
+
+  // Two triggers per cycle, at uneven points, and with a fractional period too
+  std::vector<int32_t> edges;
+  for (int i = 0; i < 33; ++i) {
+    const double start = i / 2 * 100000.333;
+    edges.push_back(int32_t(floor(start + (i & 1 ? 30000.0 : 0.0))));
+  }
+  for (int n = 0; n < 32; ++n) detector.buffer()[n] = edges[n + 1] - edges[n];
+  detector.Run();
+  EXPECT_EQ(2, detector.lag());
+  EXPECT_NEAR(100000.333, CyclePeriod(detector.buffer(), 32, detector.lag()), 1.0);
+}
+
+// Time to analyse one frame, low and high notes
+TEST(PitchDetectorBenchmark, CostPerFrame) {
+  static AudioDetector detector;
+  std::mt19937 rng(0xbe);
+  for (float freq : { 55.0f, 440.0f, 1760.0f }) {
+    Render(detector, kWaveforms[1].spectrum, freq, 0.0f, rng);
+    static const int kFrames = 200;
+    float sum = 0.0f;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kFrames; ++i) sum += detector.Run();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double us = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() * 1e-3 / kFrames;
+    printf("%6.0fHz: %.1f us per frame, %d lags (period %.2f)\n", freq, us, detector.lag() + 2, sum / kFrames);
+  }
+}
@@ -0,0 +1,101 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "gtest/gtest.h"
+#include "HSPitchMemo.h"
+
+typedef HS::PitchMemo<3, 16> Memo;
+
+// Nearest note of a major scale, then up some degrees, like braids::Quantizer without hysteresis
+static int32_t Quantize(int32_t pitch, int root, int transpose) {
+  static const int16_t notes[] = {0, 256, 512, 640, 896, 1152, 1408};
+  static const int span = 12 << 7;
+  pitch -= root << 7;
+  int octave = pitch / span - (pitch < 0 ? 1 : 0);
+  const int rel = pitch - octave * span;
+  int q = 0;
+  for (int i = 1; i < 7; ++i) {
+    if (abs(rel - notes[i]) < abs(rel - notes[q])) q = i;
+  }
+  if (span - rel < abs(rel - notes[q])) {
+    ++octave;
+    q = 0;
+  }
+  q += transpose;
+  octave += q / 7;
+  q %= 7;
+  if (q < 0) {
+    q += 7;
+    --octave;
+  }
+  return notes[q] + octave * span + (root << 7);
+}
+
+static const int32_t *Chord(Memo &memo, int32_t pitch, int root, int transpose) {
+  const Memo::Key key = { pitch, int16_t(root), int8_t(transpose), 1 };
+  bool hit;
+  int32_t *voice = memo.Get(key, hit);
+  if (!hit) {
+    for (int v = 0; v < 3; ++v) voice[v] = Quantize(pitch, root, transpose + 2 * (v + 1));
+  }
+  return voice;
+}
+
+TEST(PitchMemo, HitsMissesAndInvalidate) {
+  Memo memo;
+  const int32_t *c = Chord(memo, 1000, 0, 0);
+  EXPECT_EQ(Quantize(1000, 0, 2), c[0]);
+  EXPECT_EQ(0u, memo.hits());
+  EXPECT_EQ(1u, memo.misses());
+
+  Chord(memo, 1000, 0, 0);
+  Chord(memo, 1000, 0, 0);
+  EXPECT_EQ(2u, memo.hits());
+  EXPECT_EQ(66, memo.hit_rate());
+
+  // Every part of the key counts
+  Chord(memo, 1000, 1, 0);
+  Chord(memo, 1000, 0, -1);
+  Chord(memo, 1001, 0, 0);
+  EXPECT_EQ(4u, memo.misses());
+
+  memo.Invalidate();
+  Chord(memo, 1000, 0, 0);
+  EXPECT_EQ(5u, memo.misses());
+}
+
+// Whatever collides, every lookup gives what quantizing afresh would
+TEST(PitchMemo, AlwaysMatchesQuantizer) {
+  Memo memo;
+  srand(3);
+  for (int i = 0; i < 20000; ++i) {
+    const int32_t pitch = (rand() % 40) * 96 - 1000; // a few dozen pitches, so both hits and misses
+    const int root = rand() % 12;
+    const int transpose = rand() % 5 - 2;
+    const int32_t *c = Chord(memo, pitch, root, transpose);
+    for (int v = 0; v < 3; ++v) ASSERT_EQ(Quantize(pitch, root, transpose + 2 * (v + 1)), c[v]) << i;
+  }
+  EXPECT_GT(memo.hits(), 0u);
+  EXPECT_GT(memo.misses(), 16u);
+}
+
+TEST(PitchMemoBenchmark, ArpeggioCost) {
+  static const int kNotes = 1 << 20;
+  static const int32_t arp[] = {0, 512, 896, 1536, 2048, 2432, 3072, 2432};
+  Memo memo;
+  int64_t sink = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kNotes; ++i) {
+    for (int v = 0; v < 3; ++v) sink += Quantize(arp[i & 7], 2, 2 * (v + 1));
+  }
+  const double live = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start).count() / double(kNotes);
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kNotes; ++i) sink += Chord(memo, arp[i & 7], 2, 0)[2];
+  const double memoised = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start).count() / double(kNotes);
+  printf("live %.1f ns, memo %.1f ns per 3-voice chord, %d%% hits (%lld)\n", live, memoised,
+         memo.hit_rate(), (long long)(sink & 1));
+}
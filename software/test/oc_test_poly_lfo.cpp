@@ -0,0 +1,139 @@
+#include <chrono>
+#include <cstdio>
+#include "gtest/gtest.h"
+#include "frames_poly_lfo.h"
+
+static const size_t kBlockSize = 16;
+
+struct PolyLfoParams {
+  uint16_t shape, shape_spread, spread, coupling;
+  frames::PolyLfoFreqMultipliers div_b, div_c, div_d;
+  uint8_t xor_b, xor_c, xor_d;
+  uint8_t am_b, am_c, am_d;
+  uint16_t attenuation;
+  int16_t offset;
+  bool sync;
+
+  void Apply(frames::PolyLfo &lfo) const {
+    lfo.set_shape(shape);
+    lfo.set_shape_spread(shape_spread);
+    lfo.set_spread(spread);
+    lfo.set_coupling(coupling);
+    lfo.set_freq_div_b(div_b);
+    lfo.set_freq_div_c(div_c);
+    lfo.set_freq_div_d(div_d);
+    lfo.set_b_xor_a(xor_b);
+    lfo.set_c_xor_a(xor_c);
+    lfo.set_d_xor_a(xor_d);
+    lfo.set_b_am_by_a(am_b);
+    lfo.set_c_am_by_b(am_c);
+    lfo.set_d_am_by_c(am_d);
+    lfo.set_attenuation(attenuation);
+    lfo.set_offset(offset);
+    lfo.set_sync(sync);
+  }
+};
+
+static const PolyLfoParams kParams[] = {
+  // defaults
+  { 0, 32767, 32768, 32768, frames::POLYLFO_FREQ_MULT_NONE, frames::POLYLFO_FREQ_MULT_NONE, frames::POLYLFO_FREQ_MULT_NONE,
+    0, 0, 0, 0, 0, 0, 58880, 0, false },
+  // positive spread, mixed ratios, coupling
+  { 20000, 40000, 50000, 60000, frames::POLYLFO_FREQ_MULT_BY2, frames::POLYLFO_FREQ_MULT_NONE, frames::POLYLFO_FREQ_MULT_1_OVER_3,
+    0, 3, 0, 10, 0, 100, 65535, 100, false },
+  // negative spread, negative coupling, XOR and AM
+  { 45000, 10000, 12000, 4000, frames::POLYLFO_FREQ_MULT_NONE, frames::POLYLFO_FREQ_MULT_5_OVER_4, frames::POLYLFO_FREQ_MULT_NONE,
+    8, 1, 4, 254, 128, 2, 30000, -2000, false },
+  // tap tempo
+  { 65535, 0, 32768, 32768, frames::POLYLFO_FREQ_MULT_BY16, frames::POLYLFO_FREQ_MULT_1_OVER_16, frames::POLYLFO_FREQ_MULT_3_OVER_2,
+    2, 2, 2, 50, 50, 50, 58880, 0, true },
+};
+
+class PolyLfoTest : public ::testing::TestWithParam<size_t> {
+public:
+  virtual void SetUp() {
+    reference_.Init();
+    block_.Init();
+  }
+
+protected:
+  frames::PolyLfo reference_;
+  frames::PolyLfo block_;
+};
+
+TEST_P(PolyLfoTest, RenderBlockMatchesRender) {
+  const PolyLfoParams &params = kParams[GetParam()];
+  params.Apply(reference_);
+  params.Apply(block_);
+
+  uint16_t buffer[frames::kNumChannels][kBlockSize];
+  uint16_t *const out[frames::kNumChannels] = { buffer[0], buffer[1], buffer[2], buffer[3] };
+
+  for (size_t block = 0; block < 2000; ++block) {
+    int32_t frequency = 20000 + (block * 37) % 30000;
+    bool reset_phase = (block % 97) == 13;
+    bool tempo_sync = (block % 23) == 0;
+    uint8_t freq_mult = (block / 500) % 2 ? 0xFF : block % 6;
+    size_t size = 1 + block % kBlockSize;
+
+    // Parameters change at control rate, i.e. between blocks
+    if ((block % 200) == 100) {
+      PolyLfoParams changed = params;
+      changed.spread = 65535 - params.spread;
+      changed.coupling = 65535 - params.coupling;
+      changed.Apply(reference_);
+      changed.Apply(block_);
+    }
+
+    block_.RenderBlock(frequency, reset_phase, tempo_sync, freq_mult, out, size);
+    for (size_t i = 0; i < size; ++i) {
+      reference_.Render(frequency, reset_phase && !i, tempo_sync && !i, freq_mult);
+      for (size_t c = 0; c < frames::kNumChannels; ++c)
+        ASSERT_EQ(reference_.dac_code(c), buffer[c][i]) << "block " << block << " tick " << i << " channel " << c;
+    }
+    for (size_t c = 0; c < frames::kNumChannels; ++c) {
+      EXPECT_EQ(reference_.dac_code(c), block_.dac_code(c));
+      EXPECT_EQ(reference_.level(c), block_.level(c));
+    }
+    EXPECT_EQ(reference_.get_sync_counter(), block_.get_sync_counter());
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(PolyLfoParams, PolyLfoTest, ::testing::Range<size_t>(0, sizeof(kParams) / sizeof(kParams[0])));
+
+TEST(PolyLfoBenchmark, RenderBlock) {
+  static const size_t kTicks = 16384 * 64;
+  const PolyLfoParams &params = kParams[2];
+
+  frames::PolyLfo lfo;
+  lfo.Init();
+  params.Apply(lfo);
+
+  uint32_t checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t t = 0; t < kTicks; ++t) {
+    lfo.Render(30000, false, false, 0xFF);
+    checksum += lfo.dac_code(3);
+  }
+  auto render_time = std::chrono::steady_clock::now() - start;
+
+  lfo.Init();
+  params.Apply(lfo);
+  uint16_t buffer[frames::kNumChannels][kBlockSize];
+  uint16_t *const out[frames::kNumChannels] = { buffer[0], buffer[1], buffer[2], buffer[3] };
+  uint32_t block_checksum = 0;
+  start = std::chrono::steady_clock::now();
+  for (size_t t = 0; t < kTicks; t += kBlockSize) {
+    lfo.RenderBlock(30000, false, false, 0xFF, out, kBlockSize);
+    for (size_t i = 0; i < kBlockSize; ++i)
+      block_checksum += buffer[3][i];
+  }
+  auto block_time = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(checksum, block_checksum);
+  printf("Render: %lld us, RenderBlock(%zu): %lld us for %zu ticks\n",
+         (long long)std::chrono::duration_cast<std::chrono::microseconds>(render_time).count(),
+         kBlockSize,
+         (long long)std::chrono::duration_cast<std::chrono::microseconds>(block_time).count(),
+         kTicks);
+}
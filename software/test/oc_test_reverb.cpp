@@ -0,0 +1,146 @@
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "HSCombReverb.h"
+
+static const size_t kSampleRate = 44100;
+static const size_t kBlockSize = 128; // AUDIO_BLOCK_SAMPLES
+
+// Renders in audio blocks, in place, the way AudioEffectCombReverb does
+static std::vector<int16_t> Render(HS::CombReverb &reverb, std::vector<int16_t> signal) {
+  for (size_t n = 0; n < signal.size(); n += kBlockSize)
+    reverb.Process(&signal[n], &signal[n], std::min(kBlockSize, signal.size() - n));
+  return signal;
+}
+
+static std::vector<int16_t> Impulse(size_t length) {
+  std::vector<int16_t> signal(length, 0);
+  signal[0] = 32767;
+  return signal;
+}
+
+static double Energy(const std::vector<int16_t> &signal, size_t start, size_t end) {
+  double sum = 0.0;
+  for (size_t n = start; n < end; ++n) sum += double(signal[n]) * signal[n];
+  return sum;
+}
+
+// Energy of the first difference, which grows with high frequency content
+static double DiffEnergy(const std::vector<int16_t> &signal, size_t start, size_t end) {
+  double sum = 0.0;
+  for (size_t n = start + 1; n < end; ++n) {
+    double d = double(signal[n]) - signal[n - 1];
+    sum += d * d;
+  }
+  return sum;
+}
+
+static std::unique_ptr<HS::CombReverb> MakeReverb(int32_t size, int32_t damping, int spread = 0) {
+  std::unique_ptr<HS::CombReverb> reverb(new HS::CombReverb);
+  reverb->Init(spread);
+  reverb->set_size(size);
+  reverb->set_damping(damping);
+  return reverb;
+}
+
+TEST(CombReverb, ImpulseTailDiesAway) {
+  auto reverb = MakeReverb(16384, 16384);
+  auto out = Render(*reverb, Impulse(kSampleRate * 8));
+
+  // Nothing comes out before the shortest comb
+  for (size_t n = 0; n < 1116; ++n) ASSERT_EQ(0, out[n]) << n;
+
+  const size_t window_size = kSampleRate / 8;
+  double last = Energy(out, 0, window_size);
+  EXPECT_GT(last, 0.0);
+  for (size_t window = 1; window < 4; ++window) {
+    double energy = Energy(out, window * window_size, (window + 1) * window_size);
+    EXPECT_LT(energy, last) << window;
+    last = energy;
+  }
+  // and the integer tail goes all the way to silence
+  for (size_t n = kSampleRate * 6; n < out.size(); ++n) ASSERT_EQ(0, out[n]) << n;
+}
+
+TEST(CombReverb, SizeLengthensTail) {
+  auto small = MakeReverb(0, 16384);
+  auto large = MakeReverb(32767, 16384);
+  auto small_out = Render(*small, Impulse(kSampleRate * 2));
+  auto large_out = Render(*large, Impulse(kSampleRate * 2));
+  EXPECT_GT(Energy(large_out, kSampleRate, kSampleRate * 2),
+            10.0 * Energy(small_out, kSampleRate, kSampleRate * 2));
+}
+
+TEST(CombReverb, DampingDarkensTail) {
+  std::mt19937 rng(0x7e7b);
+  std::vector<int16_t> noise(kSampleRate / 10);
+  for (auto &s : noise) s = int(rng() % 32768) - 16384;
+  noise.resize(kSampleRate, 0);
+
+  auto bright = MakeReverb(24000, 0);
+  auto dark = MakeReverb(24000, 32767);
+  auto bright_out = Render(*bright, noise);
+  auto dark_out = Render(*dark, noise);
+  const size_t start = kSampleRate / 5, end = kSampleRate;
+  double bright_ratio = DiffEnergy(bright_out, start, end) / Energy(bright_out, start, end);
+  double dark_ratio = DiffEnergy(dark_out, start, end) / Energy(dark_out, start, end);
+  EXPECT_LT(dark_ratio, bright_ratio * 0.5);
+}
+
+// Full scale noise at the longest size with no damping saturates the combs,
+// which must neither wrap around nor keep ringing once the input stops.
+TEST(CombReverb, FullScaleInputStaysBounded) {
+  std::mt19937 rng(0xf0f0);
+  std::vector<int16_t> noise(kSampleRate * 4);
+  for (auto &s : noise) s = rng() & 1 ? 32767 : -32768;
+  noise.resize(kSampleRate * 20, 0);
+
+  auto reverb = MakeReverb(32767, 0);
+  auto out = Render(*reverb, noise);
+  size_t clipped = 0;
+  for (size_t n = 0; n < kSampleRate * 4; ++n)
+    if (out[n] == 32767 || out[n] == -32768) ++clipped;
+  EXPECT_LT(clipped, kSampleRate * 4 / 10);
+  for (size_t n = kSampleRate * 19; n < out.size(); ++n) ASSERT_EQ(0, out[n]) << n;
+}
+
+// Block size doesn't change the result, and the spread decorrelates two instances
+TEST(CombReverb, BlockSizeAndSpread) {
+  std::mt19937 rng(0xb10c);
+  std::vector<int16_t> input(kSampleRate);
+  for (auto &s : input) s = int(rng() % 65536) - 32768;
+
+  auto blocks = MakeReverb(20000, 10000);
+  auto whole = MakeReverb(20000, 10000);
+  auto spread = MakeReverb(20000, 10000, 23);
+  auto block_out = Render(*blocks, input);
+  std::vector<int16_t> whole_out(input.size());
+  whole->Process(input.data(), whole_out.data(), input.size());
+  auto spread_out = Render(*spread, input);
+  EXPECT_EQ(block_out, whole_out);
+  EXPECT_NE(block_out, spread_out);
+}
+
+// Host time for one AUDIO_BLOCK_SAMPLES block
+TEST(CombReverbBenchmark, Block) {
+  static const int kBlocks = 20000;
+  std::mt19937 rng(0xbe4c);
+  std::vector<int16_t> input(kBlockSize * 64);
+  for (auto &s : input) s = int(rng() % 65536) - 32768;
+
+  auto reverb = MakeReverb(24000, 16384);
+  int16_t out[kBlockSize];
+  uint32_t checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int b = 0; b < kBlocks; ++b) {
+    reverb->Process(&input[(b % 64) * kBlockSize], out, kBlockSize);
+    checksum += out[b % kBlockSize];
+  }
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  printf("CombReverb: %.1f ns per block of %zu (checksum %u)\n",
+         std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / double(kBlocks),
+         kBlockSize, checksum);
+}
@@ -0,0 +1,130 @@
+#include <cstring>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "HSSampleMemory.h"
+
+TEST(SamplePool, AcquireRelease) {
+  std::vector<uint8_t> mem(16 * 1024);
+  HS::SamplePool pool(mem.data(), mem.size(), 1024);
+  EXPECT_EQ(16, pool.stats().blocks);
+
+  uint8_t *a = pool.Acquire(0, 3000); // 3 blocks
+  uint8_t *b = pool.Acquire(1, 1024);
+  ASSERT_NE(nullptr, a);
+  ASSERT_NE(nullptr, b);
+  EXPECT_GE(b, a + 3000);
+  EXPECT_EQ(3, pool.Held(0));
+  EXPECT_EQ(1, pool.Held(1));
+  EXPECT_EQ(4, pool.stats().used);
+  EXPECT_EQ(12 * 1024u, pool.Largest());
+
+  // Asking again replaces the slot's allocation
+  a = pool.Acquire(0, 1);
+  ASSERT_NE(nullptr, a);
+  EXPECT_EQ(1, pool.Held(0));
+  EXPECT_EQ(2, pool.stats().used);
+  EXPECT_EQ(4, pool.stats().peak);
+
+  pool.Release(0);
+  pool.Release(0);
+  pool.Release(1);
+  EXPECT_EQ(0, pool.stats().used);
+  EXPECT_EQ(16 * 1024u, pool.Largest());
+  EXPECT_EQ(0, pool.stats().failed);
+}
+
+TEST(SamplePool, Full) {
+  std::vector<uint8_t> mem(8 * 1024);
+  HS::SamplePool pool(mem.data(), mem.size(), 1024);
+
+  EXPECT_EQ(nullptr, pool.Acquire(0, 9 * 1024));
+  EXPECT_EQ(nullptr, pool.Acquire(4, 1024)); // no such slot
+  ASSERT_NE(nullptr, pool.Acquire(0, 3 * 1024));
+  ASSERT_NE(nullptr, pool.Acquire(1, 2 * 1024));
+  ASSERT_NE(nullptr, pool.Acquire(2, 3 * 1024));
+  pool.Release(1);
+  // Three blocks are free, but not in one run
+  EXPECT_EQ(2 * 1024u, pool.Largest());
+  EXPECT_EQ(nullptr, pool.Acquire(3, 3 * 1024));
+  EXPECT_EQ(2, pool.stats().failed);
+  EXPECT_NE(nullptr, pool.Acquire(3, 2 * 1024));
+}
+
+// Allocations never overlap, however slots come and go
+TEST(SamplePool, NoOverlap) {
+  std::vector<uint8_t> mem(24 * 4096);
+  HS::SamplePool pool(mem.data(), mem.size(), 4096);
+  std::mt19937 rng(0x5a);
+  uint8_t *held[4] = {nullptr};
+  size_t sizes[4] = {0};
+
+  for (int i = 0; i < 10000; ++i) {
+    int slot = rng() % 4;
+    if (rng() % 3 == 0) {
+      pool.Release(slot);
+      held[slot] = nullptr;
+    } else {
+      sizes[slot] = 1 + rng() % (48 * 1024);
+      held[slot] = pool.Acquire(slot, sizes[slot]);
+    }
+    int used = 0;
+    for (int s = 0; s < 4; ++s) {
+      used += pool.Held(s);
+      if (!held[s]) continue;
+      ASSERT_LE(held[s] + sizes[s], mem.data() + mem.size());
+      for (int t = 0; t < 4; ++t) {
+        if (t == s || !held[t]) continue;
+        ASSERT_TRUE(held[s] + sizes[s] <= held[t] || held[t] + sizes[t] <= held[s]) << i;
+      }
+    }
+    ASSERT_EQ(used, pool.stats().used);
+  }
+}
+
+TEST(PackedSamples12, RoundTrip) {
+  const size_t kSamples = 1001;
+  std::vector<uint8_t> mem(HS::PackedSamples12::BytesFor(kSamples) + 1, 0xee);
+  EXPECT_EQ(1502u, HS::PackedSamples12::BytesFor(kSamples));
+  HS::PackedSamples12 samples(mem.data());
+
+  std::vector<int16_t> values(kSamples);
+  std::mt19937 rng(0x12);
+  for (auto &v : values) v = int16_t(rng() % 4096) - 2048;
+  values[0] = -2048;
+  values[1] = 2047;
+  for (size_t i = 0; i < kSamples; ++i) samples.Set(i, values[i]);
+  for (size_t i = 0; i < kSamples; ++i) ASSERT_EQ(values[i], samples.Get(i)) << i;
+  EXPECT_EQ(0xee, mem.back()); // nothing written past the end
+
+  // Writing one sample leaves its neighbours alone
+  samples.Set(500, 7);
+  EXPECT_EQ(values[499], samples.Get(499));
+  EXPECT_EQ(7, samples.Get(500));
+  EXPECT_EQ(values[501], samples.Get(501));
+}
+
+// Without memory of its own, the pool only holds heap while some slot holds blocks
+TEST(SamplePool, HeapOnlyWhileHeld) {
+  HS::SamplePool pool(nullptr, 8 * 1024, 1024);
+  EXPECT_FALSE(pool.allocated());
+  EXPECT_EQ(8 * 1024u, pool.Largest());
+
+  uint8_t *a = pool.Acquire(0, 2048);
+  ASSERT_NE(nullptr, a);
+  EXPECT_TRUE(pool.allocated());
+  memset(a, 0x55, 2048);
+  ASSERT_NE(nullptr, pool.Acquire(1, 1024));
+
+  // Asking again keeps the memory, and so does releasing while another slot holds some
+  EXPECT_EQ(a, pool.Acquire(0, 1024));
+  pool.Release(0);
+  EXPECT_TRUE(pool.allocated());
+  pool.Release(1);
+  EXPECT_FALSE(pool.allocated());
+
+  // A request that doesn't fit doesn't keep it either
+  EXPECT_EQ(nullptr, pool.Acquire(2, 9 * 1024));
+  EXPECT_FALSE(pool.allocated());
+  EXPECT_EQ(1, pool.stats().failed);
+}
@@ -0,0 +1,123 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "HSScopeCapture.h"
+
+using HS::ScopeCapture;
+
+static void Feed(ScopeCapture &capture, const std::vector<uint8_t> &a, uint8_t b = 0) {
+  for (uint8_t s : a) capture.Process(s, b);
+}
+
+// A square wave with a period of 200 ticks
+static std::vector<uint8_t> Square(size_t length) {
+  std::vector<uint8_t> v(length);
+  for (size_t n = 0; n < length; ++n) v[n] = (n % 200) < 100 ? 20 : 230;
+  return v;
+}
+
+TEST(ScopeCapture, TriggerLandsAtPreTriggerColumn) {
+  ScopeCapture capture;
+  capture.Init();
+  capture.set_ticks_per_column(1);
+  capture.set_pre_trigger(32);
+  Feed(capture, Square(1000));
+  ASSERT_GT(capture.frames(), 0u);
+  const int t = capture.trigger_column();
+  EXPECT_EQ(32, t);
+  EXPECT_EQ(20, capture.max(0)[t - 1]);
+  EXPECT_EQ(230, capture.min(0)[t]);
+
+  // Falling
+  capture.set_slope(ScopeCapture::FALLING);
+  capture.Arm();
+  uint32_t frames = capture.frames();
+  Feed(capture, Square(1000));
+  ASSERT_GT(capture.frames(), frames);
+  EXPECT_EQ(230, capture.min(0)[t - 1]);
+  EXPECT_EQ(20, capture.max(0)[t]);
+}
+
+// One tick of spike in a 16-tick column still shows
+TEST(ScopeCapture, MinMaxKeepsSpikes) {
+  ScopeCapture capture;
+  capture.Init();
+  capture.set_ticks_per_column(16);
+  capture.set_level(100);
+  capture.set_pre_trigger(10);
+  capture.set_source(1);
+
+  std::vector<uint8_t> a(16 * 300, 128);
+  a[16 * 200 + 5] = 255;
+  a[16 * 200 + 9] = 0;
+  // Trigger from channel B well before the spike
+  for (size_t n = 0; n < a.size(); ++n) capture.Process(a[n], n < 16 * 150 ? 0 : 200);
+  ASSERT_EQ(1u, capture.frames());
+  int spikes = 0;
+  for (int c = 0; c < ScopeCapture::COLUMNS; ++c) {
+    if (capture.max(0)[c] == 255) {
+      EXPECT_EQ(0, capture.min(0)[c]);
+      ++spikes;
+    } else {
+      EXPECT_EQ(128, capture.max(0)[c]);
+      EXPECT_EQ(128, capture.min(0)[c]);
+    }
+  }
+  EXPECT_EQ(1, spikes);
+}
+
+TEST(ScopeCapture, SingleAndNormal) {
+  ScopeCapture capture;
+  capture.Init();
+  capture.set_mode(ScopeCapture::SINGLE);
+  Feed(capture, Square(5000));
+  EXPECT_EQ(1u, capture.frames());
+  EXPECT_EQ(ScopeCapture::DONE, capture.state());
+  capture.Arm();
+  Feed(capture, Square(5000));
+  EXPECT_EQ(2u, capture.frames());
+
+  capture.set_mode(ScopeCapture::NORMAL);
+  capture.Arm();
+  Feed(capture, Square(5000));
+  EXPECT_GT(capture.frames(), 10u);
+  EXPECT_NE(ScopeCapture::DONE, capture.state());
+}
+
+// Noise around the level doesn't trigger, and nothing triggers before the pre-trigger part is full
+TEST(ScopeCapture, Hysteresis) {
+  ScopeCapture capture;
+  capture.Init();
+  capture.set_level(128);
+  capture.set_pre_trigger(0);
+  std::vector<uint8_t> noise(2000);
+  for (size_t n = 0; n < noise.size(); ++n) noise[n] = 128 + ((n * 7) % 5) - 2;
+  Feed(capture, noise);
+  EXPECT_EQ(ScopeCapture::ARMED, capture.state());
+
+  capture.set_pre_trigger(100);
+  capture.Arm();
+  std::vector<uint8_t> early(50, 0);
+  early.push_back(255);
+  Feed(capture, early);
+  EXPECT_EQ(ScopeCapture::ARMED, capture.state());
+}
+
+// Saves from before the Scope had settings are all 0, and restore the defaults
+TEST(ScopeSettings, OldSavesRestoreDefaults) {
+  const HS::ScopeSettings old = HS::ScopeSettings::Restore(0);
+  EXPECT_EQ(0, old.mode);
+  EXPECT_EQ(128, old.level);
+  EXPECT_EQ(0, old.slope);
+  EXPECT_EQ(20, old.pre_trigger);
+
+  for (int level = 0; level < 256; ++level) {
+    for (int pre_trigger = 0; pre_trigger <= 90; pre_trigger += 10) {
+      const HS::ScopeSettings s = { 2, level, 1, pre_trigger };
+      const HS::ScopeSettings r = HS::ScopeSettings::Restore(s.Save());
+      ASSERT_EQ(2, r.mode);
+      ASSERT_EQ(level, r.level);
+      ASSERT_EQ(1, r.slope);
+      ASSERT_EQ(pre_trigger, r.pre_trigger);
+    }
+  }
+}
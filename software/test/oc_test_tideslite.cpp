@@ -0,0 +1,89 @@
+#include <chrono>
+#include <cstdio>
+#include "gtest/gtest.h"
+#include "tideslite.h"
+
+static void ExpectSame(const TidesLiteSample &expected, const TidesLiteSample &actual) {
+  EXPECT_EQ(expected.unipolar, actual.unipolar);
+  EXPECT_EQ(expected.bipolar, actual.bipolar);
+  EXPECT_EQ(expected.flags, actual.flags);
+}
+
+TEST(TidesLiteVoice, ProcessMatchesProcessSample) {
+  TidesLiteVoice voice;
+  voice.Init();
+
+  TidesLiteSample expected, actual;
+  for (uint32_t slope = 0; slope <= 65535; slope += 1021) {
+    for (uint32_t shape = 0; shape <= 65535; shape += 1543) {
+      for (int32_t fold = 0; fold <= 32767; fold += 8191) {
+        voice.Configure(slope, shape, fold);
+        for (uint32_t i = 0; i < 257; ++i) {
+          uint32_t phase = i * 16711423U + slope;
+          ProcessSample(slope, shape, fold, phase, expected);
+          voice.Process(phase, actual);
+          ExpectSame(expected, actual);
+          if (HasFailure()) {
+            FAIL() << "slope=" << slope << " shape=" << shape << " fold=" << fold << " phase=" << phase;
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(TidesLiteVoice, ProcessSamplesMatchesProcessSample) {
+  TidesLiteVoice voice;
+  voice.Init();
+  voice.Configure(40000, 12345, 20000);
+
+  TidesLiteSample samples[64];
+  voice.ProcessSamples(0, 0xffffffff / 64, samples, 64);
+  uint32_t phases[64];
+  for (int i = 0; i < 64; ++i) {
+    TidesLiteSample expected;
+    phases[i] = 0xffffffff / 64 * i;
+    ProcessSample(40000, 12345, 20000, phases[i], expected);
+    ExpectSame(expected, samples[i]);
+  }
+
+  TidesLiteSample batch[64];
+  voice.ProcessSamples(phases, batch, 64);
+  for (int i = 0; i < 64; ++i)
+    ExpectSame(samples[i], batch[i]);
+}
+
+TEST(TidesLiteBenchmark, Voice) {
+  static const uint32_t kSamples = 1 << 22;
+  static const uint32_t kIncrement = 0x1234567;
+
+  TidesLiteSample sample;
+  uint32_t checksum = 0;
+  uint32_t phase = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < kSamples; ++i) {
+    ProcessSample(30000, 20000, 10000, phase, sample);
+    checksum += sample.unipolar + sample.bipolar;
+    phase += kIncrement;
+  }
+  auto reference_time = std::chrono::steady_clock::now() - start;
+
+  TidesLiteVoice voice;
+  voice.Init();
+  uint32_t voice_checksum = 0;
+  phase = 0;
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < kSamples; ++i) {
+    voice.Configure(30000, 20000, 10000);
+    voice.Process(phase, sample);
+    voice_checksum += sample.unipolar + sample.bipolar;
+    phase += kIncrement;
+  }
+  auto voice_time = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(checksum, voice_checksum);
+  printf("ProcessSample: %lld us, TidesLiteVoice: %lld us for %u samples\n",
+         (long long)std::chrono::duration_cast<std::chrono::microseconds>(reference_time).count(),
+         (long long)std::chrono::duration_cast<std::chrono::microseconds>(voice_time).count(),
+         kSamples);
+}
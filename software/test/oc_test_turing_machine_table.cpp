@@ -0,0 +1,120 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include "gtest/gtest.h"
+#include "HSTuringMachineTable.h"
+
+typedef HS::TuringMachineTable<4> Table;
+typedef HS::TuringMachineTableCache<4, 8> Cache;
+
+// TuringMachineState::Advance() with nothing flipping
+static uint16_t Advance(uint16_t reg, int len) {
+  const uint16_t last = (reg >> (len - 1)) & 0x01;
+  return uint16_t((reg << 1) + last);
+}
+
+// Stand-ins for the output types: a 5-bit note through a scale, mod, trigger, and one that
+// changes with a setting
+static int scale_offset = 0;
+static int Quantize(int note) {
+  static const int semitones[] = {0, 2, 4, 5, 7, 9, 11};
+  return ((note / 7) * 12 + semitones[note % 7]) * 128 + scale_offset;
+}
+static int ValueOf(int o, uint16_t reg) {
+  switch (o) {
+    case 0: return Quantize((reg & 0x1f) + 64);
+    case 1: return (reg & 0xff) * 6;
+    case 2: return reg & 1;
+    default: return Quantize(reg & 0x7f);
+  }
+}
+
+TEST(TuringMachineTable, MatchesShiftRegister) {
+  std::mt19937 rng(7);
+  for (int len = 1; len <= 16; ++len) {
+    for (int trial = 0; trial < 20; ++trial) {
+      const uint16_t start = uint16_t(rng());
+      Table table;
+      table.Build(start, uint8_t(len), ValueOf);
+
+      uint16_t reg = start;
+      int step = 0;
+      for (int beat = 0; beat < 300; ++beat) {
+        ASSERT_EQ(reg, table.step_reg[step]) << "len " << len << " beat " << beat;
+        for (int o = 0; o < 4; ++o) ASSERT_EQ(ValueOf(o, reg), table.value[step][o]);
+        reg = Advance(reg, len);
+        step = table.Next(step);
+      }
+    }
+  }
+}
+
+TEST(TuringMachineTable, CacheHitsAndEvicts) {
+  static Cache cache;
+  cache.Invalidate();
+  const Table *a = cache.Get(0x1234, 8, ValueOf);
+  EXPECT_EQ(a, cache.Get(0x1234, 8, ValueOf));
+  EXPECT_NE(a, cache.Get(0x1234, 7, ValueOf)); // same register, different machine
+  EXPECT_EQ(1u, cache.hits());
+  EXPECT_EQ(2u, cache.misses());
+
+  // Seven more machines fill the cache and push out the least recently used, 0x1234/7
+  cache.Get(0x1234, 8, ValueOf);
+  for (int m = 0; m < 7; ++m) cache.Get(uint16_t(m), 16, ValueOf);
+  EXPECT_EQ(a, cache.Get(0x1234, 8, ValueOf));
+  EXPECT_EQ(3u, cache.hits());
+  cache.Get(0x1234, 7, ValueOf);
+  EXPECT_EQ(10u, cache.misses());
+}
+
+// A track keeps playing the right machine when its table is reused or the outputs change
+TEST(TuringMachineTable, PlaybackSurvivesRebuilds) {
+  static Cache cache;
+  cache.Invalidate();
+  Cache::Playback track;
+  cache.Start(track, 0xace1, 5, ValueOf);
+  uint16_t reg = 0xace1;
+  for (int beat = 0; beat < 100; ++beat) {
+    if (beat % 10 == 3) {
+      for (int m = 0; m < 9; ++m) cache.Get(uint16_t(m * 77), 12, ValueOf);
+    }
+    if (beat == 50) {
+      scale_offset = 3;
+      cache.Invalidate();
+    }
+    const Table *table = cache.Find(track, ValueOf);
+    ASSERT_EQ(reg, table->step_reg[track.step]) << beat;
+    ASSERT_EQ(ValueOf(0, reg), table->value[track.step][0]) << beat;
+    cache.Advance(track);
+    reg = Advance(reg, 5);
+  }
+  scale_offset = 0;
+}
+
+TEST(TuringMachineTableBenchmark, CostPerBeat) {
+  static const int kBeats = 1 << 20;
+  static Cache cache;
+  cache.Invalidate();
+  Cache::Playback track;
+  cache.Start(track, 0x5a5a, 11, ValueOf);
+
+  int64_t sink = 0;
+  uint16_t reg = 0x5a5a;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kBeats; ++i) {
+    for (int o = 0; o < 4; ++o) sink += ValueOf(o, reg);
+    reg = Advance(reg, 11);
+  }
+  const double live = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start).count() / double(kBeats);
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kBeats; ++i) {
+    const Table *table = cache.Find(track, ValueOf);
+    for (int o = 0; o < 4; ++o) sink += table->value[track.step][o];
+    cache.Advance(track);
+  }
+  const double cached = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start).count() / double(kBeats);
+  printf("live %.1f ns, table %.1f ns per beat of 4 outputs (%lld)\n", live, cached, (long long)(sink & 1));
+}
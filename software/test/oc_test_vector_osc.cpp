@@ -0,0 +1,322 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include "gtest/gtest.h"
+
+// Arduino bits used by the header
+typedef uint8_t byte;
+#define DMAMEM
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#include "vector_osc/HSVectorOscillator.h"
+
+// VectorOscillator before the segment tables, for comparison. Divisions by
+// zero return 0 as they do on the Cortex-M.
+class ReferenceVectorOscillator {
+public:
+    void Cycle(bool cycle_ = 1) {cycle = cycle_;}
+    void Sustain(bool sustain_ = 1) {sustain = sustain_;}
+    void Offset(int32_t offset_) {offset = offset_;}
+
+    void Release() {
+        sustained = 0;
+        segment_index = segment_count - 1;
+        rise = calculate_rise(segment_index);
+    }
+
+    void SetSegment(HS::VOSegment segment) {
+        if (segment_count < HS::VO_MAX_SEGMENTS) {
+            segments[segment_count] = segment;
+            total_time += segments[segment_count].time;
+            segment_count++;
+        }
+    }
+
+    void SetSegment(byte ix, HS::VOSegment segment) {
+        ix = constrain(ix, 0, segment_count - 1);
+        total_time -= segments[ix].time;
+        segments[ix] = segment;
+        total_time += segments[ix].time;
+    }
+
+    void SetScale(uint16_t scale_) {scale = scale_;}
+
+    void SetFrequency(uint32_t frequency_) {
+        if (frequency_ != frequency) {
+            frequency = frequency_;
+            rise = calculate_rise(segment_index);
+        }
+    }
+
+    void Start() {
+        Reset();
+        eoc = 0;
+    }
+
+    void Reset() {
+        segment_index = 0;
+        signal = scale_level(segments[segment_count - 1].level);
+        rise = calculate_rise(segment_index);
+        sustained = 0;
+        eoc = !cycle;
+    }
+
+    int32_t Next() {
+        if (eoc && cycle == 0) return signal2int(scale_level(segments[segment_count - 1].level)) + offset;
+        if (!sustained) {
+            eoc = 0;
+            if (validate()) {
+                if (rise) {
+                    signal += rise;
+                    if (rise > 0 && signal >= target) advance_segment();
+                    else if (rise < 0 && signal <= target) advance_segment();
+                } else if (countdown) {
+                    --countdown;
+                    if (countdown == 0) advance_segment();
+                }
+            }
+        }
+        return signal2int(signal) + offset;
+    }
+
+    int32_t Phase(int degrees) {
+        degrees = degrees % 3600;
+        degrees = abs(degrees);
+        byte time_index = Proportion(degrees, 3600, total_time);
+        byte segment = 0;
+        byte time = 0;
+        for (byte ix = 0; ix < segment_count; ix++) {
+            time += segments[ix].time;
+            if (time > time_index) {
+                segment = ix;
+                break;
+            }
+        }
+        int start_degree = Proportion(time - segments[segment].time, total_time, 3600);
+        int segment_degrees = Proportion(segments[segment].time, total_time, 3600);
+        int start = signal2int(scale_level(segment == 0 ? segments[segment_count - 1].level : segments[segment - 1].level));
+        int end = signal2int(scale_level(segments[segment].level));
+        int signal = Proportion(degrees - start_degree, segment_degrees, end - start) + start;
+        return signal + offset;
+    }
+
+private:
+    VOSegment segments[12];
+    byte segment_count = 0;
+    int total_time = 0;
+    vosignal_t signal = 0;
+    vosignal_t target = 0;
+    bool eoc = 1;
+    byte segment_index = 0;
+    vosignal_t rise = 0;
+    uint32_t frequency = 0;
+    uint16_t scale = 0;
+    uint32_t countdown = 0;
+    bool cycle = 1;
+    int32_t offset = 0;
+    bool sustain = 0;
+    bool sustained = 0;
+
+    bool validate() {
+        return frequency && segment_count >= 2 && total_time && scale;
+    }
+
+    int32_t Proportion(int numerator, int denominator, int max_value) {
+        if (!denominator) return 0;
+        vosignal_t proportion = int2signal((int32_t)numerator) / (int32_t)denominator;
+        return signal2int(proportion * max_value);
+    }
+
+    vosignal_t scale_level(byte level) {
+        int b_level = constrain(level, 0, 255) - 128;
+        return int2signal(Proportion(b_level, 127, scale));
+    }
+
+    void advance_segment() {
+        if (sustain && segment_index == segment_count - 2) {
+            sustained = 1;
+        } else {
+            if (++segment_index >= segment_count) {
+                if (cycle) Reset();
+                eoc = 1;
+            } else rise = calculate_rise(segment_index);
+            sustained = 0;
+        }
+    }
+
+    vosignal_t calculate_rise(byte ix) {
+        byte level = segments[ix].level;
+        int time = segments[ix].time;
+        target = scale_level(level);
+        if (ix > 0) ix--;
+        else ix = segment_count - 1;
+        vosignal_t starting = scale_level(segments[ix].level);
+        int32_t cycle_ticks = frequency ? 16666667 / frequency : 0;
+        int32_t segment_ticks = Proportion(time, total_time, cycle_ticks);
+        vosignal_t new_rise = 0;
+        if (segment_ticks > 0) {
+            new_rise = ((target - starting) * 10) / segment_ticks;
+            if (new_rise == 0) {
+                uint32_t prev_countdown = countdown;
+                countdown = segment_ticks / 10;
+                if (prev_countdown > 0 && prev_countdown < countdown) countdown = prev_countdown;
+            }
+            else if ((signal2int(target) - signal2int(starting)) * (signal2int(target) - signal2int(signal)) < 0) new_rise = -new_rise;
+        } else {
+            signal = target;
+            countdown = 1;
+        }
+        return new_rise;
+    }
+};
+
+// Waveforms from the library plus random ones; the long random ones make the
+// running segment time wrap past 255.
+static const HS::VOSegment kSine[] = {
+    {191, 1}, {238, 1}, {255, 1}, {238, 1}, {191, 1}, {128, 1},
+    {64, 1}, {17, 1}, {0, 1}, {17, 1}, {64, 1}, {128, 1}
+};
+static const HS::VOSegment kSawtooth[] = { {255, 0}, {0, 1} };
+static const HS::VOSegment kRamp[] = { {0, 0}, {255, 1} };
+static const HS::VOSegment kEG[] = { {255, 1}, {200, 4}, {200, 8}, {128, 3} };
+
+template <typename Osc>
+static void SetWaveform(Osc &osc, const HS::VOSegment *segments, size_t count, uint16_t scale, uint32_t frequency) {
+    for (size_t s = 0; s < count; ++s) osc.SetSegment(segments[s]);
+    osc.SetScale(scale);
+    osc.SetFrequency(frequency);
+}
+
+static size_t RandomWaveform(std::mt19937 &rng, HS::VOSegment *segments, uint8_t max_time) {
+    size_t count = 2 + rng() % (HS::VO_MAX_SEGMENTS - 1);
+    for (size_t s = 0; s < count; ++s)
+        segments[s] = HS::VOSegment {static_cast<byte>(rng()), static_cast<byte>(rng() % (max_time + 1))};
+    return count;
+}
+
+static void ExpectSamePhase(VectorOscillator &osc, ReferenceVectorOscillator &reference, const char *name) {
+    for (int degrees = -3700; degrees < 7300; ++degrees)
+        ASSERT_EQ(reference.Phase(degrees), osc.Phase(degrees)) << name << " degrees " << degrees;
+}
+
+TEST(VectorOscillator, PhaseMatchesReference) {
+    static const uint16_t kScales[] = { 3840, (12 << 7) * 3, (12 << 7) * 8, 65535 };
+    for (uint16_t scale : kScales) {
+        VectorOscillator osc;
+        ReferenceVectorOscillator reference;
+        SetWaveform(osc, kSine, 12, scale, 100);
+        SetWaveform(reference, kSine, 12, scale, 100);
+        ExpectSamePhase(osc, reference, "sine");
+    }
+
+    VectorOscillator saw, ramp;
+    ReferenceVectorOscillator saw_reference, ramp_reference;
+    SetWaveform(saw, kSawtooth, 2, 7680, 100);
+    SetWaveform(saw_reference, kSawtooth, 2, 7680, 100);
+    ExpectSamePhase(saw, saw_reference, "sawtooth");
+    SetWaveform(ramp, kRamp, 2, 7680, 100);
+    SetWaveform(ramp_reference, kRamp, 2, 7680, 100);
+    ExpectSamePhase(ramp, ramp_reference, "ramp");
+
+    std::mt19937 rng(0x5ec7);
+    for (int w = 0; w < 400; ++w) {
+        HS::VOSegment segments[HS::VO_MAX_SEGMENTS];
+        size_t count = RandomWaveform(rng, segments, w % 2 ? 255 : 20);
+        uint16_t scale = 1 + rng() % 16000;
+        VectorOscillator osc;
+        ReferenceVectorOscillator reference;
+        SetWaveform(osc, segments, count, scale, 100);
+        SetWaveform(reference, segments, count, scale, 100);
+        osc.Offset(w);
+        reference.Offset(w);
+        ExpectSamePhase(osc, reference, "random");
+
+        // Editing a segment in place, as the waveform editor does
+        byte ix = rng() % count;
+        HS::VOSegment edit = {static_cast<byte>(rng()), static_cast<byte>(rng() % 50)};
+        osc.SetSegment(ix, edit);
+        reference.SetSegment(ix, edit);
+        ExpectSamePhase(osc, reference, "edited");
+    }
+}
+
+TEST(VectorOscillator, NextMatchesReference) {
+    std::mt19937 rng(0x0c1);
+    for (int w = 0; w < 300; ++w) {
+        HS::VOSegment segments[HS::VO_MAX_SEGMENTS];
+        size_t count = w < 4 ? 0 : RandomWaveform(rng, segments, w % 3 ? 30 : 255);
+        const HS::VOSegment *waveform = segments;
+        if (w == 0) { waveform = kSine; count = 12; }
+        if (w == 1) { waveform = kSawtooth; count = 2; }
+        if (w == 2) { waveform = kRamp; count = 2; }
+        if (w == 3) { waveform = kEG; count = 4; }
+
+        bool cycle = w % 4 != 3;
+        bool sustain = w % 4 == 3;
+        uint16_t scale = 1 + rng() % 16000;
+        uint32_t frequency = 10 + rng() % 50000;
+
+        VectorOscillator osc;
+        ReferenceVectorOscillator reference;
+        SetWaveform(osc, waveform, count, scale, frequency);
+        SetWaveform(reference, waveform, count, scale, frequency);
+        osc.Cycle(cycle);
+        reference.Cycle(cycle);
+        osc.Sustain(sustain);
+        reference.Sustain(sustain);
+        osc.Start();
+        reference.Start();
+
+        for (int tick = 0; tick < 20000; ++tick) {
+            if (tick % 2500 == 1250) {
+                frequency = 10 + rng() % 50000;
+                osc.SetFrequency(frequency);
+                reference.SetFrequency(frequency);
+            }
+            if (tick % 5000 == 3000) {
+                scale = 1 + rng() % 16000;
+                osc.SetScale(scale);
+                reference.SetScale(scale);
+            }
+            if (tick % 7000 == 6000) {
+                osc.Release();
+                reference.Release();
+            }
+            if (tick % 9000 == 0) {
+                osc.Start();
+                reference.Start();
+            }
+            ASSERT_EQ(reference.Next(), osc.Next()) << "waveform " << w << " tick " << tick;
+        }
+    }
+}
+
+template <typename Osc>
+static void BenchmarkOscillator(const char *name) {
+    static const int kIterations = 2000;
+    Osc osc;
+    SetWaveform(osc, kSine, 12, (12 << 7) * 4, 2000);
+    osc.Start();
+
+    int32_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i)
+        for (int degrees = 0; degrees < 3600; degrees += 3) checksum += osc.Phase(degrees);
+    auto phase_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations * 1200; ++i) checksum += osc.Next();
+    auto next_time = std::chrono::steady_clock::now() - start;
+
+    printf("%s: Phase %lld us, Next %lld us for %d calls each (checksum %d)\n", name,
+           (long long)std::chrono::duration_cast<std::chrono::microseconds>(phase_time).count(),
+           (long long)std::chrono::duration_cast<std::chrono::microseconds>(next_time).count(),
+           kIterations * 1200, checksum);
+}
+
+TEST(VectorOscillatorBenchmark, PhaseAndNext) {
+    BenchmarkOscillator<ReferenceVectorOscillator>("Reference");
+    BenchmarkOscillator<VectorOscillator>("VectorOscillator");
+}
@@ -0,0 +1,80 @@
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include "gtest/gtest.h"
+#include "vector_osc/HSVectorWavetable.h"
+
+typedef HS::VectorWavetable Table;
+
+static const size_t kSize = Table::kTableSize;
+
+// Magnitude of each harmonic of one table, by plain DFT
+static std::vector<double> Harmonics(const int16_t *data) {
+  std::vector<double> magnitude(kSize / 2 + 1);
+  for (size_t k = 0; k <= kSize / 2; ++k) {
+    double re = 0.0, im = 0.0;
+    for (size_t i = 0; i < kSize; ++i) {
+      const double angle = 2.0 * M_PI * k * i / kSize;
+      re += data[i] * cos(angle);
+      im -= data[i] * sin(angle);
+    }
+    magnitude[k] = sqrt(re * re + im * im) / kSize;
+  }
+  return magnitude;
+}
+
+// Harmonics each level keeps, as documented in HSVectorWavetable.h
+static size_t HarmonicLimit(int level) {
+  return level ? (kSize / 2) >> level : kSize / 2 - 1;
+}
+
+static void Build(HS::VectorWavetableBuilder &builder, const HS::WavetableSegment *segments, size_t count,
+                  std::vector<std::vector<int16_t>> &levels) {
+  levels.assign(Table::kNumLevels, std::vector<int16_t>());
+  builder.Start(segments, count);
+  while (builder.busy()) {
+    const int level = builder.Step();
+    if (level >= 0) levels[level].assign(builder.data(), builder.data() + kSize + 1);
+  }
+}
+
+// A saw (a jump and a ramp) and a square (two jumps) have every harmonic, so anything past a
+// level's limit would show
+TEST(VectorWavetable, LevelsAreBandLimited) {
+  static const HS::WavetableSegment kSaw[] = { {255, 0}, {0, 100} };
+  static const HS::WavetableSegment kSquare[] = { {255, 0}, {255, 50}, {0, 0}, {0, 50} };
+  static HS::VectorWavetableBuilder builder;
+  builder.Init();
+
+  for (const auto &wave : { std::make_pair(kSaw, size_t(2)), std::make_pair(kSquare, size_t(4)) }) {
+    std::vector<std::vector<int16_t>> levels;
+    Build(builder, wave.first, wave.second, levels);
+    for (int level = 0; level < Table::kNumLevels; ++level) {
+      ASSERT_EQ(kSize + 1, levels[level].size()) << level;
+      EXPECT_EQ(levels[level][0], levels[level][kSize]) << level;
+
+      const std::vector<double> h = Harmonics(levels[level].data());
+      const size_t limit = HarmonicLimit(level);
+      EXPECT_GT(h[1], 1000.0) << level;
+      EXPECT_LT(h[0], 1.0) << level; // no DC
+      double above = 0.0;
+      for (size_t k = limit + 1; k <= kSize / 2; ++k) above = std::max(above, h[k]);
+      // Only the rounding to int16_t is left up there
+      EXPECT_LT(above, 1.0) << "level " << level;
+    }
+  }
+}
+
+// Whatever the increment, the level played keeps its top harmonic below Nyquist
+TEST(VectorWavetable, LevelForIncrementAvoidsAliasing) {
+  for (int shift = 0; shift < 32; ++shift) {
+    for (uint32_t increment : { uint32_t(1) << shift, (uint32_t(3) << shift) >> 1, (uint32_t(1) << shift) - 1 }) {
+      if (increment == 0) continue;
+      const int level = Table::LevelForIncrement(increment);
+      if (level == Table::kNumLevels - 1) continue; // the sine, as good as it gets
+      const double top = HarmonicLimit(level) * double(increment) / 4294967296.0;
+      EXPECT_LT(top, 0.5) << "increment " << increment << " level " << level;
+    }
+  }
+}